@@ -0,0 +1,765 @@
+/**
+ * @file graph_bench.c
+ * @brief Benchmark driver with reproducible synthetic workloads
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Generates each workload over a size sweep, times every applicable module
+ * on it and prints one CSV row per (workload, size, module):
+ *
+ *   workload,nodes,edges,module,reps,min_s,median_s,mean_s,peak_rss_kb,edges_per_s,result
+ *
+ * Workloads (all undirected, seeded, identical across runs and machines):
+ * - er: Erdős–Rényi G(n, p) with average degree 8 (geometric edge skipping)
+ * - rmat: R-MAT power-law graph (a, b, c) = (0.57, 0.19, 0.19), 8 edges per
+ *   vertex, labels permuted, duplicates and self-loops dropped
+ * - regular: 6-regular graph realized with Havel-Hakimi, then randomized
+ *   by degree-preserving double edge swaps
+ * - bipartite: random bipartite graph with halves n / 2, average degree 8
+ * - moon_moser: complete n/3-partite graph with parts of size 3, which has
+ *   the maximum possible number 3^(n/3) of maximal cliques
+ *
+ * Every module runs in a forked child on the parent's graph, so peak RSS
+ * (ru_maxrss) is that of the graph plus the module alone, and a crash or
+ * failed allocation only loses one row. Timings exclude generation; the
+ * result column holds a module-specific value (component count, clique
+ * size, matching size, ...) so that regressions in the answers show up
+ * next to regressions in the times.
+ *
+ * --order degree|rcm relabels every generated graph (reorder.h) before the
+ * modules run, so a sweep with and without it shows what locality is worth;
+ * the progress line on stderr reports the bandwidth before and after.
+ *
+ * Usage: graph_bench [--quick] [--reps N] [--warmup N] [--seed S]
+ *                    [--workload NAME] [--module NAME] [--order NAME]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "structs.h"
+#include "csr_graph.h"
+#include "graph_io.h"
+#include "havel_hakimi.h"
+#include "connectivity.h"
+#include "clique.h"
+#include "matching.h"
+#include "euler_path.h"
+#include "line_graph.h"
+#include "connectivity_number.h"
+#include "reorder.h"
+#include "set_utils.h"
+
+/** Sizes per sweep */
+#define BENCH_SIZES 4
+
+/** Line graphs with more edges than this are skipped (memory, not time) */
+#define BENCH_MAX_LINE_EDGES 50000000LL
+
+/** κ(G) needs n - δ - 1 + δ(δ - 1) / 2 flows of O(κ · (V + E)) each */
+#define BENCH_MAX_FLOW_NODES 8192
+
+/* ========================================================================
+ * RANDOM NUMBERS
+ * ========================================================================*/
+
+static uint64_t rng_next(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/** Uniform in [0, bound) */
+static int rng_below(uint64_t *state, int bound)
+{
+    return (int)(rng_next(state) % (uint64_t)bound);
+}
+
+/** Uniform in [0, 1) */
+static double rng_unit(uint64_t *state)
+{
+    return (double)(rng_next(state) >> 11) * 0x1.0p-53;
+}
+
+/* ========================================================================
+ * EDGE LISTS
+ * ========================================================================*/
+
+/**
+ * @struct EdgeList
+ * @brief Growable edge list of a generated graph
+ */
+typedef struct
+{
+    Edge *edges;
+    int count;
+    int capacity;
+} EdgeList;
+
+static bool edge_list_push(EdgeList *list, int u, int v)
+{
+    if (list->count == list->capacity)
+    {
+        int capacity = list->capacity > 0 ? 2 * list->capacity : 1024;
+        Edge *grown = realloc(list->edges, capacity * sizeof(Edge));
+        if (!grown)
+            return false;
+        list->edges = grown;
+        list->capacity = capacity;
+    }
+    list->edges[list->count++] = (Edge){u, v};
+    return true;
+}
+
+static int compare_edges(const void *a, const void *b)
+{
+    const Edge *x = a, *y = b;
+    if (x->u != y->u)
+        return x->u < y->u ? -1 : 1;
+    return (x->v > y->v) - (x->v < y->v);
+}
+
+/**
+ * @brief Orders every edge as u < v, drops self-loops and sorts out duplicates
+ */
+static void edge_list_simplify(EdgeList *list)
+{
+    int kept = 0;
+    for (int i = 0; i < list->count; i++)
+    {
+        Edge e = list->edges[i];
+        if (e.u == e.v)
+            continue;
+        if (e.u > e.v)
+            list->edges[kept++] = (Edge){e.v, e.u};
+        else
+            list->edges[kept++] = e;
+    }
+    qsort(list->edges, kept, sizeof(Edge), compare_edges);
+    int unique = 0;
+    for (int i = 0; i < kept; i++)
+        if (unique == 0 || compare_edges(&list->edges[unique - 1], &list->edges[i]) != 0)
+            list->edges[unique++] = list->edges[i];
+    list->count = unique;
+}
+
+/* ========================================================================
+ * EDGE SET (DOUBLE EDGE SWAPS)
+ * ========================================================================*/
+
+#define EDGE_SET_EMPTY UINT64_MAX
+
+/**
+ * @struct EdgeSet
+ * @brief Open-addressing set of edge keys with backward-shift deletion
+ */
+typedef struct
+{
+    uint64_t *keys;
+    size_t mask;
+} EdgeSet;
+
+static uint64_t edge_key(int u, int v)
+{
+    return u < v ? ((uint64_t)u << 32) | (uint32_t)v : ((uint64_t)v << 32) | (uint32_t)u;
+}
+
+static size_t edge_set_home(const EdgeSet *set, uint64_t key)
+{
+    return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 17) & set->mask;
+}
+
+static bool edge_set_init(EdgeSet *set, int count)
+{
+    size_t size = 1024;
+    while (size < 4 * (size_t)count)
+        size *= 2;
+    set->keys = malloc(size * sizeof(uint64_t));
+    set->mask = size - 1;
+    if (!set->keys)
+        return false;
+    memset(set->keys, 0xFF, size * sizeof(uint64_t));
+    return true;
+}
+
+/** Slot holding key, or the empty slot where it would go */
+static size_t edge_set_slot(const EdgeSet *set, uint64_t key)
+{
+    size_t i = edge_set_home(set, key);
+    while (set->keys[i] != EDGE_SET_EMPTY && set->keys[i] != key)
+        i = (i + 1) & set->mask;
+    return i;
+}
+
+static bool edge_set_contains(const EdgeSet *set, uint64_t key)
+{
+    return set->keys[edge_set_slot(set, key)] == key;
+}
+
+static void edge_set_insert(EdgeSet *set, uint64_t key)
+{
+    set->keys[edge_set_slot(set, key)] = key;
+}
+
+static void edge_set_remove(EdgeSet *set, uint64_t key)
+{
+    size_t hole = edge_set_slot(set, key);
+    set->keys[hole] = EDGE_SET_EMPTY;
+
+    // Pull later entries of the cluster back unless their home lies
+    // cyclically in (hole, j], where the hole would not be on their path
+    for (size_t j = (hole + 1) & set->mask; set->keys[j] != EDGE_SET_EMPTY; j = (j + 1) & set->mask)
+    {
+        size_t home = edge_set_home(set, set->keys[j]);
+        bool stays = hole <= j ? (home > hole && home <= j) : (home > hole || home <= j);
+        if (!stays)
+        {
+            set->keys[hole] = set->keys[j];
+            set->keys[j] = EDGE_SET_EMPTY;
+            hole = j;
+        }
+    }
+}
+
+/* ========================================================================
+ * WORKLOAD GENERATORS
+ * ========================================================================*/
+
+/**
+ * @brief Erdős–Rényi G(n, p) with p = 8 / n, skipping non-edges geometrically
+ *
+ * @complexity O(n + E)
+ */
+static bool generate_er(int n, uint64_t *rng, EdgeList *list)
+{
+    double p = n > 1 ? 8.0 / (n - 1) : 0.0;
+    if (p <= 0.0)
+        return true;
+    double log_q = log(1.0 - p);
+    for (int u = 0; u < n; u++)
+    {
+        for (long long v = u;;)
+        {
+            v += 1 + (long long)floor(log(1.0 - rng_unit(rng)) / log_q);
+            if (v >= n)
+                break;
+            if (!edge_list_push(list, u, (int)v))
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief R-MAT graph on the next power of two ≥ n vertices with 8 edges per vertex
+ */
+static bool generate_rmat(int n, uint64_t *rng, EdgeList *list)
+{
+    int scale = 0;
+    while ((1 << scale) < n)
+        scale++;
+    int vertices = 1 << scale;
+    int *label = malloc(vertices * sizeof(int));
+    if (!label)
+        return false;
+    for (int v = 0; v < vertices; v++)
+        label[v] = v;
+    for (int v = vertices - 1; v > 0; v--)
+    {
+        int w = rng_below(rng, v + 1);
+        int t = label[v];
+        label[v] = label[w];
+        label[w] = t;
+    }
+
+    bool ok = true;
+    for (long long e = 0; ok && e < 8LL * vertices; e++)
+    {
+        int u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++)
+        {
+            double r = rng_unit(rng);
+            if (r < 0.57)
+                continue;
+            if (r < 0.76)
+                v |= 1 << bit;
+            else if (r < 0.95)
+                u |= 1 << bit;
+            else
+            {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        ok = edge_list_push(list, label[u], label[v]);
+    }
+    free(label);
+    return ok;
+}
+
+/**
+ * @brief 6-regular graph: Havel-Hakimi realization, then 4E random double edge swaps
+ *
+ * A swap replaces {a, b}, {c, d} by {a, d}, {c, b} when that creates no
+ * self-loop or duplicate, which keeps every degree and mixes the very
+ * regular structure Havel-Hakimi produces.
+ */
+static bool generate_regular(int n, uint64_t *rng, EdgeList *list)
+{
+    int *degrees = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (!degrees)
+        return false;
+    for (int v = 0; v < n; v++)
+        degrees[v] = n > 6 ? 6 : n - 1;
+    if ((long long)n * degrees[0] % 2 == 1)
+        degrees[n - 1]--;
+    Edge *edges = NULL;
+    int m = 0;
+    bool ok = havel_hakimi_realize(degrees, n, &edges, &m);
+    free(degrees);
+    if (!ok)
+        return false;
+
+    EdgeSet set;
+    if (!edge_set_init(&set, m))
+    {
+        free(edges);
+        return false;
+    }
+    for (int i = 0; i < m; i++)
+        edge_set_insert(&set, edge_key(edges[i].u, edges[i].v));
+    for (long long s = 0; m > 1 && s < 4LL * m; s++)
+    {
+        int i = rng_below(rng, m), j = rng_below(rng, m);
+        int a = edges[i].u, b = edges[i].v;
+        int c = edges[j].u, d = edges[j].v;
+        if (rng_next(rng) & 1)
+        {
+            int t = c;
+            c = d;
+            d = t;
+        }
+        if (a == d || c == b || a == c || b == d)
+            continue;
+        if (edge_set_contains(&set, edge_key(a, d)) || edge_set_contains(&set, edge_key(c, b)))
+            continue;
+        edge_set_remove(&set, edge_key(a, b));
+        edge_set_remove(&set, edge_key(c, d));
+        edge_set_insert(&set, edge_key(a, d));
+        edge_set_insert(&set, edge_key(c, b));
+        edges[i] = (Edge){a, d};
+        edges[j] = (Edge){c, b};
+    }
+    free(set.keys);
+
+    free(list->edges);
+    list->edges = edges;
+    list->count = m;
+    list->capacity = m;
+    return true;
+}
+
+/**
+ * @brief Random bipartite graph between [0, n/2) and [n/2, n) with average degree 8
+ */
+static bool generate_bipartite(int n, uint64_t *rng, EdgeList *list)
+{
+    int left = n / 2, right = n - left;
+    if (left == 0)
+        return true;
+    for (long long e = 0; e < 4LL * n; e++)
+        if (!edge_list_push(list, rng_below(rng, left), left + rng_below(rng, right)))
+            return false;
+    return true;
+}
+
+/**
+ * @brief Moon–Moser graph: u ~ v iff u / 3 ≠ v / 3 (n rounded down to a multiple of 3)
+ */
+static bool generate_moon_moser(int n, uint64_t *rng, EdgeList *list)
+{
+    (void)rng;
+    n -= n % 3;
+    for (int u = 0; u < n; u++)
+        for (int v = u + 1; v < n; v++)
+            if (u / 3 != v / 3 && !edge_list_push(list, u, v))
+                return false;
+    return true;
+}
+
+/**
+ * @struct Workload
+ * @brief Generator and size sweep of one workload
+ */
+typedef struct
+{
+    const char *name;
+    bool (*generate)(int n, uint64_t *rng, EdgeList *list);
+    int sizes[BENCH_SIZES];
+    int quick_sizes[BENCH_SIZES]; // 0 ends the sweep early
+    bool bipartite;
+} Workload;
+
+static const Workload WORKLOADS[] = {
+    {"er", generate_er, {2000, 8000, 32000, 128000}, {500, 2000, 0, 0}, false},
+    {"rmat", generate_rmat, {2048, 8192, 32768, 131072}, {512, 2048, 0, 0}, false},
+    {"regular", generate_regular, {2000, 8000, 32000, 128000}, {500, 2000, 0, 0}, false},
+    {"bipartite", generate_bipartite, {2000, 8000, 32000, 128000}, {500, 2000, 0, 0}, true},
+    {"moon_moser", generate_moon_moser, {18, 24, 30, 36}, {12, 18, 0, 0}, false},
+};
+
+/* ========================================================================
+ * MODULES
+ * ========================================================================*/
+
+/**
+ * @struct BenchCase
+ * @brief Generated graph and the facts the modules' limits depend on
+ */
+typedef struct
+{
+    const Workload *workload;
+    Graph graph;
+    long long line_edges; // Σ deg(v)·(deg(v) - 1) / 2 = |E(L(G))|
+} BenchCase;
+
+static long long run_connectivity(Graph *graph)
+{
+    return check_connectivity(graph).component_count;
+}
+
+static long long run_maximal_cliques(Graph *graph)
+{
+    int n = graph->node_count;
+    Set *C = set_create(n + 1), *P = set_create(n + 1), *S = set_create(n + 1);
+    for (int v = 0; v < n; v++)
+        set_add(P, v);
+    Set **cliques = NULL;
+    int count = 0;
+    find_maximal_cliques(graph, C, P, S, &cliques, &count);
+    for (int i = 0; i < count; i++)
+        set_destroy(cliques[i]);
+    free(cliques);
+    set_destroy(C);
+    set_destroy(P);
+    set_destroy(S);
+    return count;
+}
+
+static long long run_max_clique(Graph *graph)
+{
+    Set *clique = find_maximum_clique(graph);
+    long long size = clique ? clique->size : 0;
+    if (clique)
+        set_destroy(clique);
+    return size;
+}
+
+static long long run_matching(Graph *graph)
+{
+    return graph_maximum_matching(graph, MATCHING_INIT_KARP_SIPSER, NULL);
+}
+
+static long long run_euler(Graph *graph)
+{
+    int *path = NULL;
+    int length = 0;
+    EulerStatus status = euler_path_compute(graph, &path, &length);
+    free(path);
+    return status;
+}
+
+static long long run_line_graph(Graph *graph)
+{
+    Graph line_graph;
+    if (!line_graph_build(graph, 0, &line_graph, NULL))
+        return -1;
+    long long edges = line_graph.csr->edge_count;
+    graph_free_storage(&line_graph);
+    return edges;
+}
+
+static long long run_connectivity_number(Graph *graph)
+{
+    return calculate_connectivity_number(graph);
+}
+
+static bool applies_always(const BenchCase *bc)
+{
+    (void)bc;
+    return true;
+}
+
+static bool applies_matrix(const BenchCase *bc)
+{
+    return bc->graph.node_count <= GRAPH_IO_MATRIX_MAX_NODES;
+}
+
+static bool applies_bit_matrix(const BenchCase *bc)
+{
+    return bc->graph.node_count <= 4 * GRAPH_IO_MATRIX_MAX_NODES;
+}
+
+static bool applies_flows(const BenchCase *bc)
+{
+    return bc->graph.node_count <= BENCH_MAX_FLOW_NODES;
+}
+
+static bool applies_bipartite(const BenchCase *bc)
+{
+    return bc->workload->bipartite;
+}
+
+static bool applies_line_graph(const BenchCase *bc)
+{
+    return bc->line_edges <= BENCH_MAX_LINE_EDGES;
+}
+
+/**
+ * @struct Module
+ * @brief One timed entry point and when it is run
+ */
+typedef struct
+{
+    const char *name;
+    long long (*run)(Graph *graph);
+    bool (*applies)(const BenchCase *bc);
+    bool needs_matrix; // Build the adjacency matrix before timing
+} Module;
+
+static const Module MODULES[] = {
+    {"connectivity", run_connectivity, applies_always, false},
+    {"maximal_cliques", run_maximal_cliques, applies_matrix, true},
+    {"max_clique", run_max_clique, applies_bit_matrix, false},
+    {"matching", run_matching, applies_bipartite, false},
+    {"euler", run_euler, applies_always, false},
+    {"line_graph", run_line_graph, applies_line_graph, false},
+    {"connectivity_number", run_connectivity_number, applies_flows, false},
+};
+
+/* ========================================================================
+ * TIMING
+ * ========================================================================*/
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Child process body: warms up, times reps runs and prints the CSV row
+ */
+static int bench_module(BenchCase *bc, const Module *module, int warmup, int reps)
+{
+    Graph *graph = &bc->graph;
+    if (module->needs_matrix && !graph_ensure_adjacency(graph))
+        return 1;
+
+    long long result = 0;
+    for (int i = 0; i < warmup; i++)
+        result = module->run(graph);
+    double *times = malloc(reps * sizeof(double));
+    if (!times)
+        return 1;
+    double total = 0.0;
+    for (int i = 0; i < reps; i++)
+    {
+        double start = now_seconds();
+        result = module->run(graph);
+        times[i] = now_seconds() - start;
+        total += times[i];
+    }
+    qsort(times, reps, sizeof(double), compare_doubles);
+    double median = reps % 2 == 1 ? times[reps / 2] : (times[reps / 2 - 1] + times[reps / 2]) / 2.0;
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    int edges = graph->csr->edge_count;
+    printf("%s,%d,%d,%s,%d,%.6f,%.6f,%.6f,%ld,%.0f,%lld\n", bc->workload->name, graph->node_count, edges,
+           module->name, reps, times[0], median, total / reps, usage.ru_maxrss,
+           median > 0.0 ? edges / median : 0.0, result);
+    free(times);
+    return 0;
+}
+
+/**
+ * @brief Runs one module in a child process so its peak RSS is its own
+ */
+static void bench_fork(BenchCase *bc, const Module *module, int warmup, int reps)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        perror("graph_bench: fork");
+        return;
+    }
+    if (pid == 0)
+    {
+        int status = bench_module(bc, module, warmup, reps);
+        fflush(stdout);
+        _exit(status);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (WIFSIGNALED(status))
+        fprintf(stderr, "graph_bench: %s on %s (n = %d) killed by signal %d\n", module->name, bc->workload->name,
+                bc->graph.node_count, WTERMSIG(status));
+    else if (WEXITSTATUS(status) != 0)
+        fprintf(stderr, "graph_bench: %s on %s (n = %d) ran out of memory\n", module->name, bc->workload->name,
+                bc->graph.node_count);
+}
+
+/**
+ * @brief Generates one workload instance as a CSR-only graph
+ */
+/**
+ * @brief Relabels a generated graph in place, printing the bandwidth change
+ */
+static bool bench_case_reorder(BenchCase *bc, VertexOrder order)
+{
+    int *perm = vertex_order_compute(bc->graph.csr, order);
+    Graph relabelled;
+    if (!perm || !graph_reorder(&bc->graph, perm, &relabelled))
+    {
+        free(perm);
+        return false;
+    }
+    fprintf(stderr, "    %s order: bandwidth %d -> %d\n", vertex_order_name(order), csr_bandwidth(bc->graph.csr),
+            csr_bandwidth(relabelled.csr));
+    free(perm);
+    graph_free_storage(&bc->graph);
+    bc->graph = relabelled;
+    return true;
+}
+
+static bool bench_case_create(BenchCase *bc, const Workload *workload, int n, uint64_t seed)
+{
+    uint64_t rng = seed ^ (0x5851F42D4C957F2DULL * (uint64_t)n);
+    EdgeList list = {NULL, 0, 0};
+    if (!workload->generate(n, &rng, &list))
+    {
+        free(list.edges);
+        return false;
+    }
+    edge_list_simplify(&list);
+
+    int vertices = n;
+    for (int i = 0; i < list.count; i++)
+        vertices = list.edges[i].v >= vertices ? list.edges[i].v + 1 : vertices;
+    CSRGraph *csr = csr_create_from_edges(vertices, list.edges, list.count, false);
+    free(list.edges);
+    if (!csr)
+        return false;
+
+    memset(bc, 0, sizeof(*bc));
+    bc->workload = workload;
+    bc->graph.node_count = vertices;
+    bc->graph.csr = csr;
+    for (int v = 0; v < vertices; v++)
+    {
+        long long d = csr_degree(csr, v);
+        bc->line_edges += d * (d - 1) / 2;
+    }
+    return true;
+}
+
+/* ========================================================================
+ * MAIN
+ * ========================================================================*/
+
+int main(int argc, char *argv[])
+{
+    bool quick = false;
+    int reps = 5, warmup = 1;
+    uint64_t seed = 42;
+    const char *workload_filter = NULL;
+    const char *module_filter = NULL;
+    VertexOrder order = VERTEX_ORDER_NONE;
+    bool usage_error = false;
+    for (int i = 1; i < argc && !usage_error; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--quick") == 0)
+            quick = true;
+        else if (has_value && strcmp(argv[i], "--reps") == 0)
+            usage_error = (reps = atoi(argv[++i])) < 1;
+        else if (has_value && strcmp(argv[i], "--warmup") == 0)
+            usage_error = (warmup = atoi(argv[++i])) < 0;
+        else if (has_value && strcmp(argv[i], "--seed") == 0)
+            seed = strtoull(argv[++i], NULL, 10);
+        else if (has_value && strcmp(argv[i], "--workload") == 0)
+            workload_filter = argv[++i];
+        else if (has_value && strcmp(argv[i], "--module") == 0)
+            module_filter = argv[++i];
+        else if (has_value && strcmp(argv[i], "--order") == 0)
+            usage_error = !vertex_order_parse(argv[++i], &order);
+        else
+            usage_error = true;
+    }
+    if (usage_error)
+    {
+        fprintf(stderr,
+                "Usage: %s [--quick] [--reps N] [--warmup N] [--seed S] [--workload NAME] [--module NAME]"
+                " [--order NAME]\n",
+                argv[0]);
+        return 1;
+    }
+
+    printf("workload,nodes,edges,module,reps,min_s,median_s,mean_s,peak_rss_kb,edges_per_s,result\n");
+    for (size_t w = 0; w < sizeof(WORKLOADS) / sizeof(WORKLOADS[0]); w++)
+    {
+        const Workload *workload = &WORKLOADS[w];
+        if (workload_filter && strcmp(workload_filter, workload->name) != 0)
+            continue;
+        for (int s = 0; s < BENCH_SIZES; s++)
+        {
+            int n = quick ? workload->quick_sizes[s] : workload->sizes[s];
+            if (n == 0)
+                break;
+            BenchCase bc;
+            double start = now_seconds();
+            if (!bench_case_create(&bc, workload, n, seed))
+            {
+                fprintf(stderr, "graph_bench: cannot generate %s (n = %d)\n", workload->name, n);
+                continue;
+            }
+            fprintf(stderr, "==> %s: %d vertices, %d edges (generated in %.3f s)\n", workload->name,
+                    bc.graph.node_count, bc.graph.csr->edge_count, now_seconds() - start);
+            if (order != VERTEX_ORDER_NONE && !bench_case_reorder(&bc, order))
+            {
+                fprintf(stderr, "graph_bench: cannot reorder %s (n = %d)\n", workload->name, n);
+                graph_free_storage(&bc.graph);
+                continue;
+            }
+            for (size_t m = 0; m < sizeof(MODULES) / sizeof(MODULES[0]); m++)
+            {
+                const Module *module = &MODULES[m];
+                if ((module_filter && strcmp(module_filter, module->name) != 0) || !module->applies(&bc))
+                    continue;
+                bench_fork(&bc, module, warmup, reps);
+            }
+            graph_free_storage(&bc.graph);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file batch.h
+ * @brief Non-interactive batch driver with JSON / CSV results
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Runs a list of analyses on each graph of a job file (or on one graph given
+ * on the command line) without prompts, DOT files or Graphviz calls, and
+ * writes machine-readable results.
+ *
+ * Job file: one job per line, '#' starts a comment line.
+ *
+ *   undirected d1 d2 ... dn                  [: analyses]
+ *   directed [bidirectional] o1 ... on / i1 ... in [: analyses]
+ *   load FILE | edges FILE | arcs FILE | metis FILE [: analyses]
+ *
+ * Degree sequences are realized with Havel-Hakimi / Kleitman-Wang; files
+ * are read with graph_io.h (arcs = directed edge list). Analyses are a
+ * comma-separated list of names (see batch_parse_analyses()); without a
+ * list every analysis runs.
+ *
+ * Each graph is built once per job and derived structures are shared by its
+ * analyses: the degree array (degrees, line_graph), the component labelling
+ * (connectivity, components) and the maximum independent set
+ * (independent_set, vertex_cover).
+ *
+ * Output:
+ * - JSON: one object per job and line,
+ *   {"job":1,"source":"...","nodes":n,"edges":m,"directed":false,
+ *    "results":{"components":{"count":1,"largest":4},...}}
+ *   or {"job":1,"source":"...","error":"..."} if the graph cannot be built
+ * - CSV: header "job,source,analysis,metric,value", one row per value;
+ *   vertex lists are space separated
+ *
+ * An analysis that does not apply (directed graph, no adjacency matrix)
+ * reports an "error" metric instead of its values.
+ *
+ * With search limits set (batch_set_search_limits()), "cliques" and
+ * "max_clique" each run under a fresh budget and add a "status" value
+ * ("complete", "time_limit", "node_limit"); "max_clique" also reports the
+ * proven "upper_bound" on the clique number next to its incumbent.
+ *
+ * With a vertex order set (batch_set_vertex_order()), each graph is
+ * relabelled once (reorder.h) before its analyses run, and every reported
+ * vertex (sets, Euler path, cut) is translated back to the input labels.
+ * Sets stay sorted in those labels; which of several optimal answers is
+ * reported may differ from the run without reordering.
+ *
+ * Built with GRAPH_STATS (make STATS=1), every analysis also reports a
+ * "stats" object (CSV: "stats.<name>" metrics) with its time in ms, the heap
+ * peak above the live size at its start, and the graph_stats.h counters it
+ * moved. Shared structures are charged to the first analysis that builds them.
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include "structs.h"
+#include "reorder.h"
+
+/**
+ * @enum BatchFormat
+ * @brief Result encoding
+ */
+typedef enum {
+    BATCH_FORMAT_JSON,
+    BATCH_FORMAT_CSV
+} BatchFormat;
+
+/**
+ * @enum BatchAnalysis
+ * @brief Analysis flags, combined into a mask
+ */
+typedef enum {
+    BATCH_DEGREES = 1u << 0,             /**< "degrees": min / max / mean degree */
+    BATCH_CONNECTIVITY = 1u << 1,        /**< "connectivity": connected, or strong / weak / one-sided */
+    BATCH_COMPONENTS = 1u << 2,          /**< "components": (weak) component count and largest size */
+    BATCH_CLIQUES = 1u << 3,             /**< "cliques": maximal clique count and clique number */
+    BATCH_MAX_CLIQUE = 1u << 4,          /**< "max_clique": one maximum clique */
+    BATCH_INDEPENDENT_SET = 1u << 5,     /**< "independent_set": one maximum independent set */
+    BATCH_VERTEX_COVER = 1u << 6,        /**< "vertex_cover": exact minimum vertex cover */
+    BATCH_VERTEX_COVER_KONIG = 1u << 7,  /**< "vertex_cover_konig": König cover if bipartite */
+    BATCH_VERTEX_COVER_APPROX = 1u << 8, /**< "vertex_cover_approx": matching 2-approximation */
+    BATCH_EULER = 1u << 9,               /**< "euler": Euler path / cycle */
+    BATCH_CONNECTIVITY_NUMBER = 1u << 10, /**< "connectivity_number": κ(G) and a minimum cut */
+    BATCH_LINE_GRAPH = 1u << 11,         /**< "line_graph": vertex and edge count of L(G) */
+    BATCH_ALL = (1u << 12) - 1           /**< "all" */
+} BatchAnalysis;
+
+/**
+ * @brief Parses a comma-separated list of analysis names into a mask
+ *
+ * @param list Names as documented in BatchAnalysis (e.g. "degrees,euler")
+ * @param mask_out Receives the combined flags
+ * @return false if a name is unknown
+ */
+bool batch_parse_analyses(const char *list, unsigned *mask_out);
+
+/**
+ * @brief Limits every budgeted analysis of later jobs (see search_budget.h)
+ *
+ * @param seconds Wall-clock limit per analysis (≤ 0 for none)
+ * @param node_limit Search nodes per analysis (≤ 0 for none)
+ */
+void batch_set_search_limits(double seconds, long long node_limit);
+
+/**
+ * @brief Relabels the graph of every later job before its analyses run
+ *
+ * @param order Vertex order (VERTEX_ORDER_NONE, the default, keeps the input labels)
+ */
+void batch_set_vertex_order(VertexOrder order);
+
+/**
+ * @brief Writes the CSV header line (nothing for JSON)
+ */
+void batch_write_header(FILE *out, BatchFormat format);
+
+/**
+ * @brief Runs analyses on an existing graph and writes one job record
+ *
+ * @param graph Graph to analyse (not modified or freed; derived structures
+ *              are released before returning)
+ * @param job Job number written to the record
+ * @param source Description of where the graph came from
+ * @param analyses Mask of BatchAnalysis flags
+ * @param format Output format
+ * @param out Output stream
+ */
+void batch_run_graph(Graph *graph, int job, const char *source, unsigned analyses, BatchFormat format,
+                     FILE *out);
+
+/**
+ * @brief Runs every job of a job file
+ *
+ * @param jobs Job file stream
+ * @param format Output format
+ * @param out Output stream (the CSV header is written first)
+ * @return Number of jobs whose graph could not be built (reported inline)
+ *
+ * @complexity One graph construction per job plus the chosen analyses
+ */
+int batch_run_jobs(FILE *jobs, BatchFormat format, FILE *out);
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file bfs.h
+ * @brief Direction-optimizing breadth-first search shared by all traversals
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * One BFS kernel for Euler connectivity checks, vertex-cut
+ * testing and bipartite colouring. It follows Beamer's direction-optimizing
+ * scheme:
+ * - Top-down steps expand a sparse frontier (a slice of the visit queue)
+ *   along out-rows; they are cheap while the frontier is small
+ * - Bottom-up steps let every unvisited vertex look for a parent in a dense
+ *   frontier bitmap and stop at the first hit; on low-diameter, power-law
+ *   graphs they skip most of the edges a top-down step would inspect
+ * - The kernel switches to bottom-up when the frontier's edges exceed
+ *   1/BFS_ALPHA of the unexplored edges and back once the frontier shrinks
+ *   below n/BFS_BETA vertices
+ *
+ * Bottom-up steps on large graphs are split across threads by 64-vertex
+ * word ranges: each thread only writes the visited / next-frontier words of
+ * its own range, so no atomics are needed. Top-down steps only run on small
+ * frontiers and stay sequential.
+ *
+ * A BFSWorkspace owns every buffer and is reused between runs; a run only
+ * resets the entries the previous run touched, so many small searches (one
+ * per component, one per tested vertex subset) cost O(reached) each rather
+ * than O(V).
+ *
+ * Time Complexity: O(V + E) per run
+ * Space Complexity: O(V) for levels, the queue and three bitmaps
+ */
+
+#ifndef BFS_H
+#define BFS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "structs.h"
+
+/** Top-down → bottom-up when frontier edges > unexplored edges / BFS_ALPHA */
+#define BFS_ALPHA 14
+
+/** Bottom-up → top-down when the frontier has fewer than n / BFS_BETA vertices */
+#define BFS_BETA 24
+
+/** Bottom-up steps are multithreaded only from this many vertices on */
+#define BFS_PARALLEL_MIN_VERTICES 65536
+
+/**
+ * @brief Which arcs a search follows
+ */
+typedef enum {
+    BFS_FORWARD,   /**< Out-arcs only (equals BFS_WEAK on undirected graphs) */
+    BFS_WEAK       /**< Arcs in both directions (weak connectivity of digraphs) */
+} BFSMode;
+
+/**
+ * @struct BFSWorkspace
+ * @brief Reusable BFS state; levels and visit order stay valid until the next run
+ */
+typedef struct {
+    int node_count;
+    int words;          // Words per bitmap
+    int threads;        // Workers for bottom-up steps
+    int reached;        // Vertices reached by the last run
+    int *level;         // level[v] = BFS depth from the nearest source, -1 if unreached
+    int *queue;         // queue[0 .. reached) = visit order, grouped by level
+    uint64_t *visited;
+    uint64_t *frontier; // Dense frontier of the current bottom-up step
+    uint64_t *next;     // Dense frontier being built
+} BFSWorkspace;
+
+/**
+ * @brief Creates a workspace for graphs with node_count vertices
+ *
+ * @param node_count Number of vertices
+ * @param threads Workers for bottom-up steps (≤ 0 for all online processors)
+ * @return New workspace (all levels -1), or NULL on allocation failure
+ */
+BFSWorkspace *bfs_workspace_create(int node_count, int threads);
+
+/**
+ * @brief Frees a workspace (NULL is allowed)
+ */
+void bfs_workspace_destroy(BFSWorkspace *ws);
+
+/**
+ * @brief Runs a multi-source BFS
+ *
+ * @param ws Workspace created for csr->node_count vertices
+ * @param csr Graph to search (BFS_FORWARD bottom-up steps on digraphs use the reverse CSR)
+ * @param sources Start vertices (level 0); blocked or repeated sources are ignored
+ * @param source_count Number of sources
+ * @param mode Arcs to follow
+ * @param blocked Bitmask of vertices treated as deleted, or NULL
+ * @return Number of vertices reached (also ws->reached)
+ *
+ * @complexity O(V + E) worst case; O(reached + edges scanned) when the
+ *             search stays top-down
+ *
+ * @post ws->level and ws->queue describe this run
+ */
+int bfs_run(BFSWorkspace *ws, const CSRGraph *csr, const int *sources, int source_count,
+            BFSMode mode, const uint64_t *blocked);
+
+/**
+ * @brief Number of vertices reachable from one source (convenience wrapper)
+ *
+ * Allocates a temporary workspace; use bfs_run() directly for repeated searches.
+ *
+ * @return Reached count including the source, or -1 on allocation failure
+ */
+int bfs_reach_count(const CSRGraph *csr, int source, BFSMode mode);
+
+#endif
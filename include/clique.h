@@ -7,9 +7,11 @@
  * This module implements various algorithms for finding cliques in undirected graphs.
  * A clique is a subset of vertices where every pair of vertices is adjacent.
  * 
- * The module provides two main approaches:
+ * The module provides three main approaches:
  * 1. Backtracking algorithm: Finds all possible cliques (may include duplicates)
  * 2. Bron-Kerbosch algorithm: Finds all maximal cliques efficiently using branch-and-bound
+ * 3. Degeneracy-ordered Bron-Kerbosch: Maximal cliques in time bounded by the
+ *    graph degeneracy, suitable for large sparse graphs
  * 
  * Key concepts:
  * - Clique: Complete subgraph where every pair of vertices is connected
@@ -24,6 +26,49 @@
 #define CLIQUE_H
 
 #include "structs.h"
+#include "search_budget.h"
+
+/**
+ * @enum CliqueEngine
+ * @brief Enumeration engines usable with the streaming API
+ * 
+ * Values match the clique menu choices of the interactive program.
+ */
+typedef enum {
+    CLIQUE_ENGINE_BACKTRACKING = 1, /**< All cliques (not only maximal), Set-based backtracking */
+    CLIQUE_ENGINE_BITSET = 2,       /**< Maximal cliques, bitset Bron-Kerbosch with pivoting */
+    CLIQUE_ENGINE_DEGENERACY = 3,   /**< Maximal cliques, degeneracy-ordered (sparse graphs) */
+    CLIQUE_ENGINE_PARALLEL = 4      /**< Maximal cliques, bitset engine on all cores */
+} CliqueEngine;
+
+/**
+ * @brief Callback receiving one clique at a time
+ * 
+ * @param vertices Clique vertices; only valid for the duration of the call
+ * @param size Number of vertices
+ * @param user_data Pointer given to visit_cliques()
+ * @return true to continue, false to stop the enumeration
+ */
+typedef bool (*CliqueVisitor)(const int *vertices, int size, void *user_data);
+
+/**
+ * @struct CliqueCounts
+ * @brief Result of count_cliques()
+ */
+typedef struct {
+    long long count; /**< Number of cliques visited */
+    int max_size;    /**< Largest clique size seen (0 for empty graphs) */
+} CliqueCounts;
+
+/**
+ * @struct MaxCliqueResult
+ * @brief Result of find_maximum_clique_budget()
+ */
+typedef struct {
+    SearchStatus status; /**< SEARCH_COMPLETE if clique is proven maximum */
+    Set *clique;         /**< Best clique found (caller frees), NULL without vertices or memory */
+    int upper_bound;     /**< Proven ω(G) ≤ upper_bound; the clique size when complete */
+} MaxCliqueResult;
 
 /**
  * @brief Finds all cliques using backtracking algorithm
@@ -58,6 +103,18 @@
  */
 void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques, int *count);
 
+/**
+ * @brief find_all_cliques() under a time / node budget
+ * 
+ * Charges one node per recursion step; when the budget runs out the
+ * search unwinds and the cliques found so far are returned.
+ * 
+ * @param budget Search budget (see search_budget.h), NULL for no limit
+ * @return SEARCH_COMPLETE if every clique was found, otherwise why the budget ran out
+ */
+SearchStatus find_all_cliques_budget(Graph *graph, Set *C, Set *P, Set *S, SearchBudget *budget,
+                                     Set ***all_cliques, int *count);
+
 /**
  * @brief Finds maximal cliques using Bron-Kerbosch algorithm with pivot
  * 
@@ -95,39 +152,266 @@ void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques,
 void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_cliques, int *count);
 
 /**
- * @brief Finds one maximum clique (largest among all maximal cliques)
+ * @brief find_maximal_cliques() under a time / node budget
+ * 
+ * Charges one node per recursion step; when the budget runs out the
+ * search unwinds. Every clique returned is maximal, but some may be missing.
+ * 
+ * @param budget Search budget (see search_budget.h), NULL for no limit
+ * @return SEARCH_COMPLETE if every maximal clique was found, otherwise why
+ *         the budget ran out
+ */
+SearchStatus find_maximal_cliques_budget(Graph *graph, Set *C, Set *P, Set *S, SearchBudget *budget,
+                                         Set ***maximal_cliques, int *count);
+
+/**
+ * @brief Finds all maximal cliques using a bitset Bron-Kerbosch engine
+ * 
+ * Runs the same pivoted recursion as find_maximal_cliques() from C = ∅,
+ * P = V, S = ∅, but keeps P, S and every neighborhood N(v) as bitsets over
+ * a cache-line aligned BitMatrix (see bitset.h). P ∩ N(v), S ∩ N(v) and
+ * the pivot score |P ∩ N(u)| become word-wise AND plus popcount, and
+ * recursion frames are reused per depth instead of allocated per call.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param maximal_cliques Pointer to array of maximal clique pointers
+ * @param count Pointer to counter of found maximal cliques
+ * 
+ * @complexity O(3^(n/3) · n/64) worst case
+ * 
+ * @pre graph must be an undirected graph
+ * @post maximal_cliques contains all maximal cliques (caller must free)
+ * @post count contains the number of maximal cliques found
+ * 
+ * @note Produces the same set of maximal cliques as find_maximal_cliques()
+ * @note The bit matrix uses n²/8 bytes, 32× less than the int matrix
+ */
+void find_maximal_cliques_bitset(Graph *graph, Set ***maximal_cliques, int *count);
+
+/**
+ * @brief Finds all maximal cliques with the bitset engine on multiple threads
+ * 
+ * Runs the bitset Bron-Kerbosch recursion on a work-stealing task pool.
+ * The search starts as one root task; when a worker runs out of work, the
+ * busy workers split their next branch (top-level or deep) off as a new
+ * task. Results are collected in per-worker stores and concatenated.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param num_threads Number of worker threads (≤ 0 uses all online cores)
+ * @param maximal_cliques Pointer to array of maximal clique pointers
+ * @param count Pointer to counter of found maximal cliques
+ * 
+ * @pre graph must be an undirected graph
+ * @post maximal_cliques contains all maximal cliques (caller must free)
+ * 
+ * @note Same cliques as find_maximal_cliques_bitset(), in nondeterministic order
+ * @note Falls back to the sequential engine if the pool cannot be created
+ */
+void find_maximal_cliques_parallel(Graph *graph, int num_threads, Set ***maximal_cliques, int *count);
+
+/**
+ * @brief Computes a degeneracy (smallest-last) ordering of the vertices
+ * 
+ * Repeatedly removes a vertex of minimum remaining degree using the
+ * Batagelj-Zaversnik bucket structure. Every vertex has at most d neighbors
+ * later in the ordering, where d is the degeneracy of the graph.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param order_out Caller-allocated array of size node_count receiving the ordering
+ * @param degeneracy_out Receives the degeneracy (may be NULL)
+ * @return false if the CSR view cannot be built (out of memory)
+ * 
+ * @complexity O(V + E)
+ */
+bool compute_degeneracy_ordering(Graph *graph, int *order_out, int *degeneracy_out);
+
+/**
+ * @brief Finds all maximal cliques with degeneracy-ordered Bron-Kerbosch
+ * 
+ * Eppstein-Löffler-Strash variant: vertices are processed in degeneracy
+ * order, and each vertex v starts a pivoted recursion with P = later
+ * neighbors of v and X = earlier neighbors of v. Adjacency tests use binary
+ * search in the CSR rows, so no O(n²) structure is needed.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param maximal_cliques Pointer to array of maximal clique pointers
+ * @param count Pointer to counter of found maximal cliques
+ * 
+ * @complexity O(d · n · 3^(d/3)) where d is the degeneracy
+ * 
+ * @pre graph must be an undirected graph
+ * @post maximal_cliques contains all maximal cliques (caller must free)
+ * 
+ * @note Produces the same set of maximal cliques as find_maximal_cliques()
+ * @note Intended for large sparse graphs (100k+ vertices, small degeneracy)
+ */
+void find_maximal_cliques_degeneracy(Graph *graph, Set ***maximal_cliques, int *count);
+
+/**
+ * @brief Finds one maximum clique with a coloring-bound branch-and-bound search
  * 
- * This function finds the maximum clique by first finding all maximal cliques
- * using the Bron-Kerbosch algorithm, then selecting the largest one.
+ * Renumbers the vertices by reverse degeneracy order, seeds the incumbent
+ * with a greedy clique and then searches with greedy-coloring upper bounds
+ * (MCS/BBMC style), cutting every branch that cannot beat the incumbent.
+ * Maximal cliques are never materialized.
  * 
  * @param graph Pointer to the graph structure
  * @return Pointer to Set containing the maximum clique vertices, or NULL if none found
  * 
- * @complexity O(3^(n/3)) same as finding all maximal cliques
+ * @complexity O(2^n) worst case; the bounds prune most branches in practice
  * 
  * @pre graph must be a valid undirected graph
- * @post Returns the largest maximal clique found
+ * @post Returns a clique of maximum size
  * @post Caller must free the returned Set using set_destroy()
  * 
  * @note If multiple maximum cliques exist, returns one of them
- * @note Returns NULL for empty graphs or graphs with no edges
+ * @note Uses O(n²/64) words for the bit matrix and O(n · ω) ints for the
+ *       per-depth branching lists, where ω is the clique number
+ * @note Returns NULL for graphs with no vertices
  */
 Set *find_maximum_clique(Graph *graph);
 
+/**
+ * @brief Anytime version of find_maximum_clique()
+ * 
+ * Runs the same branch-and-bound search, charging one node per recursion
+ * step. When the budget runs out, the incumbent (at least the greedy
+ * clique) is returned with the largest coloring bound of the subtrees
+ * left unexplored, or d + 1 (d = degeneracy) if the search never started.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param budget Search budget (see search_budget.h), NULL for no limit
+ * @return Incumbent, proven upper bound and status; status is
+ *         SEARCH_COMPLETE whenever the bound equals the incumbent size
+ * 
+ * @post Caller must free result.clique using set_destroy()
+ */
+MaxCliqueResult find_maximum_clique_budget(Graph *graph, SearchBudget *budget);
+
+/**
+ * @brief Finds one maximum clique of the complement graph (a maximum independent set)
+ * 
+ * Runs the search of find_maximum_clique() against a complemented view of
+ * graph's own bit matrix: rows are negated and the diagonal masked word by
+ * word as the search reads them, and the degeneracy ordering is computed
+ * for the complement from the CSR rows. No complement graph is built, so
+ * peak memory is the n²/8-byte bit matrix of graph instead of an n × n int
+ * matrix.
+ * 
+ * @param graph Pointer to an undirected graph
+ * @return Pointer to Set of pairwise non-adjacent vertices of maximum size,
+ *         or NULL if the graph has no vertices
+ * 
+ * @complexity O(2^n) worst case plus O(n²) for the complement ordering
+ * 
+ * @post Caller must free the returned Set using set_destroy()
+ */
+Set *find_maximum_clique_complement(Graph *graph);
+
+/**
+ * @brief Finds one maximum clique with the branch-and-bound search on multiple threads
+ * 
+ * Parallel version of find_maximum_clique(): branches become tasks on a
+ * work-stealing pool when workers are idle, and all workers prune against
+ * a shared atomic incumbent size so improvements propagate immediately.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param num_threads Number of worker threads (≤ 0 uses all online cores)
+ * @return Pointer to Set containing the maximum clique vertices, or NULL if none found
+ * 
+ * @pre graph must be a valid undirected graph
+ * @post Caller must free the returned Set using set_destroy()
+ * 
+ * @note The size is deterministic; which maximum clique is returned may vary
+ */
+Set *find_maximum_clique_parallel(Graph *graph, int num_threads);
+
+/**
+ * @brief Streams cliques to a visitor without materializing them
+ * 
+ * Each clique is handed to the visitor as soon as the engine finds it, so
+ * memory is bounded by the recursion state (O(depth) frames) rather than by
+ * the number of cliques.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param engine Enumeration engine
+ * @param visitor Callback invoked once per clique
+ * @param user_data Opaque pointer forwarded to the visitor
+ * @return true if the enumeration completed, false if the visitor stopped it
+ * 
+ * @pre graph must be a valid undirected graph
+ * 
+ * @note With CLIQUE_ENGINE_PARALLEL the visitor runs on worker threads, but
+ *       calls are serialized by a lock, so it needs no synchronization
+ */
+bool visit_cliques(Graph *graph, CliqueEngine engine, CliqueVisitor visitor, void *user_data);
+
+/**
+ * @brief visit_cliques() under a time / node budget
+ * 
+ * Every engine charges one node per recursion step and unwinds once the
+ * budget runs out; the visitor has seen every clique found until then.
+ * 
+ * @param budget Search budget (see search_budget.h), NULL for no limit
+ * @return true if the enumeration completed; search_budget_status() tells
+ *         whether false came from the budget or the visitor
+ */
+bool visit_cliques_budget(Graph *graph, CliqueEngine engine, SearchBudget *budget,
+                          CliqueVisitor visitor, void *user_data);
+
+/**
+ * @brief Counts cliques and tracks the largest size without storing any
+ * 
+ * @param graph Pointer to the graph structure
+ * @param engine Enumeration engine
+ * @return Clique count and maximum clique size
+ * 
+ * @complexity Same as the engine; O(depth) memory
+ */
+CliqueCounts count_cliques(Graph *graph, CliqueEngine engine);
+
+/**
+ * @brief count_cliques() under a time / node budget (counts so far when it runs out)
+ */
+CliqueCounts count_cliques_budget(Graph *graph, CliqueEngine engine, SearchBudget *budget);
+
+/**
+ * @brief Collects the k largest cliques with at least min_size vertices
+ * 
+ * Keeps a size-keyed min-heap of at most k cliques while streaming, so
+ * memory is O(k · ω) instead of O(number of cliques).
+ * 
+ * @param graph Pointer to the graph structure
+ * @param engine Enumeration engine
+ * @param k Maximum number of cliques to return (≤ 0 for no limit)
+ * @param min_size Minimum clique size (threshold mode; 0 or 1 keeps all sizes)
+ * @param cliques Receives a newly allocated array sorted by decreasing size
+ * @return Number of cliques in the array
+ * 
+ * @post Caller must free each Set with set_destroy() and the array with free()
+ * 
+ * @note Ties at the k-th size keep the cliques found first
+ */
+int collect_largest_cliques(Graph *graph, CliqueEngine engine, int k, int min_size, Set ***cliques);
+
 /**
  * @brief Analyzes and prints clique information for a graph
  * 
  * Convenience function that performs clique analysis and prints results.
- * Allows choosing between two different algorithms and provides formatted
+ * Cliques are streamed through visit_cliques() and printed as they are
+ * found, followed by the maximum size and the total count.
+ * Allows choosing between four different algorithms and provides formatted
  * output showing maximum clique size and all non-trivial cliques (size ≥ 3).
  * 
  * @param graph Pointer to the graph structure
- * @param algorithm_choice 1 for backtracking (all cliques), 2 for Bron-Kerbosch (maximal cliques)
+ * @param algorithm_choice 1 for backtracking (all cliques), 2 for Bron-Kerbosch (maximal cliques),
+ *                         3 for degeneracy-ordered Bron-Kerbosch (maximal cliques, sparse graphs),
+ *                         4 for parallel bitset Bron-Kerbosch (maximal cliques, all cores)
  * 
  * @complexity Depends on chosen algorithm: O(3^(n/3))
  * 
  * @pre graph must be a valid undirected graph
- * @pre algorithm_choice must be 1 or 2
+ * @pre algorithm_choice must be 1, 2, 3 or 4
  * @post Prints clique analysis results to stdout
  * @post All dynamically allocated memory is freed
  * 
@@ -11,11 +11,13 @@
  * - Weak connectivity: Connected when edges are treated as undirected
  * - One-sided connectivity: For any pair of vertices, at least one can reach the other
  * 
- * The implementation uses BFS (Breadth-First Search) traversal to determine
- * reachability between vertices.
+ * Strong and one-sided connectivity come from the strongly connected
+ * components (iterative Tarjan): a digraph is strongly connected iff it has
+ * one SCC, and one-sided (unilateral) iff its condensation DAG has a
+ * Hamiltonian path. Weak and undirected connectivity use BFS.
  * 
  * Time Complexity: O(V + E) where V is vertices and E is edges
- * Space Complexity: O(V) for the visited array and queue
+ * Space Complexity: O(V) for the DFS / BFS state
  */
 
 #ifndef CONNECTIVITY_H
@@ -23,33 +25,87 @@
 
 #include "structs.h"
 
+/**
+ * @struct SCCDecomposition
+ * @brief Strongly connected components of a digraph
+ * 
+ * Component ids follow a topological order of the condensation DAG: every
+ * arc u → v between different components has component[u] < component[v].
+ */
+typedef struct {
+    int count;       // Number of strongly connected components
+    int *component;  // component[v] in [0, count)
+    int *sizes;      // sizes[c] = number of vertices in component c
+} SCCDecomposition;
+
+/**
+ * @brief Computes the strongly connected components of a CSR graph
+ * 
+ * Tarjan's algorithm with an explicit call stack of (vertex, next arc)
+ * frames, so deep graphs cannot overflow the C stack.
+ * 
+ * @param csr CSR graph (undirected graphs give their connected components)
+ * @return New decomposition (free with scc_free()), or NULL on allocation failure
+ * 
+ * @complexity O(V + E) time, O(V) extra space
+ */
+SCCDecomposition *scc_compute_csr(const CSRGraph *csr);
+
+/**
+ * @brief Computes the strongly connected components of a graph (via its CSR view)
+ * 
+ * @see scc_compute_csr()
+ */
+SCCDecomposition *scc_compute(Graph *graph);
+
+/**
+ * @brief Frees a decomposition (NULL is allowed)
+ */
+void scc_free(SCCDecomposition *scc);
+
+/**
+ * @brief Tests whether the condensation DAG has a Hamiltonian path
+ * 
+ * Holds iff the digraph is unilaterally (one-sided) connected. A DAG has a
+ * Hamiltonian path iff its topological order is unique, which is checked by
+ * looking for an arc between every consecutive pair of component ids.
+ * 
+ * @param csr Graph the decomposition was computed from
+ * @param scc Its strongly connected components
+ * @return true if the components can be ordered along a single path
+ * 
+ * @complexity O(V + E)
+ */
+bool scc_condensation_has_hamiltonian_path(const CSRGraph *csr, const SCCDecomposition *scc);
+
 /**
  * @brief Analyzes connectivity properties of a graph
  * 
  * This function performs comprehensive connectivity analysis based on the graph type:
  * 
  * For undirected graphs:
- * - Performs BFS from vertex 0 to check if all vertices are reachable
- * - Sets is_connected to true if the graph is connected
+ * - Labels the connected components with union-find (components.h)
+ * - Sets is_connected to true if there is exactly one component
  * 
  * For directed graphs:
- * - Strong connectivity: BFS following directed edges to check if all vertices
- *   are reachable from vertex 0
- * - Weak connectivity: BFS treating all edges as bidirectional
- * - One-sided connectivity: Checks if for every pair of vertices, at least
- *   one can reach the other (currently simplified implementation)
+ * - Strong connectivity: the graph has a single strongly connected component
+ * - Weak connectivity: a single component when arcs are treated as edges
+ * - One-sided connectivity: for every pair of vertices at least one reaches
+ *   the other, i.e. the condensation DAG has a Hamiltonian path
  * 
  * @param graph Pointer to the Graph structure to analyze
  * @return Connectivity structure containing analysis results
  * 
- * @complexity O(V + E) where V is number of vertices, E is number of edges
+ * @complexity O(V + E · α(V)) where V is number of vertices, E is number of edges
  * 
  * @pre graph must be a valid Graph pointer with initialized adjacency matrix
- * @pre graph->node_count must be positive
+ * @pre graph->node_count must be non-negative
  * @post Returns connectivity analysis without modifying the input graph
  * 
- * @note For directed graphs, the function assumes vertex 0 exists for analysis
  * @note Empty graphs (node_count = 0) are considered connected
+ * @note scc_count is filled in for directed graphs
+ * @note component_count / largest_component describe the (weakly) connected
+ *       components; use components_compute() for the full labelling
  */
 Connectivity check_connectivity(Graph *graph);
 
@@ -15,8 +15,9 @@
  * - κ(G) = n-1: Complete graph Kn
  * 
  * The module provides two approaches:
- * 1. Exact algorithm (brute force): O(2^n × (V+E)) - for small graphs (n ≤ 12)
- * 2. Approximation algorithm: O(V²) - uses minimum degree as upper bound
+ * 1. Exact algorithm (max-flow): Even's algorithm on the vertex-split network,
+ *    n - δ - 1 + δ(δ - 1) / 2 unit-capacity Dinic flows - used for all graph sizes
+ * 2. Exact algorithm (brute force): O(2^n × (V+E)) - reference for small graphs
  * 
  * Properties:
  * - κ(G) ≤ λ(G) ≤ δ(G) (vertex connectivity ≤ edge connectivity ≤ minimum degree)
@@ -27,14 +28,25 @@
 #define CONNECTIVITY_NUMBER_H
 
 #include "structs.h"
+#include "search_budget.h"
+
+/**
+ * @struct VertexCutResult
+ * @brief Result of find_min_vertex_cut_bruteforce_budget()
+ */
+typedef struct {
+    SearchStatus status; /**< SEARCH_COMPLETE if size is κ(G) */
+    int size;            /**< Smallest cut found, an upper bound on κ(G); n - 1 if
+                              none exists, -1 if scratch memory cannot be allocated */
+    int lower_bound;     /**< Proven κ(G) ≥ lower_bound: no smaller set disconnects G */
+    int *cut;            /**< size vertices (caller frees), NULL when no cut exists */
+} VertexCutResult;
 
 /**
  * @brief Calculates the vertex connectivity number of a graph
  * 
- * Main function that determines the vertex connectivity by choosing the
- * appropriate algorithm based on graph size:
- * - Small graphs (n ≤ 12): Uses exact brute force algorithm
- * - Large graphs (n > 12): Uses approximation based on minimum degree
+ * Main function that determines the vertex connectivity exactly using the
+ * max-flow algorithm (find_min_vertex_cut_maxflow) for every graph size.
  * 
  * For directed graphs, the function treats them as undirected for analysis
  * since directed vertex connectivity is more complex and less commonly needed.
@@ -42,14 +54,13 @@
  * @param graph Pointer to the input graph
  * @return Vertex connectivity number (minimum vertices to disconnect graph)
  * 
- * @complexity O(2^n × (V+E)) for exact, O(V²) for approximation
+ * @complexity n - δ - 1 + δ(δ - 1) / 2 max-flow computations
  * 
  * @pre graph must be a valid graph structure
  * @post Returns connectivity number without modifying graph
  * 
- * @note Returns 0 for NULL graphs or trivial cases
+ * @note Returns 0 for NULL graphs or trivial cases, -1 on allocation failure
  * @note Prints warning for directed graphs (treated as undirected)
- * @note Prints note when using approximation for large graphs
  */
 int calculate_connectivity_number(Graph *graph);
 
@@ -57,7 +68,7 @@ int calculate_connectivity_number(Graph *graph);
  * @brief Checks if graph remains connected after removing specified vertices
  * 
  * Helper function that determines if a graph stays connected after removing
- * a given set of vertices. Uses DFS to check if all remaining vertices
+ * a given set of vertices. Uses BFS to check if all remaining vertices
  * are reachable from each other.
  * 
  * @param graph Pointer to the graph structure
@@ -73,7 +84,7 @@ int calculate_connectivity_number(Graph *graph);
  * @post Returns connectivity status without modifying original graph
  * 
  * @note Returns true for graphs with ≤1 remaining vertex
- * @note Uses DFS from first non-removed vertex
+ * @note Uses the shared BFS kernel (bfs.h) from the first non-removed vertex
  * @note Efficiently handles the case where all vertices are removed
  */
 bool is_connected_after_removal(Graph *graph, int *removed_vertices, int removed_count);
@@ -103,35 +114,77 @@ bool is_connected_after_removal(Graph *graph, int *removed_vertices, int removed
  * @post If cut_vertices_out is not NULL, it's allocated and filled with cut vertices
  * @post Caller must free cut_vertices_out if it's allocated
  * 
- * @warning Only suitable for small graphs (n ≤ 12) due to exponential complexity
+ * @warning Only suitable for small graphs (n ≤ 20) due to exponential complexity
  * @note Returns exact vertex connectivity
- * @note More thorough but much slower than approximation methods
+ * @note Much slower than find_min_vertex_cut_maxflow(); kept as a reference
  */
 int find_min_vertex_cut_bruteforce(Graph *graph, int **cut_vertices_out);
 
 /**
- * @brief Approximation algorithm using minimum degree bound
+ * @brief Brute-force minimum vertex cut with each subset size tested in parallel
+ * 
+ * Same result as find_min_vertex_cut_bruteforce() (the lexicographically
+ * first minimum cut). The k-subsets are split by their first two elements
+ * into tasks on a work-stealing pool; removed vertices are kept in a
+ * per-thread bitmask that is updated incrementally between subsets, and the
+ * connectivity test is a BFS (bfs.h) over a reused workspace. Once a
+ * task finds a cut, all tasks holding lexicographically later subsets stop.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param num_threads Number of worker threads (≤ 0 for all online processors)
+ * @param cut_vertices_out Pointer to store cut vertices (optional, can be NULL)
+ * @return Minimum number of vertices needed to disconnect the graph, or -1
+ *         if scratch memory cannot be allocated
+ * 
+ * @complexity O(2^n × (V+E) / threads)
+ * 
+ * @note Sizes with fewer than CONNECTIVITY_PARALLEL_MIN_SUBSETS subsets run on
+ *       the calling thread only
+ */
+int find_min_vertex_cut_bruteforce_parallel(Graph *graph, int num_threads, int **cut_vertices_out);
+
+/**
+ * @brief Parallel brute-force minimum vertex cut under a time / node budget
  * 
- * Fast approximation that uses the theoretical bound κ(G) ≤ δ(G) where
- * δ(G) is the minimum degree. For many practical graphs, this bound is tight
- * (κ(G) = δ(G)), making it a reasonable approximation.
+ * Each tested subset is one budget node. Runs to the end exactly like
+ * find_min_vertex_cut_bruteforce_parallel(); when the budget runs out
+ * while sets of size k are tested, every smaller size is exhausted, so
+ * κ(G) ≥ k, and the neighborhood of a minimum-degree vertex (size δ) is
+ * returned as the incumbent cut.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param num_threads Number of worker threads (≤ 0 for all online processors)
+ * @param budget Search budget (see search_budget.h), NULL for no limit
+ * @return Best cut, the proven lower bound and the status; status is
+ *         SEARCH_COMPLETE whenever the cut is known to be minimum
+ * 
+ * @post Caller must free result.cut
+ */
+VertexCutResult find_min_vertex_cut_bruteforce_budget(Graph *graph, int num_threads, SearchBudget *budget);
+
+/**
+ * @brief Exact vertex connectivity with vertex-split unit-capacity max-flow
  * 
- * The algorithm simply finds the vertex with minimum degree and returns
- * that degree as the approximate vertex connectivity.
+ * Even's algorithm: every vertex v is split into v_in → v_out with capacity
+ * 1, so a maximum s_out–t_in flow equals the local vertex connectivity
+ * κ(s, t) and its residual cut is a vertex cut. Starting from the bound
+ * δ(G), a minimum-degree vertex v is paired with every vertex not adjacent
+ * to it, and then every non-adjacent pair of neighbors of v is tried
+ * (Esfahanian-Hakimi); each Dinic flow is capped at the best value so far.
  * 
  * @param graph Pointer to the graph structure  
- * @param cut_vertices_out Pointer to store minimum degree vertex (optional)
- * @return Approximate vertex connectivity (minimum degree)
+ * @param cut_vertices_out Pointer to store the minimum vertex cut (optional)
+ * @return Exact vertex connectivity κ(G), or -1 (with a NULL cut) if the CSR
+ *         view, the flow network or the scratch arrays cannot be allocated
  * 
- * @complexity O(V²) to compute all degrees
+ * @complexity n - δ - 1 + δ(δ - 1) / 2 flows of O(κ · (V + E)) each; O(V + E) memory
  * 
  * @pre graph must be a valid graph structure
- * @post If cut_vertices_out is not NULL, contains minimum degree vertex
- * @post Result is an upper bound on actual vertex connectivity
+ * @post If cut_vertices_out is not NULL, it holds κ cut vertices (caller must free),
+ *       or NULL when no cut exists (complete or disconnected graph)
  * 
- * @note Fast algorithm suitable for large graphs
- * @note May overestimate vertex connectivity, but provides reasonable approximation
- * @note Exact for many graph classes (regular graphs, complete graphs, etc.)
+ * @note Directed graphs are treated as undirected
+ * @note Complete graphs K_n return n - 1
  */
 int find_min_vertex_cut_maxflow(Graph *graph, int **cut_vertices_out);
 
@@ -151,11 +204,10 @@ int find_min_vertex_cut_maxflow(Graph *graph, int **cut_vertices_out);
  * - Degree statistics (min, max, average)
  * - Connectivity classification (disconnected, 1-connected, 2-connected, etc.)
  * - Special cases identification (complete graphs, trees, etc.)
- * - Algorithm selection rationale
  * 
  * @param graph Pointer to the graph structure
  * 
- * @complexity Depends on graph size: O(2^n × (V+E)) for small, O(V²) for large
+ * @complexity n - δ - 1 + δ(δ - 1) / 2 max-flow computations
  * 
  * @pre graph must be a valid graph structure
  * @post Prints comprehensive analysis to stdout
@@ -0,0 +1,136 @@
+/**
+ * @file csr_graph.h
+ * @brief Compressed sparse row (CSR) graph storage
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * This module provides a CSR backend that lives alongside the int** adjacency
+ * matrix of the Graph structure. The CSR arrays store only real edges, so
+ * memory is O(V + E) and neighbor iteration costs O(deg(u)) instead of O(V).
+ *
+ * Layout:
+ * - offsets[u] .. offsets[u + 1] - 1 index the neighbors of u in neighbors[]
+ * - Neighbor lists are sorted in ascending order
+ * - Directed graphs additionally carry a reverse CSR (in_offsets / in_neighbors)
+ *
+ * Traversal-based modules (connectivity, connectivity number, bipartite
+ * detection, Euler paths) obtain the CSR through graph_ensure_csr(), which
+ * builds it from the matrix on first use and caches it in graph->csr.
+ *
+ * Time Complexity: O(V + E) to build from an edge list, O(V²) from a matrix
+ * Space Complexity: O(V + E)
+ */
+
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "structs.h"
+
+/**
+ * @brief Builds a CSR graph from an edge list
+ *
+ * Uses two stable counting-sort passes (by target, then by source) so that
+ * every neighbor list comes out sorted without any comparison sort.
+ *
+ * @param node_count Number of vertices
+ * @param edges Array of edges (u, v); for directed graphs u → v
+ * @param edge_count Number of edges in the array
+ * @param is_directed If true, builds forward and reverse CSR; otherwise stores both directions
+ * @return Newly allocated CSRGraph, or NULL on allocation failure
+ *
+ * @complexity O(V + E)
+ *
+ * @pre All edge endpoints must be in [0, node_count)
+ * @pre The edge list must not contain duplicates or self-loops
+ * @post Caller must free the result with csr_destroy()
+ */
+CSRGraph *csr_create_from_edges(int node_count, const Edge *edges, int edge_count, bool is_directed);
+
+/**
+ * @brief Builds a CSR graph from the adjacency matrix of a graph
+ *
+ * @param graph Graph with a valid adjacency matrix
+ * @return Newly allocated CSRGraph, or NULL on error
+ *
+ * @complexity O(V²) for the matrix scan
+ *
+ * @post Caller must free the result with csr_destroy()
+ */
+CSRGraph *csr_create_from_adjacency(Graph *graph);
+
+/**
+ * @brief Frees all memory owned by a CSR graph
+ *
+ * File-backed graphs from graph_file_map() are unmapped instead.
+ *
+ * @param csr CSR graph to free (NULL is allowed)
+ */
+void csr_destroy(CSRGraph *csr);
+
+/**
+ * @brief Returns the CSR view of a graph, building and caching it if needed
+ *
+ * @param graph Graph to inspect
+ * @return graph->csr (never NULL for a valid graph unless allocation fails)
+ *
+ * @complexity O(1) when cached, O(V²) on first call for matrix-only graphs
+ *
+ * @post graph->csr is owned by the graph and freed by graph_free_storage()
+ */
+CSRGraph *graph_ensure_csr(Graph *graph);
+
+/**
+ * @brief Builds the adjacency matrix of a CSR-only graph if it is missing
+ *
+ * The inverse of graph_ensure_csr(): graphs that were loaded or generated
+ * straight into CSR form (graph_io.h, line_graph_build()) call this before
+ * running the matrix-based modules (cliques, independent sets, vertex covers).
+ *
+ * @param graph Graph with a matrix or a CSR view
+ * @return true if graph->adjacency is available; false on allocation failure
+ *         (the graph is left unchanged)
+ *
+ * @complexity O(1) when present, O(V² + E) to build
+ *
+ * @post graph->adjacency is owned by the graph and freed by graph_free_storage()
+ */
+bool graph_ensure_adjacency(Graph *graph);
+
+/**
+ * @brief Frees the adjacency matrix and CSR view owned by a graph
+ *
+ * Does not free the Graph structure itself, so it works for both stack
+ * and heap allocated graphs.
+ *
+ * @param graph Graph whose storage should be released
+ *
+ * @post graph->adjacency and graph->csr are NULL
+ */
+void graph_free_storage(Graph *graph);
+
+/**
+ * @brief Out-degree (or degree for undirected graphs) of vertex u
+ */
+static inline int csr_degree(const CSRGraph *csr, int u)
+{
+    return csr->offsets[u + 1] - csr->offsets[u];
+}
+
+/**
+ * @brief In-degree of vertex u (equals csr_degree() for undirected graphs)
+ */
+static inline int csr_in_degree(const CSRGraph *csr, int u)
+{
+    if (!csr->is_directed)
+        return csr_degree(csr, u);
+    return csr->in_offsets[u + 1] - csr->in_offsets[u];
+}
+
+/**
+ * @brief Checks for edge u → v using binary search on the sorted row of u
+ *
+ * @complexity O(log deg(u))
+ */
+bool csr_has_edge(const CSRGraph *csr, int u, int v);
+
+#endif
@@ -0,0 +1,243 @@
+/**
+ * @file dynamic_graph.h
+ * @brief Graph with edge / vertex updates and cached analysis results
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Keeps a graph that changes through small updates between queries, so
+ * the queries do not start from scratch after every update:
+ *
+ * - Neighbor lists per vertex are the source of truth; an adjacency matrix
+ *   (only if the caller built one with graph_ensure_adjacency() on the
+ *   view) is patched in O(1) per update, and the CSR view is rebuilt from
+ *   the lists in O(V + E) only when a query needs it
+ * - Degrees, the number of odd-degree vertices (undirected) and the in /
+ *   out balance counts (directed) are updated per edge, so Euler
+ *   feasibility is answered in O(1)
+ * - A union-find with parity bits tracks the (weakly) connected
+ *   components and, for undirected graphs, a 2-coloring: an insertion is
+ *   a union, and an edge closing an odd cycle marks the graph
+ *   non-bipartite
+ * - A deletion runs two interleaved BFS probes from the endpoints: if they
+ *   meet, the components (and a bipartite 2-coloring) are unchanged; if
+ *   one side runs dry, it is a whole component now, and its vertices move
+ *   to fresh union-find nodes; only if the probe exceeds
+ *   DYNAMIC_GRAPH_PROBE_LIMIT vertices is the union-find rebuilt from the
+ *   lists, O(V + E), on the next component query
+ * - Expensive results (Euler path, maximum clique, maximum independent
+ *   set, vertex connectivity) are cached and dropped only by updates that
+ *   can change them: an independent set stays maximum when an edge is
+ *   added that does not join two of its vertices, and a clique stays
+ *   maximum when an edge is removed outside it
+ *
+ * Time Complexity: O(1) per insertion plus a union-find step, O(deg) to
+ *                  find an edge in the lists, O(probe) per deletion
+ * Space Complexity: O(V + E), plus O(V²) while a matrix is kept
+ */
+
+#ifndef DYNAMIC_GRAPH_H
+#define DYNAMIC_GRAPH_H
+
+#include "structs.h"
+#include "euler_path.h"
+
+/** Vertices a deletion may visit to prove its endpoints are still connected */
+#define DYNAMIC_GRAPH_PROBE_LIMIT 4096
+
+/**
+ * @struct DynamicGraph
+ * @brief Mutable graph state; update it only through the functions below
+ */
+typedef struct {
+    Graph graph;             // View: matrix patched in place, csr dropped by updates
+    int capacity;            // Vertex slots of the per-vertex arrays
+    int edge_count;
+    unsigned long long version; // Bumped by every successful update
+    int **out;               // Neighbor lists (out-neighbors for digraphs)
+    int *out_len;
+    int *out_cap;
+    int **in;                // Digraphs: in-neighbor lists, NULL otherwise
+    int *in_len;
+    int *in_cap;
+
+    /* Incrementally maintained */
+    int odd_vertices;        // Undirected: vertices of odd degree
+    int surplus_vertices;    // Directed: out - in = 1
+    int deficit_vertices;    // Directed: in - out = 1
+    int skewed_vertices;     // Directed: |out - in| > 1
+    int isolated_vertices;   // No incident edge
+    int *slot;               // Union-find node of each vertex
+    int slot_count;          // Nodes in use; split-off vertices get new ones
+    int *parent;             // Union-find forest over the (weak) components
+    int *rank;
+    unsigned char *parity;   // Parity of the path to the parent (2-coloring)
+    int components;
+    bool components_valid;   // false after a split (or an unproven deletion)
+    bool bipartite;          // Undirected: parity bits form a proper 2-coloring
+    bool bipartite_valid;    // false after a deletion from a non-bipartite graph
+    int *probe_mark;         // Deletion probe: stamp of the side that reached a vertex
+    int *probe_queue;
+    int probe_stamp;
+
+    /* Cached results, valid until an update can change them */
+    bool euler_valid;
+    EulerStatus euler_status;
+    int *euler_path;
+    int euler_length;
+    Set *clique;             // NULL while not cached
+    bool *in_clique;
+    Set *independent_set;
+    bool *in_independent_set;
+    bool kappa_valid;
+    int kappa;
+    int *kappa_cut;
+} DynamicGraph;
+
+/**
+ * @brief Creates a graph with node_count isolated vertices
+ *
+ * @param node_count Number of vertices
+ * @param is_directed Whether edges are arcs
+ * @param allow_bidirectional Digraphs: whether u → v and v → u may coexist
+ * @return New graph, or NULL on allocation failure
+ */
+DynamicGraph *dynamic_graph_create(int node_count, bool is_directed, bool allow_bidirectional);
+
+/**
+ * @brief Creates a dynamic copy of an existing graph
+ *
+ * @param graph Graph with an adjacency matrix or a CSR view (not modified
+ *              apart from building its CSR view)
+ * @return New graph, or NULL on allocation failure
+ *
+ * @complexity O(V + E) once graph has a CSR view
+ */
+DynamicGraph *dynamic_graph_from_graph(Graph *graph);
+
+/**
+ * @brief Frees the graph, its caches and its Graph view
+ */
+void dynamic_graph_destroy(DynamicGraph *dg);
+
+/**
+ * @brief Inserts edge {u, v} (arc u → v for digraphs)
+ *
+ * @return false if an endpoint is out of range, u == v, the edge exists,
+ *         the digraph forbids the reverse arc, or an allocation failed
+ *
+ * @complexity O(deg(u) + deg(v)) to reject duplicates (O(1) with a matrix)
+ */
+bool dynamic_graph_add_edge(DynamicGraph *dg, int u, int v);
+
+/**
+ * @brief Deletes edge {u, v} (arc u → v for digraphs)
+ *
+ * @return false if the edge does not exist
+ *
+ * @complexity O(deg(u) + deg(v)) plus a probe of up to DYNAMIC_GRAPH_PROBE_LIMIT vertices
+ */
+bool dynamic_graph_remove_edge(DynamicGraph *dg, int u, int v);
+
+/**
+ * @brief Appends an isolated vertex
+ *
+ * @return Index of the new vertex, or -1 on allocation failure
+ *
+ * @complexity Amortized O(1), plus O(V) while an adjacency matrix is kept
+ */
+int dynamic_graph_add_vertex(DynamicGraph *dg);
+
+/**
+ * @brief Whether edge {u, v} (arc u → v) exists
+ */
+bool dynamic_graph_has_edge(const DynamicGraph *dg, int u, int v);
+
+/**
+ * @brief Degree (out-degree for digraphs) of v
+ */
+int dynamic_graph_degree(const DynamicGraph *dg, int v);
+
+/**
+ * @brief In-degree of v (equals dynamic_graph_degree() for undirected graphs)
+ */
+int dynamic_graph_in_degree(const DynamicGraph *dg, int v);
+
+/**
+ * @brief Number of (weakly) connected components, isolated vertices included
+ *
+ * @complexity O(1) while the union-find is valid, O(V + E) after a split
+ */
+int dynamic_graph_component_count(DynamicGraph *dg);
+
+/**
+ * @brief Whether u and v lie in the same (weakly) connected component
+ *
+ * @complexity O(α(V)) while the union-find is valid
+ */
+bool dynamic_graph_same_component(DynamicGraph *dg, int u, int v);
+
+/**
+ * @brief Whether an undirected graph is bipartite (false for digraphs)
+ *
+ * @complexity O(1) while the union-find is valid, O(V + E) after a rebuild
+ */
+bool dynamic_graph_is_bipartite(DynamicGraph *dg);
+
+/**
+ * @brief Euler feasibility from the maintained degree counts and components
+ *
+ * Same status as euler_path_csr() would return, without building the path.
+ *
+ * @complexity O(1) while the union-find is valid
+ */
+EulerStatus dynamic_graph_euler_status(DynamicGraph *dg);
+
+/**
+ * @brief Graph view of the current edges for the other modules
+ *
+ * Rebuilds the CSR view if an update made it stale. The view stays owned
+ * by dg and is valid until the next update.
+ *
+ * @return The view, or NULL on allocation failure
+ *
+ * @complexity O(1) when current, O(V + E) to rebuild the CSR
+ */
+Graph *dynamic_graph_view(DynamicGraph *dg);
+
+/**
+ * @brief Euler path / circuit of the current graph (cached)
+ *
+ * @param path_out Receives the vertex sequence (owned by dg, valid until
+ *                 the next update), NULL unless a path exists
+ * @param length_out Receives the number of vertices in the sequence
+ * @return Status as for euler_path_csr()
+ */
+EulerStatus dynamic_graph_euler_path(DynamicGraph *dg, const int **path_out, int *length_out);
+
+/**
+ * @brief One maximum clique (cached; survives removals of edges outside it)
+ *
+ * @return Clique owned by dg, or NULL for digraphs, graphs without
+ *         vertices and on allocation failure
+ */
+const Set *dynamic_graph_maximum_clique(DynamicGraph *dg);
+
+/**
+ * @brief One maximum independent set (cached; survives insertions of edges
+ *        that do not join two of its vertices)
+ *
+ * @return Set owned by dg, or NULL for digraphs, graphs without vertices
+ *         and on allocation failure
+ */
+const Set *dynamic_graph_independent_set(DynamicGraph *dg);
+
+/**
+ * @brief Vertex connectivity κ(G) and a minimum cut (cached)
+ *
+ * @param cut_out Receives the κ cut vertices (owned by dg), or NULL when no
+ *                cut exists; may be NULL
+ * @return κ(G) as for find_min_vertex_cut_maxflow(), or -1 on allocation failure
+ */
+int dynamic_graph_connectivity_number(DynamicGraph *dg, const int **cut_out);
+
+#endif
@@ -4,21 +4,24 @@
  * @author Graph Theory Project Team
  * @date 2024
  * 
- * This module implements Eulerian path and cycle detection for undirected graphs.
- * An Eulerian path visits every edge exactly once, while an Eulerian cycle
- * is an Eulerian path that starts and ends at the same vertex.
+ * This module implements Eulerian path and cycle detection for undirected and
+ * directed graphs. An Eulerian path visits every edge exactly once, while an
+ * Eulerian cycle is an Eulerian path that starts and ends at the same vertex.
  * 
  * Theoretical background:
  * - Eulerian cycle exists iff all vertices have even degree and graph is connected
  * - Eulerian path exists iff exactly 0 or 2 vertices have odd degree and graph is connected
  * - If 0 vertices have odd degree → Eulerian cycle exists
  * - If 2 vertices have odd degree → Eulerian path exists (between the two odd-degree vertices)
+ * - Directed: a circuit exists iff in(v) = out(v) for all v and the non-isolated
+ *   vertices are weakly connected; a path exists iff, in addition, exactly one
+ *   vertex has out - in = 1 (the start) and one has in - out = 1 (the end)
  * 
  * The implementation uses Hierholzer's algorithm, which efficiently constructs
  * the Eulerian path/cycle by building a path and extending it when stuck.
  * 
- * Time Complexity: O(E) where E is the number of edges
- * Space Complexity: O(E) for storing the path and stack
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V + E) for edge ids, cursors, the path and the stack
  */
 
 #ifndef EULER_PATH_H
@@ -27,15 +30,30 @@
 #include "structs.h"
 #include <stdbool.h>
 
+/**
+ * @brief Outcome of an Euler path search
+ */
+typedef enum {
+    EULER_CYCLE,        /**< Closed walk using every edge (all degrees even) */
+    EULER_PATH,         /**< Open walk between the two odd-degree vertices */
+    EULER_NO_EDGES,     /**< Graph has no edges; the path is empty */
+    EULER_ODD_DEGREES,  /**< Undirected: more than two vertices have odd degree */
+    EULER_UNBALANCED,   /**< Directed: in/out degrees allow neither a circuit nor a path */
+    EULER_DISCONNECTED, /**< Edges lie in more than one (weak) component */
+    EULER_NO_MEMORY     /**< Scratch allocation failed */
+} EulerStatus;
+
 /**
  * @brief Checks connectivity of vertices with non-zero degree
  * 
  * Verifies that all vertices with degree > 0 are connected, which is
- * a necessary condition for Eulerian paths/cycles. Uses DFS to check
- * if all non-isolated vertices are reachable from each other.
+ * a necessary condition for Eulerian paths/cycles. Runs the shared BFS
+ * kernel (bfs.h) to check if all non-isolated vertices are reachable from
+ * each other; arcs of a digraph are followed in both directions (weak
+ * connectivity).
  * 
  * @param graph Pointer to the graph structure
- * @param degrees Array containing degree of each vertex
+ * @param degrees Array containing degree of each vertex (in + out for digraphs)
  * @return true if all non-zero degree vertices are connected, false otherwise
  * 
  * @complexity O(V + E) where V is vertices and E is edges
@@ -45,7 +63,7 @@
  * @post Returns connectivity status without modifying input
  * 
  * @note Ignores isolated vertices (degree 0) in connectivity check
- * @note Uses DFS traversal starting from first non-zero degree vertex
+ * @note Traversal starts from the first non-zero degree vertex
  */
 bool is_connected_for_euler(Graph *graph, int *degrees);
 
@@ -53,13 +71,13 @@ bool is_connected_for_euler(Graph *graph, int *degrees);
  * @brief Counts the degree (number of adjacent vertices) of a vertex
  * 
  * Simple utility function that counts the number of edges incident to
- * a given vertex by examining the adjacency matrix row.
+ * a given vertex from its CSR row length.
  * 
  * @param graph Pointer to the graph structure
  * @param u Vertex index to count adjacencies for
  * @return Number of vertices adjacent to vertex u
  * 
- * @complexity O(V) where V is the number of vertices
+ * @complexity O(1) once the CSR view is cached
  * 
  * @pre graph must have valid adjacency matrix
  * @pre u must be a valid vertex index (0 ≤ u < node_count)
@@ -70,6 +88,46 @@ bool is_connected_for_euler(Graph *graph, int *degrees);
  */
 int count_adj(Graph *graph, int u);
 
+/**
+ * @brief Finds an Eulerian path or cycle of a CSR graph (undirected or directed)
+ * 
+ * Linear-time Hierholzer: both CSR slots of an edge share one edge id, a
+ * bitmap marks used edges and a per-vertex cursor skips slots already
+ * inspected. The walk starts at the first odd-degree vertex (or the first
+ * vertex with an edge when all degrees are even) and always takes the
+ * smallest unused neighbor. Connectivity needs no separate pass: the walk
+ * covers every edge exactly when the edges are connected.
+ * 
+ * Digraphs use the same walk over out-rows, with the CSR slot as edge id.
+ * The start is the vertex with out - in = 1 if there is one, otherwise the
+ * first vertex with an out-arc; the walk then covers every arc exactly when
+ * the non-isolated vertices are weakly connected.
+ * 
+ * Works directly on a CSR graph, so edge lists built with
+ * csr_create_from_edges() never need an adjacency matrix.
+ * 
+ * @param csr CSR graph without self-loops
+ * @param path_out Receives the vertex sequence, start first (caller must free);
+ *                 NULL unless the status is EULER_PATH or EULER_CYCLE
+ * @param length_out Receives the number of vertices in the path (edges + 1)
+ * @return EULER_PATH or EULER_CYCLE on success, otherwise the reason no walk exists
+ * 
+ * @complexity O(V + E) time, 4E + V words (including the path) plus E bits
+ */
+EulerStatus euler_path_csr(const CSRGraph *csr, int **path_out, int *length_out);
+
+/**
+ * @brief Finds an Eulerian path or cycle of a graph (via its CSR view)
+ * 
+ * @param graph Pointer to the graph structure
+ * @param path_out Receives the vertex sequence (caller must free), or NULL
+ * @param length_out Receives the number of vertices in the path
+ * @return Status as for euler_path_csr()
+ * 
+ * @see euler_path_csr()
+ */
+EulerStatus euler_path_compute(Graph *graph, int **path_out, int *length_out);
+
 /**
  * @brief Finds and prints Eulerian path or cycle using Hierholzer's algorithm
  * 
@@ -80,6 +138,7 @@ int count_adj(Graph *graph, int u);
  *    - All non-zero degree vertices must be connected
  *    - For Eulerian cycle: all vertices have even degree
  *    - For Eulerian path: exactly 0 or 2 vertices have odd degree
+ *    - Directed graphs: in/out balance and weak connectivity instead
  * 
  * 2. Hierholzer's algorithm:
  *    - Start from appropriate vertex (odd degree vertex for path, any vertex for cycle)
@@ -89,20 +148,18 @@ int count_adj(Graph *graph, int u);
  * 
  * 3. Output the complete Eulerian path/cycle
  * 
- * The algorithm maintains a working graph copy and removes edges as they're traversed
- * to avoid revisiting them.
+ * The search itself is euler_path_compute(); this function only reports.
  * 
  * @param original_graph Pointer to the input graph (remains unmodified)
  * 
- * @complexity O(E) where E is the number of edges
+ * @complexity O(V + E)
  * 
- * @pre original_graph must be a valid undirected graph
+ * @pre original_graph must be a valid graph (directed or undirected)
  * @pre original_graph adjacency matrix must be properly initialized
  * @post Prints the Eulerian path/cycle if it exists
  * @post Prints error message if no Eulerian path/cycle exists
  * @post Original graph remains unmodified
  * 
- * @warning Only works for undirected graphs (prints error for directed graphs)
  * @warning Prints results directly to stdout
  * 
  * @note If Eulerian cycle exists, can start from any vertex with non-zero degree
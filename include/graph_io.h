@@ -0,0 +1,119 @@
+/**
+ * @file graph_io.h
+ * @brief Binary CSR graph files and text edge-list parsing
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * A graph is built (or parsed) once, saved in a compact binary CSR file and
+ * then loaded with mmap by later runs: the CSRGraph arrays point straight
+ * into the page cache, so loading costs one validation pass and no copy.
+ *
+ * Binary format (native byte order, all counts little enough for int):
+ *
+ *   offset  size  field
+ *   0       8     magic "GRAPHCSR"
+ *   8       4     version (GRAPH_FILE_VERSION; also detects foreign byte order)
+ *   12      4     flags (GRAPH_FILE_DIRECTED)
+ *   16      8     node_count n
+ *   24      8     arc_count m (entries in the neighbor array)
+ *   32      8     edge_count (m / 2 undirected, m directed)
+ *   40            int32 offsets[n + 1], int32 neighbors[m]
+ *                 directed only: int32 in_offsets[n + 1], int32 in_neighbors[m]
+ *
+ * Text formats:
+ * - Edge lists (SNAP style): one "u v" pair per line, '#' or '%' comment
+ *   lines, extra columns ignored; vertex ids are 0-based and n = max id + 1
+ * - METIS: header "n m [fmt [ncon]]", then one line per vertex listing its
+ *   1-based neighbors (vertex sizes / weights and edge weights are skipped)
+ *
+ * Parsed graphs drop self-loops and duplicate edges.
+ *
+ * Time Complexity: O(V + E) for every operation
+ * Space Complexity: O(V + E)
+ */
+
+#ifndef GRAPH_IO_H
+#define GRAPH_IO_H
+
+#include "structs.h"
+
+/** Current binary format version */
+#define GRAPH_FILE_VERSION 1
+
+/** Header flag: the file holds a directed graph (with its reverse index) */
+#define GRAPH_FILE_DIRECTED 0x1u
+
+/** graph_adopt_csr() builds the adjacency matrix only up to this many vertices */
+#define GRAPH_IO_MATRIX_MAX_NODES 8192
+
+/**
+ * @brief Writes a CSR graph in the binary format
+ *
+ * @param csr Graph to write (rows must be sorted, as csr_graph.c builds them)
+ * @param path Output file path
+ * @return 0 on success, -1 on I/O error
+ *
+ * @complexity O(V + E)
+ */
+int graph_file_write(const CSRGraph *csr, const char *path);
+
+/**
+ * @brief Maps a binary graph file read-only as a CSR graph
+ *
+ * The header, the offsets and every neighbor index are validated, and so is
+ * the structure: undirected rows must be symmetric, the reverse CSR of a
+ * digraph must be the transpose of its rows, and self-loops are refused. A
+ * truncated or corrupted file is rejected instead of causing out-of-range
+ * reads or inconsistent results later.
+ *
+ * @param path Binary graph file
+ * @return CSR graph backed by the mapping (free with csr_destroy()), or NULL
+ *         if the file cannot be mapped or is not a valid graph file
+ *
+ * @complexity O(V + E log Δ) for validation, no copying
+ *
+ * @note The arrays are read-only: writing through them faults
+ */
+CSRGraph *graph_file_map(const char *path);
+
+/**
+ * @brief Parses a SNAP-style text edge list
+ *
+ * @param path Text file with one "u v" pair per line (ids 0 .. INT_MAX - 2)
+ * @param is_directed If false, each pair is an undirected edge
+ * @return New CSR graph (free with csr_destroy()), or NULL on a parse error,
+ *         I/O error or allocation failure
+ *
+ * @complexity O(V + E + file size)
+ */
+CSRGraph *graph_parse_edge_list(const char *path, bool is_directed);
+
+/**
+ * @brief Parses an undirected graph in METIS format
+ *
+ * @param path METIS graph file
+ * @return New CSR graph (free with csr_destroy()), or NULL on a parse error,
+ *         I/O error or allocation failure
+ *
+ * @complexity O(V + E + file size)
+ */
+CSRGraph *graph_parse_metis(const char *path);
+
+/**
+ * @brief Wraps a CSR graph in a Graph, taking ownership of it
+ *
+ * The adjacency matrix used by the clique, independent set, vertex cover
+ * and line graph modules is rebuilt from the CSR when the graph has at most
+ * GRAPH_IO_MATRIX_MAX_NODES vertices; larger graphs get adjacency = NULL and
+ * only support the CSR-based analyses.
+ *
+ * @param graph Graph to initialise
+ * @param csr CSR graph, owned by the graph afterwards
+ * @return true on success; false on allocation failure (csr is destroyed and
+ *         the graph left empty)
+ *
+ * @complexity O(V + E), plus O(V²) when the matrix is built
+ */
+bool graph_adopt_csr(Graph *graph, CSRGraph *csr);
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ * @file graph_stats.h
+ * @brief Optional hot-path counters, phase timers and allocation accounting
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Compiled in only with -DGRAPH_STATS (make STATS=1). Without it the
+ * GRAPH_STAT_* and GRAPH_STATS_TIMER_* macros expand to nothing, their
+ * arguments are not evaluated, and the reporting functions below are empty
+ * stubs, so the default build pays nothing.
+ *
+ * With it:
+ * - Algorithms bump process-wide counters (relaxed atomics, safe from the
+ *   worker threads): Bron-Kerbosch recursion nodes, branches and the
+ *   candidates the pivot rule skipped, branch-and-bound nodes and prunes of
+ *   the maximum clique search, subsets tested by the brute-force vertex cut,
+ *   max-flow runs, MIS branches, and sets created
+ * - Drivers time their phases with GRAPH_STATS_TIMER_START / _STOP;
+ *   phases are aggregated by name (calls and total time)
+ * - The link step wraps malloc, calloc, realloc, aligned_alloc and free
+ *   (GNU ld --wrap), counting calls, requested bytes and the live / peak
+ *   usable bytes. Blocks the C library allocates internally (e.g. getline()
+ *   buffers) are not seen when they are allocated, only when freed
+ *
+ * Counters are cumulative; drivers take a snapshot before and after a piece
+ * of work and report the difference.
+ */
+
+#ifndef GRAPH_STATS_H
+#define GRAPH_STATS_H
+
+#include <stdio.h>
+#include <stdbool.h>
+
+/**
+ * @brief Hot-path counters
+ */
+typedef enum {
+    GRAPH_STAT_BACKTRACK_CALLS,    /**< All-cliques backtracking nodes */
+    GRAPH_STAT_BK_CALLS,           /**< Bron-Kerbosch recursion nodes (every engine) */
+    GRAPH_STAT_BK_BRANCHES,        /**< Candidates P \ N(pivot) expanded */
+    GRAPH_STAT_BK_PIVOT_SKIPS,     /**< Candidates P ∩ N(pivot) skipped by the pivot rule */
+    GRAPH_STAT_MAX_CLIQUE_NODES,   /**< Maximum clique branch-and-bound nodes */
+    GRAPH_STAT_MAX_CLIQUE_PRUNES,  /**< Nodes cut off by the coloring bound */
+    GRAPH_STAT_CUT_SUBSETS,        /**< Vertex subsets tested by the brute-force cut */
+    GRAPH_STAT_CUT_FLOWS,          /**< Max-flow runs of the vertex connectivity */
+    GRAPH_STAT_MIS_BRANCHES,       /**< Branch-and-reduce MIS branches */
+    GRAPH_STAT_SET_CREATES,        /**< Sets from set_create() and set arenas */
+    GRAPH_STAT_SET_BYTES,          /**< Vertex array bytes of those sets */
+    GRAPH_STAT_ALLOCS,             /**< malloc / calloc / realloc / aligned_alloc calls */
+    GRAPH_STAT_ALLOC_BYTES,        /**< Bytes requested by those calls */
+    GRAPH_STAT_FREES,              /**< free() calls with a non-NULL pointer */
+    GRAPH_STAT_COUNT
+} GraphStatCounter;
+
+/**
+ * @struct GraphStatsSnapshot
+ * @brief Copy of the counters and the heap figures at one point in time
+ */
+typedef struct {
+    long long counters[GRAPH_STAT_COUNT];
+    long long live_bytes;  // Usable bytes currently allocated
+    long long peak_bytes;  // Highest live_bytes since the last reset
+} GraphStatsSnapshot;
+
+#ifdef GRAPH_STATS
+
+#include <stdatomic.h>
+
+#define GRAPH_STATS_ENABLED 1
+
+extern _Atomic long long graph_stat_counters[GRAPH_STAT_COUNT];
+
+#define GRAPH_STAT_ADD(counter, n) \
+    ((void)atomic_fetch_add_explicit(&graph_stat_counters[counter], (long long)(n), memory_order_relaxed))
+#define GRAPH_STAT_INC(counter) GRAPH_STAT_ADD(counter, 1)
+
+/** Declares timer and starts it */
+#define GRAPH_STATS_TIMER_START(timer) double timer = graph_stats_now()
+/** Adds the time since GRAPH_STATS_TIMER_START(timer) to the named phase */
+#define GRAPH_STATS_TIMER_STOP(timer, phase) graph_stats_phase_add((phase), graph_stats_now() - (timer))
+
+#else
+
+#define GRAPH_STATS_ENABLED 0
+#define GRAPH_STAT_ADD(counter, n) ((void)0)
+#define GRAPH_STAT_INC(counter) ((void)0)
+#define GRAPH_STATS_TIMER_START(timer) ((void)0)
+#define GRAPH_STATS_TIMER_STOP(timer, phase) ((void)0)
+
+#endif
+
+/** Distinct phase names kept by the timer table; further names are dropped */
+#define GRAPH_STATS_MAX_PHASES 32
+
+/**
+ * @brief Short name of a counter ("bk_calls", ...), as used in reports
+ */
+const char *graph_stats_counter_name(GraphStatCounter counter);
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+double graph_stats_now(void);
+
+/**
+ * @brief Adds one call taking seconds to the named phase
+ *
+ * @param phase Phase name; stored by pointer, so it must be a string literal
+ *              or otherwise outlive the table
+ */
+void graph_stats_phase_add(const char *phase, double seconds);
+
+/**
+ * @brief Zeroes the counters and phases and restarts the peak at the live size
+ */
+void graph_stats_reset(void);
+
+/**
+ * @brief Restarts the peak at the current live size (counters are kept)
+ */
+void graph_stats_reset_peak(void);
+
+/**
+ * @brief Copies the current counters (all zero without GRAPH_STATS)
+ */
+void graph_stats_snapshot(GraphStatsSnapshot *out);
+
+/**
+ * @brief Prints the phase table, the non-zero counters and the heap figures
+ *
+ * Does nothing without GRAPH_STATS.
+ */
+void graph_stats_print(FILE *out);
+
+#endif
@@ -13,8 +13,17 @@
  * 2. Connecting the highest-degree vertex to the next d highest-degree vertices
  * 3. Reducing degrees accordingly and repeating until all degrees are zero
  * 
- * Time Complexity: O(n²) where n is the number of vertices
- * Space Complexity: O(n²) for the adjacency matrix
+ * Directed sequences use its Kleitman-Wang generalization on
+ * (out-degree, in-degree) pairs.
+ * 
+ * The realization engines (havel_hakimi_realize(), kleitman_wang_realize())
+ * only produce an edge list, so they scale to millions of vertices; the
+ * Graph builders add the adjacency matrix and the CSR view on top (DOT
+ * output is written separately, see dot_writer.h).
+ * 
+ * Time Complexity: O(n + E) undirected, O((n + E) log n) directed, plus
+ *                  O(n²) for the adjacency matrix of the Graph builders
+ * Space Complexity: O(n + E) for the engines, O(n²) for the adjacency matrix
  */
 
 #ifndef HAVEL_HAKIMI_H
@@ -51,59 +60,150 @@ int compare_nodes(const void *a, const void *b);
  */
 int compare_nodes_in_degree(const void *a, const void *b);
 
+/**
+ * @brief Tests whether a degree sequence is graphical (Erdős-Gallai)
+ * 
+ * The sequence is counting-sorted in descending order and every Erdős-Gallai
+ * inequality Σ_{i≤k} d_i ≤ k(k-1) + Σ_{i>k} min(d_i, k) is evaluated with
+ * prefix sums and a moving pointer, so nothing is built.
+ * 
+ * @param degrees degrees[v] = required degree of vertex v
+ * @param n Number of vertices
+ * @return true if some simple graph has exactly these degrees
+ * 
+ * @complexity O(n)
+ * 
+ * @note Also rejects negative degrees and degrees ≥ n
+ * @note Returns true on allocation failure, leaving the decision to construction
+ */
+bool is_graphical_sequence(const int *degrees, int n);
+
+/**
+ * @brief Tests whether (out-degree, in-degree) pairs are digraphical (Fulkerson-Chen-Anstee)
+ * 
+ * Pairs are put in lexicographically decreasing order with two counting
+ * sorts, then every inequality
+ * Σ_{i≤k} a_i ≤ Σ_{i≤k} min(b_i, k-1) + Σ_{i>k} min(b_i, k)
+ * is evaluated incrementally.
+ * 
+ * @param out_degrees out_degrees[v] = required out-degree of v
+ * @param in_degrees in_degrees[v] = required in-degree of v
+ * @param n Number of vertices
+ * @return true if some digraph without loops or parallel arcs (2-cycles
+ *         allowed) has exactly these degrees
+ * 
+ * @complexity O(n)
+ * 
+ * @note Returns true on allocation failure, leaving the decision to construction
+ */
+bool is_digraphical_sequence(const int *out_degrees, const int *in_degrees, int n);
+
+/**
+ * @brief Realizes an undirected degree sequence as an edge list (Havel-Hakimi)
+ * 
+ * Vertices live in degree buckets: one array ordered by decreasing residual
+ * degree plus the end index of every degree block. Connecting the vertex of
+ * largest degree d to the next d vertices moves each of them to the end of
+ * its block and shrinks the block, an O(1) swap per edge, so no sorting
+ * happens after the initial counting sort.
+ * 
+ * @param degrees degrees[v] = required degree of vertex v
+ * @param n Number of vertices
+ * @param edges_out Receives the edges (u, v), or NULL if none / on failure
+ * @param edge_count_out Receives the number of edges
+ * @return true if the sequence is graphical (false also on allocation failure)
+ * 
+ * @complexity O(n + E)
+ * 
+ * @post The edge list has no self-loops or duplicates; caller frees it
+ */
+bool havel_hakimi_realize(const int *degrees, int n, Edge **edges_out, int *edge_count_out);
+
+/**
+ * @brief Realizes a directed degree sequence as an arc list (Kleitman-Wang)
+ * 
+ * Vertices with remaining in-degree are kept in an indexed binary heap keyed
+ * by residual (in-degree, out-degree). Each vertex with out-degree a sends
+ * its arcs at once to the a heap vertices of largest key; with
+ * allow_bidirectional this decides digraphicality exactly.
+ * 
+ * Without bidirectional arcs the heap pass skips targets that already point
+ * at the source, which is only a heuristic. When it gets stuck, an exact
+ * backtracking search settles one vertex at a time (all its pairs at once)
+ * and prunes residual sequences that are not digraphical, whose underlying
+ * degrees are not graphical, or that break the oriented counting bound, so
+ * a sequence is rejected only if no oriented graph realizes it.
+ * 
+ * @param out_degrees out_degrees[v] = required out-degree of v
+ * @param in_degrees in_degrees[v] = required in-degree of v
+ * @param n Number of vertices
+ * @param allow_bidirectional If false, no arc u → v is added when v → u exists
+ * @param edges_out Receives the arcs (u → v), or NULL if none / on failure
+ * @param edge_count_out Receives the number of arcs
+ * @return true if an arc list was found (false also on allocation failure)
+ * 
+ * @complexity O((n + E) log n), plus O(E) skipped targets without 2-cycles;
+ *             the search after a failed heap pass is exponential in the worst
+ *             case (sequences without 2-cycle-free realizations it cannot
+ *             prune early)
+ * 
+ * @post The arc list has no self-loops or duplicates; caller frees it
+ */
+bool kleitman_wang_realize(const int *out_degrees, const int *in_degrees, int n, bool allow_bidirectional,
+                           Edge **edges_out, int *edge_count_out);
+
 /**
  * @brief Constructs an undirected graph using Havel-Hakimi algorithm
  * 
  * Implements the classical Havel-Hakimi algorithm for undirected graphs.
- * The algorithm repeatedly:
- * 1. Sorts vertices by degree in descending order
+ * The algorithm repeatedly (see havel_hakimi_realize()):
+ * 1. Orders vertices by degree in descending order
  * 2. Takes the vertex with highest degree d
  * 3. Connects it to the next d vertices with highest degrees
  * 4. Reduces their degrees and repeats
  * 
- * The function also generates a DOT file for visualization and populates
- * the graph structure's adjacency matrix.
+ * The function populates the graph structure's adjacency matrix and CSR
+ * view; it performs no I/O.
  * 
  * @param nodes Array of Node structures with degree information
  * @param n Number of vertices in the graph
- * @param dot_file Open file pointer for DOT output
  * @param graph Graph structure to populate with adjacency matrix
  * @return true if the degree sequence is graphical, false otherwise
  * 
- * @complexity O(n²) where n is the number of vertices
+ * @complexity O(n + E) for the realization, O(n²) to allocate the matrix
  * 
  * @pre nodes must be a valid array of size n
- * @pre dot_file must be an open file pointer with write permissions
  * @pre graph must be a valid Graph pointer
  * @post If successful, graph contains the constructed adjacency matrix
- * @post DOT file contains the graph representation for visualization
+ * @post Sequences failing is_graphical_sequence() are rejected before the
+ *       matrix is allocated (graph->adjacency is NULL)
  */
-bool havel_hakimi_undirected(Node *nodes, int n, FILE *dot_file, Graph *graph);
+bool havel_hakimi_undirected(Node *nodes, int n, Graph *graph);
 
 /**
- * @brief Constructs a directed graph using modified Havel-Hakimi algorithm
+ * @brief Constructs a directed graph using the Kleitman-Wang algorithm
  * 
- * Implements a modified Havel-Hakimi algorithm for directed graphs that handles
- * both in-degree and out-degree sequences. The algorithm:
+ * Kleitman-Wang is the Havel-Hakimi algorithm for directed graphs, handling
+ * both in-degree and out-degree sequences (see kleitman_wang_realize()):
  * 1. Maintains separate in-degree and out-degree for each vertex
- * 2. Iteratively connects vertices with highest out-degree to vertices with highest in-degree
- * 3. Optionally allows bidirectional edges based on the allow_bidirectional flag
+ * 2. Connects each vertex with out-degree a to the a vertices of highest in-degree
+ * 3. Optionally allows bidirectional edges based on the allow_bidirectional flag;
+ *    without them, sequences the heap pass cannot place are searched exactly
  * 
  * @param nodes Array of Node structures with out-degree and in-degree information
  * @param n Number of vertices in the graph
- * @param dot_file Open file pointer for DOT output (digraph format)
  * @param graph Graph structure to populate with adjacency matrix
  * @param allow_bidirectional If true, allows bidirectional edges in the directed graph
  * @return true if both degree sequences are graphical, false otherwise
  * 
- * @complexity O(n²) where n is the number of vertices
+ * @complexity O((n + E) log n) for the realization, O(n²) to allocate the matrix
  * 
  * @pre nodes must contain valid out-degree (degree field) and in-degree values
  * @pre Sum of out-degrees must equal sum of in-degrees
- * @pre dot_file must be an open file pointer with write permissions
  * @post If successful, graph contains the constructed directed adjacency matrix
- * @post DOT file contains the directed graph representation
+ * @post Sequences failing is_digraphical_sequence() are rejected before the
+ *       matrix is allocated (graph->adjacency is NULL)
  */
-bool havel_hakimi_directed(Node *nodes, int n, FILE *dot_file, Graph *graph, bool allow_bidirectional);
+bool havel_hakimi_directed(Node *nodes, int n, Graph *graph, bool allow_bidirectional);
 
 #endif
\ No newline at end of file
@@ -19,8 +19,12 @@
  * The module also provides minimum vertex cover computation using the relationship:
  * Minimum Vertex Cover = V \ Maximum Independent Set
  * 
+ * The clique search runs on a complemented view of the input's bit matrix
+ * (find_maximum_clique_complement()), so no complement graph is built;
+ * create_complement_graph() remains for callers that need one explicitly.
+ * 
  * Time Complexity: O(3^(n/3)) - same as maximum clique problem
- * Space Complexity: O(n²) for complement graph and intermediate structures
+ * Space Complexity: O(n²/64) words for the bit matrix
  */
 
 #ifndef INDEPENDENT_SET_H
@@ -61,7 +65,7 @@ Graph *create_complement_graph(Graph *original);
  * @brief Finds maximum independent set using complement graph approach
  * 
  * Computes the maximum independent set by:
- * 1. Creating the complement graph of the input graph
+ * 1. Viewing the input's bit matrix as the complement graph (rows negated on the fly)
  * 2. Finding the maximum clique in the complement graph
  * 3. The maximum clique in complement = maximum independent set in original
  * 
@@ -71,7 +75,8 @@ Graph *create_complement_graph(Graph *original);
  * @param graph Pointer to the input graph
  * @return Pointer to Set containing maximum independent set vertices, or NULL on error
  * 
- * @complexity O(3^(n/3)) - dominated by maximum clique computation
+ * @complexity Exponential worst case - dominated by the branch-and-bound
+ *             maximum clique search on the complement
  * 
  * @pre graph must be a valid undirected graph
  * @pre graph must have valid adjacency matrix
@@ -79,7 +84,7 @@ Graph *create_complement_graph(Graph *original);
  * @post Caller must free returned Set using set_destroy()
  * 
  * @warning Returns NULL for directed graphs (not supported)
- * @warning Returns NULL if complement graph creation fails
+ * @warning Returns NULL for graphs without vertices or on allocation failure
  * 
  * @note The returned set contains vertex indices from the original graph
  * @note No two vertices in the returned set are adjacent in the original graph
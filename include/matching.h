@@ -0,0 +1,157 @@
+/**
+ * @file matching.h
+ * @brief Maximum bipartite matching (Hopcroft-Karp) on CSR rows
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * The bipartite graph is given as CSR rows of the left side: left vertex i
+ * is adjacent to right vertices neighbors[offsets[i] .. offsets[i + 1]).
+ * König covers, the LP reduction of the MIS solver and graph-level
+ * matchings all use this one engine. A separate parallel maximal (not
+ * maximum) matching serves the 2-approximate vertex cover.
+ *
+ * Design:
+ * - An O(E) maximal matching seeds the search, greedy or Karp-Sipser
+ *   (degree-1 vertices are matched first, which is always safe), so the
+ *   Hopcroft-Karp phases only have to add the few remaining edges
+ * - Hopcroft-Karp phases: a BFS layers the left vertices from the free
+ *   ones, then an iterative DFS finds vertex-disjoint shortest augmenting
+ *   paths; vertices that lead nowhere are cut off for the rest of the phase
+ * - Every per-run array (pair_left, pair_right, dist, queue, ...) is carved
+ *   out of one block owned by a reusable MatchingWorkspace, which only
+ *   grows; repeated runs (one per component, one per LP round) allocate
+ *   nothing after the first
+ *
+ * Time Complexity: O(E√V)
+ * Space Complexity: O(V) (plus O(E) for the Karp-Sipser transpose)
+ */
+
+#ifndef MATCHING_H
+#define MATCHING_H
+
+#include "structs.h"
+
+/** Maximal matching rounds run multithreaded only from this many CSR arcs on */
+#define MATCHING_PARALLEL_MIN_ARCS 65536
+
+/**
+ * @brief Initial matching before the Hopcroft-Karp phases
+ */
+typedef enum {
+    MATCHING_INIT_EMPTY,       /**< No seeding */
+    MATCHING_INIT_GREEDY,      /**< First free neighbor of every left vertex */
+    MATCHING_INIT_KARP_SIPSER  /**< Degree-1 vertices first, greedy otherwise */
+} MatchingInit;
+
+/**
+ * @struct MatchingWorkspace
+ * @brief Reusable matching state; the result stays valid until the next run
+ */
+typedef struct {
+    int left_count;      // Sides of the last run
+    int right_count;
+    int size;            // Edges in the maximum matching
+    int initial_size;    // Edges found by the initial heuristic
+    int phases;          // Hopcroft-Karp phases that augmented
+    int *pair_left;      // pair_left[i] = right partner of left vertex i, -1 if free
+    int *pair_right;     // pair_right[j] = left partner of right vertex j, -1 if free
+
+    /* Scratch, all inside block */
+    int *dist;           // BFS layer of each left vertex
+    int *next;           // DFS: next arc to try per left vertex
+    int *stack;          // DFS path (left vertices)
+    int *queue;          // BFS / Karp-Sipser queue (left_count + right_count)
+    int *degree;         // Karp-Sipser: free neighbors per vertex (left, then right)
+    int *t_offsets;      // Karp-Sipser: right-side rows (transpose)
+    int *t_neighbors;
+    void *block;
+    size_t block_bytes;
+} MatchingWorkspace;
+
+/**
+ * @brief Creates an empty workspace (the block is allocated on first use)
+ *
+ * @return New workspace, or NULL on allocation failure
+ */
+MatchingWorkspace *matching_workspace_create(void);
+
+/**
+ * @brief Frees a workspace and its block
+ */
+void matching_workspace_destroy(MatchingWorkspace *ws);
+
+/**
+ * @brief Computes a maximum matching of a bipartite graph
+ *
+ * @param ws Workspace; receives the matching in pair_left / pair_right
+ * @param left_n Left vertices
+ * @param right_n Right vertices
+ * @param offsets Left rows (left_n + 1 entries)
+ * @param neighbors Right vertex of every arc, in [0, right_n)
+ * @param init Initial matching heuristic
+ * @return Matching size, or -1 on allocation failure
+ *
+ * @complexity O(E√V)
+ */
+int matching_maximum(MatchingWorkspace *ws, int left_n, int right_n, const int *offsets, const int *neighbors,
+                     MatchingInit init);
+
+/**
+ * @brief König cover of the last matching: (L \ Z) ∪ (R ∩ Z)
+ *
+ * Z is the set of vertices reachable from the free left vertices along
+ * alternating paths. For a maximum matching the cover is minimum.
+ *
+ * @param ws Workspace after matching_maximum() on the same rows
+ * @param offsets Left rows
+ * @param neighbors Right vertex of every arc
+ * @param cover_left Receives left_count flags (true = in the cover)
+ * @param cover_right Receives right_count flags
+ *
+ * @complexity O(V + E)
+ */
+void matching_konig_cover(MatchingWorkspace *ws, const int *offsets, const int *neighbors, bool *cover_left,
+                          bool *cover_right);
+
+/**
+ * @brief Maximum matching of an undirected bipartite graph
+ *
+ * Splits the vertices with is_bipartite_partition() and matches the two
+ * sides on the CSR view (no adjacency matrix needed).
+ *
+ * @param graph Undirected graph
+ * @param init Initial matching heuristic
+ * @param mate_out Receives mate[v] = partner of v or -1 (node_count entries,
+ *                 caller frees); may be NULL
+ * @return Matching size, or -1 if the graph is directed, not bipartite, or
+ *         an allocation failed
+ *
+ * @complexity O(E√V)
+ */
+int graph_maximum_matching(Graph *graph, MatchingInit init, int **mate_out);
+
+/**
+ * @brief Deterministic parallel greedy maximal matching of an undirected graph
+ *
+ * Every edge gets a pseudo-random priority from the seed (splitmix64 of
+ * its endpoints, distinct for distinct edges). Each round, every active
+ * vertex proposes to its free neighbor of highest priority, and mutual
+ * proposals (locally dominant edges) are matched; a vertex leaves the
+ * active list once it is matched or has no free neighbor. Proposals and
+ * commits each write only the vertex's own slot, so no locks or atomics
+ * touch the matching, and the result is exactly the sequential greedy
+ * matching in priority order: it depends on the seed only, not on the
+ * thread count.
+ *
+ * @param csr Undirected CSR view (self-loops are ignored)
+ * @param num_threads Worker threads (≤ 0 for all online processors)
+ * @param seed Priority seed
+ * @param mate Receives mate[v] = partner of v or -1 (node_count entries)
+ * @return Matching size, or -1 on allocation failure
+ *
+ * @complexity O(E) work per round over the rows of the active vertices;
+ *             O(log V) rounds expected for random priorities
+ */
+int matching_maximal_parallel(const CSRGraph *csr, int num_threads, unsigned long long seed, int *mate);
+
+#endif
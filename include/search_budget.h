@@ -0,0 +1,114 @@
+/**
+ * @file search_budget.h
+ * @brief Time / node budgets and cooperative cancellation for exponential searches
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * A SearchBudget is shared by every thread of one search. The search
+ * charges one node per recursion step (or per tested subset) with
+ * search_budget_charge() and unwinds as soon as it returns false. The
+ * budget runs out when:
+ * - the wall-clock deadline passes (checked every
+ *   SEARCH_BUDGET_CLOCK_INTERVAL nodes, so a node must not take long),
+ * - the node limit is reached,
+ * - the caller's cancel flag is raised, or another thread calls
+ *   search_budget_cancel()
+ *
+ * Searches that stop early return their incumbent with a proven bound, and
+ * report SEARCH_COMPLETE only when the result is known to be exact.
+ *
+ * Time Complexity: O(1) per charged node
+ */
+
+#ifndef SEARCH_BUDGET_H
+#define SEARCH_BUDGET_H
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+/** Nodes between deadline / cancel flag checks (power of two) */
+#define SEARCH_BUDGET_CLOCK_INTERVAL 256
+
+/**
+ * @enum SearchStatus
+ * @brief How a budgeted search ended
+ */
+typedef enum {
+    SEARCH_COMPLETE,     /**< Ran to the end, or stopped with a provably exact result */
+    SEARCH_TIME_LIMIT,   /**< Deadline passed */
+    SEARCH_NODE_LIMIT,   /**< Node limit reached */
+    SEARCH_CANCELLED     /**< Cancel flag raised */
+} SearchStatus;
+
+/**
+ * @struct SearchBudget
+ * @brief Limits of one search and its progress; initialize with search_budget_init()
+ */
+typedef struct {
+    double deadline;       // Monotonic time in seconds, 0 for none
+    long long node_limit;  // 0 for none
+    atomic_bool *cancel;   // Caller's flag, may be NULL
+    atomic_llong nodes;    // Nodes charged so far
+    atomic_int status;     // SEARCH_COMPLETE while the budget lasts
+} SearchBudget;
+
+/**
+ * @brief Starts a budget
+ *
+ * @param budget Budget to initialize
+ * @param seconds Wall-clock limit from now (≤ 0 for none)
+ * @param node_limit Maximum number of search nodes (≤ 0 for none)
+ * @param cancel Flag another thread may set to stop the search (may be NULL)
+ */
+void search_budget_init(SearchBudget *budget, double seconds, long long node_limit, atomic_bool *cancel);
+
+/**
+ * @brief Stops every search using the budget (callable from any thread)
+ */
+void search_budget_cancel(SearchBudget *budget);
+
+/**
+ * @brief Slow path of search_budget_charge(): node limit, clock and cancel flag
+ *
+ * @return true if the budget still lasts
+ */
+bool search_budget_check(SearchBudget *budget, long long nodes);
+
+/**
+ * @brief Charges one search node
+ *
+ * @param budget Budget, or NULL for an unlimited search
+ * @return false once the budget has run out (the search must unwind)
+ */
+static inline bool search_budget_charge(SearchBudget *budget)
+{
+    if (!budget)
+        return true;
+    if (atomic_load_explicit(&budget->status, memory_order_relaxed) != SEARCH_COMPLETE)
+        return false;
+    long long nodes = atomic_fetch_add_explicit(&budget->nodes, 1, memory_order_relaxed) + 1;
+    if ((budget->node_limit > 0 && nodes > budget->node_limit) ||
+        (nodes & (SEARCH_BUDGET_CLOCK_INTERVAL - 1)) == 0)
+        return search_budget_check(budget, nodes);
+    return true;
+}
+
+/**
+ * @brief Whether the budget has run out (false for NULL)
+ */
+static inline bool search_budget_spent(const SearchBudget *budget)
+{
+    return budget && atomic_load_explicit(&budget->status, memory_order_relaxed) != SEARCH_COMPLETE;
+}
+
+/**
+ * @brief Why the budget ran out, SEARCH_COMPLETE while it lasts (or for NULL)
+ */
+SearchStatus search_budget_status(const SearchBudget *budget);
+
+/**
+ * @brief Short name of a status ("complete", "time_limit", ...)
+ */
+const char *search_status_name(SearchStatus status);
+
+#endif
@@ -19,6 +19,8 @@
  * - Dynamic resizing (manual management)
  * - Simple add/remove operations
  * - Memory management utilities
+ * - LIFO arena allocator for recursion-frame sets (SetArena)
+ * - Chunked result store for collecting many result sets (SetStore)
  * 
  * Time Complexity: O(1) for basic operations
  * Space Complexity: O(capacity) where capacity ≥ size
@@ -117,4 +119,153 @@ void set_remove(Set *s);
  */
 void set_destroy(Set *s);
 
+/* ============================================================================
+ * ARENA ALLOCATOR: LIFO scratch memory for recursive searches
+ * ============================================================================*/
+
+/**
+ * @struct SetArenaBlock
+ * @brief One contiguous block of arena memory (blocks form a stack)
+ */
+typedef struct SetArenaBlock {
+    struct SetArenaBlock *prev;
+    size_t capacity;
+    size_t used;
+    unsigned char data[];
+} SetArenaBlock;
+
+/**
+ * @struct SetArena
+ * @brief Per-search stack allocator handing out recursion-frame buffers
+ * 
+ * Memory is carved from large blocks and returned in LIFO order by rolling
+ * back to a mark, so a recursion frame costs a pointer bump instead of a
+ * malloc/free pair. One spare block is kept to avoid thrashing when the
+ * top of the stack oscillates around a block boundary.
+ */
+typedef struct {
+    SetArenaBlock *head;
+    SetArenaBlock *spare;
+    size_t block_size;
+} SetArena;
+
+/**
+ * @struct SetArenaMark
+ * @brief Saved arena position to roll back to
+ */
+typedef struct {
+    SetArenaBlock *block;
+    size_t used;
+} SetArenaMark;
+
+/**
+ * @brief Initializes an empty arena
+ * 
+ * @param arena Arena to initialize
+ * @param block_size Preferred block size in bytes (larger requests get their own block)
+ * 
+ * @post Caller must call set_arena_destroy() to free memory
+ */
+void set_arena_init(SetArena *arena, size_t block_size);
+
+/**
+ * @brief Frees every block owned by the arena
+ */
+void set_arena_destroy(SetArena *arena);
+
+/**
+ * @brief Returns the current top of the arena stack
+ */
+SetArenaMark set_arena_mark(const SetArena *arena);
+
+/**
+ * @brief Releases everything allocated after the mark was taken
+ * 
+ * @complexity O(1) amortized
+ * 
+ * @pre Marks must be released in LIFO order
+ */
+void set_arena_release(SetArena *arena, SetArenaMark mark);
+
+/**
+ * @brief Allocates bytes from the arena (8-byte aligned)
+ * 
+ * @return Pointer valid until the enclosing mark is released, NULL on failure
+ */
+void *set_arena_alloc(SetArena *arena, size_t bytes);
+
+/**
+ * @brief Allocates an empty Set with its vertex array inside the arena
+ * 
+ * The returned set must not be passed to set_destroy(); it is reclaimed by
+ * set_arena_release().
+ * 
+ * @param arena Arena to allocate from
+ * @param capacity Maximum number of vertices
+ * @return Arena-backed Set, NULL on failure
+ */
+Set *set_arena_create_set(SetArena *arena, int capacity);
+
+/* ============================================================================
+ * CHUNKED RESULT STORE: Amortized O(1) collection of result sets
+ * ============================================================================*/
+
+/** Number of result sets per store chunk */
+#define SET_STORE_CHUNK_SIZE 256
+
+/**
+ * @struct SetStoreChunk
+ * @brief Fixed-size block of result set pointers
+ */
+typedef struct SetStoreChunk {
+    struct SetStoreChunk *next;
+    int count;
+    Set *items[SET_STORE_CHUNK_SIZE];
+} SetStoreChunk;
+
+/**
+ * @struct SetStore
+ * @brief Append-only list of result sets stored in fixed-size chunks
+ * 
+ * Appending never copies previously stored pointers, so collecting k
+ * results costs O(k) instead of the O(k²) of growing an array by one
+ * element per result.
+ */
+typedef struct {
+    SetStoreChunk *head;
+    SetStoreChunk *tail;
+    int total;
+} SetStore;
+
+/**
+ * @brief Initializes an empty store
+ */
+void set_store_init(SetStore *store);
+
+/**
+ * @brief Appends a heap copy of the given vertices as a new Set
+ * 
+ * @param store Store to append to
+ * @param vertices Vertices to copy
+ * @param size Number of vertices
+ */
+void set_store_push(SetStore *store, const int *vertices, int size);
+
+/**
+ * @brief Moves all stored sets to the end of a Set** array
+ * 
+ * Grows *array once and appends every stored set, then empties the store.
+ * Ownership of the sets passes to the array (free with set_destroy()).
+ * 
+ * @param store Store to drain
+ * @param array Pointer to Set** array (may point to NULL)
+ * @param count Pointer to number of elements already in *array (updated)
+ */
+void set_store_flatten(SetStore *store, Set ***array, int *count);
+
+/**
+ * @brief Frees the store chunks and any sets still owned by the store
+ */
+void set_store_clear(SetStore *store);
+
 #endif
\ No newline at end of file
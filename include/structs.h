@@ -32,6 +32,34 @@ typedef struct {
     int in_degree; // Only used for directed graphs
 } Node;
 
+/**
+ * @struct CSRGraph
+ * @brief Compressed sparse row (CSR) adjacency representation
+ * 
+ * Stores the neighbors of vertex u contiguously in
+ * neighbors[offsets[u] .. offsets[u + 1] - 1], sorted in ascending order.
+ * Memory use is O(V + E) instead of the O(V²) of the adjacency matrix, and
+ * neighbor iteration only touches real edges.
+ * 
+ * For undirected graphs every edge {u,v} is stored twice (u→v and v→u).
+ * For directed graphs the forward arrays hold out-neighbors, and the reverse
+ * arrays (in_offsets / in_neighbors) hold in-neighbors.
+ * 
+ * A CSR loaded with graph_file_map() points into a read-only file mapping
+ * instead of owning heap arrays; csr_destroy() unmaps it.
+ */
+typedef struct {
+    int node_count;
+    int edge_count;     // Logical edges (each undirected edge counted once)
+    int *offsets;       // Size node_count + 1
+    int *neighbors;     // Size offsets[node_count]
+    int *in_offsets;    // Directed only: reverse CSR offsets, NULL otherwise
+    int *in_neighbors;  // Directed only: reverse CSR neighbors, NULL otherwise
+    bool is_directed;
+    void *mapping;      // File mapping backing the arrays, NULL if they are heap allocated
+    size_t mapping_size;
+} CSRGraph;
+
 /**
  * @struct Graph
  * @brief Main graph representation using adjacency matrix
@@ -39,12 +67,17 @@ typedef struct {
  * This structure represents a graph using an adjacency matrix approach.
  * It supports both directed and undirected graphs with optional bidirectional
  * edges for directed graphs. The adjacency matrix uses boolean values (0/1).
+ * 
+ * A CSR view of the same edge set may be attached in csr. Traversal-based
+ * modules use it when present so that neighbor scans cost O(deg) instead
+ * of O(V); see csr_graph.h.
  */
 typedef struct {
     int **adjacency; // Boolean adjacency matrix (0 or 1)
     int node_count;
     bool is_directed;
     bool allow_bidirectional; // For directed graphs: true if bidirectional edges are allowed
+    CSRGraph *csr;            // Optional CSR view of the same edges (NULL if not built)
 } Graph;
 
 /**
@@ -59,19 +92,6 @@ typedef struct {
     int v;
 } Edge;
 
-/**
- * @struct AdjList
- * @brief Adjacency list representation for specific algorithms
- * 
- * Dynamic adjacency list structure used in algorithms that require
- * efficient neighbor iteration, such as line graph generation.
- */
-typedef struct {
-    int *adjacent;
-    int count;
-    int capacity;
-} AdjList;
-
 /**
  * @struct Set
  * @brief Dynamic set data structure for vertex collections
@@ -98,6 +118,9 @@ typedef struct {
     bool is_weak;
     bool is_one_sided;
     bool is_connected;
+    int scc_count;     // Directed only: number of strongly connected components
+    int component_count;   // Connected components (weakly connected ones for digraphs)
+    int largest_component; // Vertices in the largest of them
 } Connectivity;
 
 #endif 
\ No newline at end of file
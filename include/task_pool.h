@@ -0,0 +1,104 @@
+/**
+ * @file task_pool.h
+ * @brief Work-stealing task scheduler for parallel graph searches
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * A fixed group of worker threads, each owning a double-ended queue of
+ * opaque task pointers. A worker pushes and pops tasks at the bottom of its
+ * own deque (LIFO, depth-first and cache friendly) and, when it runs dry,
+ * steals from the top of another worker's deque (FIFO, i.e. the oldest and
+ * usually largest subtrees).
+ *
+ * Searches split lazily: a running task checks task_pool_has_idle() and only
+ * turns a subtree into a new task when some worker is waiting for work, so
+ * balanced workloads pay almost nothing for the scheduler.
+ *
+ * Termination: the pool counts submitted-but-unfinished tasks. Children are
+ * submitted before their parent finishes, so the count reaches zero only
+ * when the whole search tree has been processed.
+ */
+
+#ifndef TASK_POOL_H
+#define TASK_POOL_H
+
+#include <stdbool.h>
+
+typedef struct TaskPool TaskPool;
+
+/**
+ * @brief Task body, called on a worker thread
+ *
+ * The callee owns the task pointer and must free it.
+ *
+ * @param pool Pool running the task (for submitting children)
+ * @param worker Index of the executing worker in [0, num_workers)
+ * @param task Task payload passed to task_pool_submit()
+ * @param user User pointer given to task_pool_create()
+ */
+typedef void (*TaskFn)(TaskPool *pool, int worker, void *task, void *user);
+
+/**
+ * @brief Number of online processors (at least 1)
+ */
+int task_pool_default_threads(void);
+
+/**
+ * @brief Creates a pool with the given number of workers (threads not started)
+ *
+ * @param num_workers Number of workers; values ≤ 0 use task_pool_default_threads()
+ * @param run Task body
+ * @param user Opaque pointer forwarded to every task call
+ * @return New pool, or NULL on allocation failure
+ */
+TaskPool *task_pool_create(int num_workers, TaskFn run, void *user);
+
+/**
+ * @brief Number of workers in the pool
+ */
+int task_pool_size(const TaskPool *pool);
+
+/**
+ * @brief Pushes a task onto a worker's deque
+ *
+ * Safe to call before task_pool_run() and from inside running tasks.
+ *
+ * @param pool Target pool
+ * @param worker Deque to push to (the calling worker inside a task)
+ * @param task Task payload, owned by the pool until it is run
+ */
+void task_pool_submit(TaskPool *pool, int worker, void *task);
+
+/**
+ * @brief Starts the workers and blocks until every task has finished
+ *
+ * The calling thread acts as worker 0.
+ */
+void task_pool_run(TaskPool *pool);
+
+/**
+ * @brief True when at least one worker is waiting for work
+ *
+ * Used by searches to decide whether splitting off a subtree is worthwhile.
+ */
+bool task_pool_has_idle(const TaskPool *pool);
+
+/**
+ * @brief Requests early termination
+ *
+ * Tasks still queued are run, so they can free their payload, but should
+ * return at once when task_pool_cancelled() is true.
+ */
+void task_pool_cancel(TaskPool *pool);
+
+/**
+ * @brief True once task_pool_cancel() has been called
+ */
+bool task_pool_cancelled(const TaskPool *pool);
+
+/**
+ * @brief Frees the pool (must not be running)
+ */
+void task_pool_destroy(TaskPool *pool);
+
+#endif
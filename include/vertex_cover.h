@@ -8,6 +8,7 @@
  * 1. Exact algorithm via Maximum Independent Set (exponential but optimal)
  * 2. König's theorem for bipartite graphs (polynomial time, optimal for bipartite graphs)
  * 3. 2-approximation algorithm via maximal matching (fast, approximate)
+ * 4. Parameterized decision: is there a cover of size ≤ k? (exponential in k only)
  *
  * Vertex Cover Problem: Find the smallest set of vertices such that every edge
  * has at least one endpoint in the set.
@@ -18,7 +19,8 @@
  * Algorithm complexities:
  * - Exact via MIS: O(3^(n/3)) - exponential
  * - König (bipartite): O(E√V) - polynomial
- * - 2-approximation: O(E) - linear
+ * - 2-approximation: O(E) per parallel matching round
+ * - Decision for budget k: O(V + E + 1.4656^k · k²)
  */
 
 #ifndef VERTEX_COVER_H
@@ -34,7 +36,9 @@
  * This provides the optimal solution but has exponential running time.
  *
  * The algorithm:
- * 1. Finds the maximum independent set using complement graph approach
+ * 1. Finds the maximum independent set (find_maximum_independent_set():
+ *    kernelizing branch-and-reduce for sparse graphs, clique search on the
+ *    complement for dense ones)
  * 2. Returns all vertices not in the maximum independent set
  *
  * This method guarantees the optimal solution but is only practical
@@ -51,7 +55,8 @@
  * @post Every edge has at least one endpoint in returned set
  * @post Caller must free returned Set using set_destroy()
  *
- * @warning Not suitable for large graphs (n > 50) due to exponential complexity
+ * @warning Exponential worst case in the size of the kernel that remains after
+ *          the reductions of mis_solver.h
  * @warning Returns NULL for directed graphs (not supported)
  */
 Set *vertex_cover_exact_via_mis(Graph *graph);
@@ -62,9 +67,13 @@ Set *vertex_cover_exact_via_mis(Graph *graph);
  * Implements König's theorem: In bipartite graphs, the size of maximum matching
  * equals the size of minimum vertex cover. The algorithm:
  * 1. Checks if the graph is bipartite using BFS coloring
- * 2. Finds maximum matching using Hopcroft-Karp algorithm
+ * 2. Finds maximum matching using Hopcroft-Karp algorithm (matching.h,
+ *    on CSR rows, Karp-Sipser seeded)
  * 3. Constructs minimum vertex cover using alternating paths
  *
+ * Steps 2 and 3 run per connected component (components.h), in parallel on
+ * a task pool; the component covers are concatenated in component order.
+ *
  * König's theorem construction:
  * - Start from unmatched vertices in left partition
  * - Follow alternating paths (non-matching edges to right, matching edges to left)
@@ -87,6 +96,9 @@ Set *vertex_cover_exact_via_mis(Graph *graph);
  */
 Set *vertex_cover_bipartite_konig(Graph *graph);
 
+/** Edge priority seed of vertex_cover_approx() */
+#define VERTEX_COVER_APPROX_SEED 0x5EEDULL
+
 /**
  * @brief Fast 2-approximation algorithm using maximal matching
  *
@@ -100,10 +112,12 @@ Set *vertex_cover_bipartite_konig(Graph *graph);
  * - Optimal cover needs at least 1 vertex per matching edge
  * - Therefore: |our cover| ≤ 2 × |optimal cover|
  *
+ * Same as vertex_cover_approx_parallel(graph, 0, VERTEX_COVER_APPROX_SEED).
+ *
  * @param graph Pointer to the input graph
  * @return Pointer to Set containing 2-approximate vertex cover (never NULL for valid input)
  *
- * @complexity O(E) where E is the number of edges
+ * @complexity O(E) work per matching round, O(log V) rounds expected
  *
  * @pre graph must be a valid undirected graph
  * @post Returns vertex cover with size ≤ 2 × optimal size
@@ -116,6 +130,67 @@ Set *vertex_cover_bipartite_konig(Graph *graph);
  */
 Set *vertex_cover_approx(Graph *graph);
 
+/**
+ * @brief 2-approximate vertex cover from a parallel maximal matching
+ *
+ * The matching (matching_maximal_parallel()) is the sequential greedy one
+ * in a random edge order fixed by the seed, computed in rounds of locally
+ * dominant edges on the CSR view, so the cover depends on the seed and
+ * not on the thread count.
+ *
+ * @param graph Pointer to the input graph
+ * @param num_threads Worker threads (≤ 0 for all online processors)
+ * @param seed Edge priority seed
+ * @return Both endpoints of every matching edge in ascending order (caller
+ *         frees with set_destroy()), or NULL for directed graphs and on
+ *         allocation failure
+ *
+ * @complexity O(E) work per round, O(log V) rounds expected
+ */
+Set *vertex_cover_approx_parallel(Graph *graph, int num_threads, unsigned long long seed);
+
+/**
+ * @brief Outcome of vertex_cover_decide()
+ */
+typedef enum {
+    VERTEX_COVER_YES,         /**< A cover of size ≤ k exists */
+    VERTEX_COVER_NO,          /**< Every vertex cover has more than k vertices */
+    VERTEX_COVER_UNSUPPORTED, /**< NULL or directed graph */
+    VERTEX_COVER_NO_MEMORY    /**< Scratch allocation failed */
+} VertexCoverDecision;
+
+/**
+ * @brief Decides whether the graph has a vertex cover of at most k vertices
+ *
+ * Fixed-parameter algorithm for threshold checks, where the full optimum of
+ * vertex_cover_exact_via_mis() is not needed:
+ * 1. A greedy maximal matching M answers most queries at once: |M| > k
+ *    means "no", 2|M| ≤ k means "yes" (the vertex_cover_approx() bound)
+ * 2. Buss kernel: every vertex of degree > k is in the cover; if more than
+ *    k'² edges remain for the remaining budget k', the answer is "no"
+ * 3. Bounded search tree on the kernel: a vertex v of maximum degree is in
+ *    the cover, or all of N(v) is. Degree-1 vertices, degree-2 vertices in
+ *    a triangle and cycles are resolved without branching, and nodes whose
+ *    matching or edge-count bound exceeds the budget are pruned
+ *
+ * Only the CSR view is read, so CSR-only graphs work as well.
+ *
+ * @param graph Pointer to the input graph
+ * @param k Size bound (negative bounds are answered with VERTEX_COVER_NO)
+ * @param cover_out Receives a cover of size ≤ k if the answer is
+ *                  VERTEX_COVER_YES (caller frees with set_destroy()), NULL
+ *                  otherwise; may be NULL if no witness is needed
+ * @return The decision, or why none was made
+ *
+ * @complexity O(V + E + 1.4656^k · k²); branching happens only on degree ≥ 3
+ *
+ * @pre graph must be a valid undirected graph without self-loops
+ * @post graph->csr is built if it was missing
+ *
+ * @note The witness is a cover within the budget, not necessarily a minimum one
+ */
+VertexCoverDecision vertex_cover_decide(Graph *graph, int k, Set **cover_out);
+
 /**
  * @brief Checks if graph is bipartite and returns partition
  *
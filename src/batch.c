@@ -0,0 +1,951 @@
+/**
+ * @file batch.c
+ * @brief Batch driver implementation
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * A job is parsed into a Graph, then every requested analysis runs against
+ * a BatchContext that computes shared structures on first use and keeps
+ * them until the job ends. Results go through a small emitter that knows
+ * the JSON and CSV encodings, so the analyses never format output directly.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "batch.h"
+#include "clique.h"
+#include "components.h"
+#include "connectivity.h"
+#include "connectivity_number.h"
+#include "csr_graph.h"
+#include "euler_path.h"
+#include "graph_io.h"
+#include "graph_stats.h"
+#include "havel_hakimi.h"
+#include "independent_set.h"
+#include "reorder.h"
+#include "search_budget.h"
+#include "set_utils.h"
+#include "vertex_cover.h"
+
+/* ========================================================================
+ * RESULT EMITTER
+ * ========================================================================*/
+
+typedef struct
+{
+    FILE *out;
+    BatchFormat format;
+    int job;
+    const char *source;
+    const char *analysis;  // CSV analysis column ("graph" for job-level values)
+    bool first_field;      // JSON: next field of the current object needs no comma
+    bool in_results;       // JSON: the "results" object is open
+    const int *labels;     // Input label of every vertex of a relabelled graph, NULL otherwise
+} Emitter;
+
+static void write_json_string(FILE *out, const char *s)
+{
+    fputc('"', out);
+    for (; *s; s++)
+    {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\')
+        {
+            fputc('\\', out);
+            fputc(c, out);
+        }
+        else if (c < 0x20)
+        {
+            fprintf(out, "\\u%04x", c);
+        }
+        else
+        {
+            fputc(c, out);
+        }
+    }
+    fputc('"', out);
+}
+
+static void write_csv_string(FILE *out, const char *s)
+{
+    if (!strpbrk(s, ",\"\r\n"))
+    {
+        fputs(s, out);
+        return;
+    }
+    fputc('"', out);
+    for (; *s; s++)
+    {
+        if (*s == '"')
+            fputc('"', out);
+        fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+/**
+ * @brief Starts a value: JSON key with separator, or the leading CSV columns
+ */
+static void emit_key(Emitter *e, const char *key)
+{
+    if (e->format == BATCH_FORMAT_JSON)
+    {
+        if (!e->first_field)
+            fputc(',', e->out);
+        e->first_field = false;
+        write_json_string(e->out, key);
+        fputc(':', e->out);
+    }
+    else
+    {
+        fprintf(e->out, "%d,", e->job);
+        write_csv_string(e->out, e->source);
+        fprintf(e->out, ",%s,%s,", e->analysis, key);
+    }
+}
+
+static void emit_value_end(Emitter *e)
+{
+    if (e->format == BATCH_FORMAT_CSV)
+        fputc('\n', e->out);
+}
+
+static void emit_int(Emitter *e, const char *key, long long value)
+{
+    emit_key(e, key);
+    fprintf(e->out, "%lld", value);
+    emit_value_end(e);
+}
+
+static void emit_double(Emitter *e, const char *key, double value)
+{
+    emit_key(e, key);
+    fprintf(e->out, "%.6g", value);
+    emit_value_end(e);
+}
+
+static void emit_bool(Emitter *e, const char *key, bool value)
+{
+    emit_key(e, key);
+    fputs(value ? "true" : "false", e->out);
+    emit_value_end(e);
+}
+
+static void emit_string(Emitter *e, const char *key, const char *value)
+{
+    emit_key(e, key);
+    if (e->format == BATCH_FORMAT_JSON)
+        write_json_string(e->out, value);
+    else
+        write_csv_string(e->out, value);
+    emit_value_end(e);
+}
+
+/**
+ * @brief Writes a vertex list: JSON array, or one space-separated CSV field
+ *
+ * @param labels Label to print for every vertex (NULL prints the values as they are)
+ */
+static void write_list(Emitter *e, const char *key, const int *values, int count, const int *labels)
+{
+    bool json = e->format == BATCH_FORMAT_JSON;
+    emit_key(e, key);
+    if (json)
+        fputc('[', e->out);
+    for (int i = 0; i < count; i++)
+    {
+        if (i > 0)
+            fputc(json ? ',' : ' ', e->out);
+        fprintf(e->out, "%d", labels ? labels[values[i]] : values[i]);
+    }
+    if (json)
+        fputc(']', e->out);
+    emit_value_end(e);
+}
+
+/**
+ * @brief Writes a vertex list in the caller's labels
+ */
+static void emit_list(Emitter *e, const char *key, const int *values, int count)
+{
+    write_list(e, key, values, count, e->labels);
+}
+
+static int compare_ints(const void *a, const void *b)
+{
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Writes "size" and the sorted "vertices" of a set (NULL = empty)
+ */
+static void emit_set(Emitter *e, const Set *set)
+{
+    int size = set ? set->size : 0;
+    int *sorted = malloc((size > 0 ? size : 1) * sizeof(int));
+    if (!sorted)
+    {
+        emit_string(e, "error", "out of memory");
+        return;
+    }
+    if (size > 0)
+        memcpy(sorted, set->vertices, size * sizeof(int));
+    if (e->labels)
+        vertex_order_restore(e->labels, sorted, size);
+    qsort(sorted, size, sizeof(int), compare_ints);
+    emit_int(e, "size", size);
+    write_list(e, "vertices", sorted, size, NULL);
+    free(sorted);
+}
+
+static void begin_job(Emitter *e)
+{
+    e->analysis = "graph";
+    e->in_results = false;
+    if (e->format == BATCH_FORMAT_JSON)
+    {
+        fputc('{', e->out);
+        e->first_field = true;
+        emit_int(e, "job", e->job);
+        emit_string(e, "source", e->source);
+    }
+}
+
+static void end_job(Emitter *e)
+{
+    if (e->format == BATCH_FORMAT_JSON)
+    {
+        if (e->in_results)
+            fputc('}', e->out);
+        fputs("}\n", e->out);
+    }
+    fflush(e->out);
+}
+
+static void begin_analysis(Emitter *e, const char *name)
+{
+    e->analysis = name;
+    if (e->format != BATCH_FORMAT_JSON)
+        return;
+    if (!e->in_results)
+    {
+        emit_key(e, "results");
+        fputc('{', e->out);
+        e->in_results = true;
+        e->first_field = true;
+    }
+    emit_key(e, name);
+    fputc('{', e->out);
+    e->first_field = true;
+}
+
+/**
+ * @brief Writes what an analysis cost: a nested JSON "stats" object, or
+ *        CSV metrics "stats.<name>"
+ *
+ * Reports the wall time, the heap high-water mark above the starting live
+ * size and every counter that moved.
+ */
+static void emit_stats(Emitter *e, const GraphStatsSnapshot *before, const GraphStatsSnapshot *after,
+                       double seconds)
+{
+    bool json = e->format == BATCH_FORMAT_JSON;
+    if (json)
+    {
+        emit_key(e, "stats");
+        fputc('{', e->out);
+        e->first_field = true;
+    }
+
+    char key[64];
+    snprintf(key, sizeof(key), "%sms", json ? "" : "stats.");
+    emit_double(e, key, seconds * 1e3);
+    snprintf(key, sizeof(key), "%speak_bytes", json ? "" : "stats.");
+    emit_int(e, key, after->peak_bytes - before->live_bytes);
+    for (int c = 0; c < GRAPH_STAT_COUNT; c++)
+    {
+        long long delta = after->counters[c] - before->counters[c];
+        if (delta == 0)
+            continue;
+        snprintf(key, sizeof(key), "%s%s", json ? "" : "stats.", graph_stats_counter_name(c));
+        emit_int(e, key, delta);
+    }
+
+    if (json)
+    {
+        fputc('}', e->out);
+        e->first_field = false;
+    }
+}
+
+static void end_analysis(Emitter *e)
+{
+    if (e->format == BATCH_FORMAT_JSON)
+    {
+        fputc('}', e->out);
+        e->first_field = false;
+    }
+}
+
+/* ========================================================================
+ * SHARED DERIVED STRUCTURES
+ * ========================================================================*/
+
+typedef struct
+{
+    Graph *graph;
+    CSRGraph *csr;
+    int *degrees;                   // Total degree (out + in for digraphs), NULL until needed
+    ComponentLabeling components;
+    bool have_components;
+    Set *independent_set;           // Maximum clique of the complement
+    bool have_independent_set;
+    SearchBudget budget;            // Restarted by every budgeted analysis
+} BatchContext;
+
+/* Limits of the exponential searches, see batch_set_search_limits() */
+static double search_seconds;
+static long long search_nodes;
+
+/* Relabelling applied before the analyses, see batch_set_vertex_order() */
+static VertexOrder vertex_order = VERTEX_ORDER_NONE;
+
+/**
+ * @brief Fresh budget for one analysis, NULL when no limit is set
+ */
+static SearchBudget *context_budget(BatchContext *ctx)
+{
+    if (search_seconds <= 0 && search_nodes <= 0)
+        return NULL;
+    search_budget_init(&ctx->budget, search_seconds, search_nodes, NULL);
+    return &ctx->budget;
+}
+
+static const int *context_degrees(BatchContext *ctx)
+{
+    if (!ctx->degrees)
+    {
+        int n = ctx->csr->node_count;
+        ctx->degrees = malloc((n > 0 ? n : 1) * sizeof(int));
+        if (ctx->degrees)
+        {
+            for (int v = 0; v < n; v++)
+                ctx->degrees[v] = csr_degree(ctx->csr, v) + (ctx->csr->is_directed ? csr_in_degree(ctx->csr, v) : 0);
+        }
+    }
+    return ctx->degrees;
+}
+
+static const ComponentLabeling *context_components(BatchContext *ctx)
+{
+    if (!ctx->have_components)
+        ctx->have_components = components_compute_csr(ctx->csr, 0, &ctx->components) == 0;
+    return ctx->have_components ? &ctx->components : NULL;
+}
+
+/**
+ * @brief Maximum independent set, shared by independent_set and vertex_cover
+ *
+ * @return The set (owned by the context), or NULL on failure
+ */
+static const Set *context_independent_set(BatchContext *ctx)
+{
+    if (!ctx->have_independent_set)
+    {
+        ctx->have_independent_set = true;
+        if (ctx->graph->node_count == 0)
+        {
+            ctx->independent_set = set_create(1);
+        }
+        else
+        {
+            ctx->independent_set = find_maximum_independent_set(ctx->graph);
+        }
+    }
+    return ctx->independent_set;
+}
+
+static void context_free(BatchContext *ctx)
+{
+    free(ctx->degrees);
+    if (ctx->have_components)
+        components_free(&ctx->components);
+    if (ctx->independent_set)
+        set_destroy(ctx->independent_set);
+}
+
+/* ========================================================================
+ * ANALYSES
+ * ========================================================================*/
+
+/**
+ * @brief Reports why an analysis cannot run on this graph, if it cannot
+ *
+ * @return true if the analysis may run
+ */
+static bool applicable(BatchContext *ctx, Emitter *e, bool undirected_only, bool needs_matrix)
+{
+    const char *error = NULL;
+    if (undirected_only && ctx->graph->is_directed)
+        error = "undirected graphs only";
+    else if (needs_matrix && !ctx->graph->adjacency)
+        error = "graph too large for the adjacency matrix";
+    if (error)
+        emit_string(e, "error", error);
+    return error == NULL;
+}
+
+static void run_degrees(BatchContext *ctx, Emitter *e)
+{
+    const CSRGraph *csr = ctx->csr;
+    int n = csr->node_count;
+    int min_out = n > 0 ? INT_MAX : 0, max_out = 0, min_in = n > 0 ? INT_MAX : 0, max_in = 0;
+    for (int v = 0; v < n; v++)
+    {
+        int d = csr_degree(csr, v), din = csr_in_degree(csr, v);
+        min_out = d < min_out ? d : min_out;
+        max_out = d > max_out ? d : max_out;
+        min_in = din < min_in ? din : min_in;
+        max_in = din > max_in ? din : max_in;
+    }
+    int arcs = csr->offsets[n];
+    emit_int(e, "min", min_out);
+    emit_int(e, "max", max_out);
+    emit_double(e, "mean", n > 0 ? (double)arcs / n : 0.0);
+    if (csr->is_directed)
+    {
+        emit_int(e, "in_min", min_in);
+        emit_int(e, "in_max", max_in);
+    }
+}
+
+static void run_connectivity(BatchContext *ctx, Emitter *e)
+{
+    if (ctx->graph->is_directed)
+    {
+        Connectivity conn = check_connectivity(ctx->graph);
+        emit_bool(e, "strong", conn.is_strong);
+        emit_bool(e, "weak", conn.is_weak);
+        emit_bool(e, "one_sided", conn.is_one_sided);
+        emit_int(e, "scc_count", conn.scc_count);
+        return;
+    }
+    const ComponentLabeling *cc = context_components(ctx);
+    if (!cc)
+    {
+        emit_string(e, "error", "out of memory");
+        return;
+    }
+    emit_bool(e, "connected", cc->count <= 1);
+}
+
+static void run_components(BatchContext *ctx, Emitter *e)
+{
+    const ComponentLabeling *cc = context_components(ctx);
+    if (!cc)
+    {
+        emit_string(e, "error", "out of memory");
+        return;
+    }
+    int largest = 0;
+    for (int c = 0; c < cc->count; c++)
+        largest = cc->sizes[c] > largest ? cc->sizes[c] : largest;
+    emit_int(e, "count", cc->count);
+    emit_int(e, "largest", largest);
+}
+
+static void run_cliques(BatchContext *ctx, Emitter *e)
+{
+    if (!applicable(ctx, e, true, true))
+        return;
+    SearchBudget *budget = context_budget(ctx);
+    CliqueCounts counts = count_cliques_budget(ctx->graph, CLIQUE_ENGINE_DEGENERACY, budget);
+    emit_int(e, "maximal_count", counts.count);
+    emit_int(e, "clique_number", counts.max_size);
+    if (budget)
+        emit_string(e, "status", search_status_name(search_budget_status(budget)));
+}
+
+static void run_max_clique(BatchContext *ctx, Emitter *e)
+{
+    if (!applicable(ctx, e, true, true))
+        return;
+    SearchBudget *budget = context_budget(ctx);
+    MaxCliqueResult result = find_maximum_clique_budget(ctx->graph, budget); // NULL for graphs without vertices
+    emit_set(e, result.clique);
+    if (budget)
+    {
+        emit_string(e, "status", search_status_name(result.status));
+        emit_int(e, "upper_bound", result.upper_bound);
+    }
+    if (result.clique)
+        set_destroy(result.clique);
+}
+
+static void run_independent_set(BatchContext *ctx, Emitter *e)
+{
+    if (!applicable(ctx, e, true, true))
+        return;
+    const Set *mis = context_independent_set(ctx);
+    if (mis)
+        emit_set(e, mis);
+    else
+        emit_string(e, "error", "out of memory");
+}
+
+static void run_vertex_cover(BatchContext *ctx, Emitter *e)
+{
+    if (!applicable(ctx, e, true, true))
+        return;
+    const Set *mis = context_independent_set(ctx);
+    int n = ctx->graph->node_count;
+    bool *in_mis = mis ? calloc(n > 0 ? n : 1, sizeof(bool)) : NULL;
+    Set *cover = in_mis ? set_create(n > 0 ? n : 1) : NULL;
+    if (!cover)
+    {
+        free(in_mis);
+        emit_string(e, "error", "out of memory");
+        return;
+    }
+    // Minimum vertex cover = V \ maximum independent set
+    for (int i = 0; i < mis->size; i++)
+        in_mis[mis->vertices[i]] = true;
+    for (int v = 0; v < n; v++)
+    {
+        if (!in_mis[v])
+            set_add(cover, v);
+    }
+    emit_set(e, cover);
+    set_destroy(cover);
+    free(in_mis);
+}
+
+static void run_vertex_cover_konig(BatchContext *ctx, Emitter *e)
+{
+    if (!applicable(ctx, e, true, false))
+        return;
+    Set *cover = vertex_cover_bipartite_konig(ctx->graph);
+    emit_bool(e, "bipartite", cover != NULL);
+    if (cover)
+    {
+        emit_set(e, cover);
+        set_destroy(cover);
+    }
+}
+
+static void run_vertex_cover_approx(BatchContext *ctx, Emitter *e)
+{
+    if (!applicable(ctx, e, true, false))
+        return;
+    Set *cover = vertex_cover_approx(ctx->graph);
+    emit_set(e, cover);
+    if (cover)
+        set_destroy(cover);
+}
+
+static void run_euler(BatchContext *ctx, Emitter *e)
+{
+    static const char *const status_names[] = {
+        [EULER_CYCLE] = "cycle",
+        [EULER_PATH] = "path",
+        [EULER_NO_EDGES] = "no_edges",
+        [EULER_ODD_DEGREES] = "odd_degrees",
+        [EULER_UNBALANCED] = "unbalanced",
+        [EULER_DISCONNECTED] = "disconnected",
+        [EULER_NO_MEMORY] = "no_memory",
+    };
+    int *path = NULL;
+    int length = 0;
+    EulerStatus status = euler_path_csr(ctx->csr, &path, &length);
+    emit_string(e, "status", status_names[status]);
+    if (status == EULER_CYCLE || status == EULER_PATH)
+        emit_list(e, "path", path, length);
+    free(path);
+}
+
+static void run_connectivity_number(BatchContext *ctx, Emitter *e)
+{
+    int *cut = NULL;
+    int kappa = find_min_vertex_cut_maxflow(ctx->graph, &cut);
+    if (kappa < 0)
+    {
+        emit_string(e, "error", "out of memory");
+        return;
+    }
+    emit_int(e, "kappa", kappa);
+    emit_list(e, "cut", cut, cut ? kappa : 0);
+    free(cut);
+}
+
+static void run_line_graph(BatchContext *ctx, Emitter *e)
+{
+    const int *degrees = context_degrees(ctx);
+    if (!degrees)
+    {
+        emit_string(e, "error", "out of memory");
+        return;
+    }
+    // L(G) has a vertex per edge and an edge per pair of edges sharing an endpoint
+    const CSRGraph *csr = ctx->csr;
+    long long pairs = 0;
+    for (int v = 0; v < csr->node_count; v++)
+    {
+        pairs += (long long)degrees[v] * (degrees[v] - 1) / 2;
+        // A 2-cycle u ⇄ v shares both endpoints but is one line graph edge
+        for (int k = csr->offsets[v]; csr->is_directed && k < csr->offsets[v + 1]; k++)
+            if (csr->neighbors[k] > v && csr_has_edge(csr, csr->neighbors[k], v))
+                pairs--;
+    }
+    emit_int(e, "nodes", csr->edge_count);
+    emit_int(e, "edges", pairs);
+}
+
+static const struct
+{
+    const char *name;
+    unsigned flag;
+    void (*run)(BatchContext *ctx, Emitter *e);
+} batch_analyses[] = {
+    {"degrees", BATCH_DEGREES, run_degrees},
+    {"connectivity", BATCH_CONNECTIVITY, run_connectivity},
+    {"components", BATCH_COMPONENTS, run_components},
+    {"cliques", BATCH_CLIQUES, run_cliques},
+    {"max_clique", BATCH_MAX_CLIQUE, run_max_clique},
+    {"independent_set", BATCH_INDEPENDENT_SET, run_independent_set},
+    {"vertex_cover", BATCH_VERTEX_COVER, run_vertex_cover},
+    {"vertex_cover_konig", BATCH_VERTEX_COVER_KONIG, run_vertex_cover_konig},
+    {"vertex_cover_approx", BATCH_VERTEX_COVER_APPROX, run_vertex_cover_approx},
+    {"euler", BATCH_EULER, run_euler},
+    {"connectivity_number", BATCH_CONNECTIVITY_NUMBER, run_connectivity_number},
+    {"line_graph", BATCH_LINE_GRAPH, run_line_graph},
+};
+
+#define BATCH_ANALYSIS_COUNT ((int)(sizeof(batch_analyses) / sizeof(batch_analyses[0])))
+
+/* ========================================================================
+ * JOB PARSING
+ * ========================================================================*/
+
+static const char *skip_spaces(const char *p)
+{
+    while (*p == ' ' || *p == '\t')
+        p++;
+    return p;
+}
+
+/**
+ * @brief Parses non-negative integers up to stop (or the end of the string)
+ *
+ * @return New array (caller frees), or NULL with *error set
+ */
+static int *parse_int_list(const char **p, char stop, int *count_out, const char **error)
+{
+    int count = 0, capacity = 16;
+    int *values = malloc(capacity * sizeof(int));
+    const char *q = skip_spaces(*p);
+    while (values && *q && *q != stop)
+    {
+        char *end;
+        long value = strtol(q, &end, 10);
+        if (end == q || value < 0 || value > INT_MAX || (*end && *end != ' ' && *end != '\t' && *end != stop))
+        {
+            free(values);
+            *error = "invalid degree";
+            return NULL;
+        }
+        if (count == capacity)
+        {
+            capacity *= 2;
+            int *grown = realloc(values, capacity * sizeof(int));
+            if (!grown)
+                free(values);
+            values = grown;
+            if (!values)
+                break;
+        }
+        values[count++] = (int)value;
+        q = skip_spaces(end);
+    }
+    if (!values)
+    {
+        *error = "out of memory";
+        return NULL;
+    }
+    *p = q;
+    *count_out = count;
+    return values;
+}
+
+static bool build_from_degrees(const char *p, bool is_directed, Graph *graph, const char **error)
+{
+    bool allow_bidirectional = false;
+    if (is_directed && strncmp(p, "bidirectional", 13) == 0 && (p[13] == ' ' || p[13] == '\t' || !p[13]))
+    {
+        allow_bidirectional = true;
+        p = skip_spaces(p + 13);
+    }
+
+    int n = 0, n_in = 0;
+    int *degrees = parse_int_list(&p, is_directed ? '/' : '\0', &n, error);
+    int *in_degrees = NULL;
+    if (degrees && is_directed)
+    {
+        if (*p == '/')
+        {
+            p++;
+            in_degrees = parse_int_list(&p, '\0', &n_in, error);
+            if (in_degrees && n_in != n)
+                *error = "out- and in-degree sequences differ in length";
+        }
+        else
+        {
+            *error = "missing '/' before the in-degrees";
+        }
+    }
+    bool parsed = degrees && (!is_directed || (in_degrees && n_in == n));
+
+    Node *nodes = parsed ? malloc((n > 0 ? n : 1) * sizeof(Node)) : NULL;
+    bool built = false;
+    if (nodes)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            nodes[i].original_index = i;
+            nodes[i].degree = degrees[i];
+            nodes[i].in_degree = is_directed ? in_degrees[i] : 0;
+        }
+        built = is_directed ? havel_hakimi_directed(nodes, n, graph, allow_bidirectional)
+                            : havel_hakimi_undirected(nodes, n, graph);
+        if (!built)
+        {
+            graph_free_storage(graph);
+            *error = "not a graphical sequence";
+        }
+    }
+    else if (parsed)
+    {
+        *error = "out of memory";
+    }
+    free(nodes);
+    free(degrees);
+    free(in_degrees);
+    return built;
+}
+
+/**
+ * @brief Builds the graph described by a job source
+ *
+ * @return true on success; otherwise *error describes the problem
+ */
+static bool build_job_graph(const char *source, Graph *graph, const char **error)
+{
+    const char *p = skip_spaces(source);
+    size_t kind_len = strcspn(p, " \t");
+    const char *args = skip_spaces(p + kind_len);
+
+    if (kind_len == 10 && strncmp(p, "undirected", 10) == 0)
+        return build_from_degrees(args, false, graph, error);
+    if (kind_len == 8 && strncmp(p, "directed", 8) == 0)
+        return build_from_degrees(args, true, graph, error);
+
+    CSRGraph *csr;
+    if (!*args)
+    {
+        *error = "missing file name";
+        return false;
+    }
+    if (kind_len == 4 && strncmp(p, "load", 4) == 0)
+        csr = graph_file_map(args);
+    else if (kind_len == 5 && strncmp(p, "edges", 5) == 0)
+        csr = graph_parse_edge_list(args, false);
+    else if (kind_len == 4 && strncmp(p, "arcs", 4) == 0)
+        csr = graph_parse_edge_list(args, true);
+    else if (kind_len == 5 && strncmp(p, "metis", 5) == 0)
+        csr = graph_parse_metis(args);
+    else
+    {
+        *error = "unknown graph source";
+        return false;
+    }
+    if (!csr)
+    {
+        *error = "cannot read graph file";
+        return false;
+    }
+    if (!graph_adopt_csr(graph, csr))
+    {
+        *error = "out of memory";
+        return false;
+    }
+    return true;
+}
+
+/* ========================================================================
+ * PUBLIC API
+ * ========================================================================*/
+
+bool batch_parse_analyses(const char *list, unsigned *mask_out)
+{
+    unsigned mask = 0;
+    const char *p = list;
+    while (*p)
+    {
+        p += strspn(p, " \t,");
+        size_t len = strcspn(p, " \t,");
+        if (len == 0)
+            break;
+        bool known = len == 3 && strncmp(p, "all", 3) == 0;
+        if (known)
+            mask |= BATCH_ALL;
+        for (int i = 0; i < BATCH_ANALYSIS_COUNT && !known; i++)
+        {
+            if (strlen(batch_analyses[i].name) == len && strncmp(p, batch_analyses[i].name, len) == 0)
+            {
+                mask |= batch_analyses[i].flag;
+                known = true;
+            }
+        }
+        if (!known)
+            return false;
+        p += len;
+    }
+    *mask_out = mask;
+    return mask != 0;
+}
+
+void batch_set_search_limits(double seconds, long long node_limit)
+{
+    search_seconds = seconds;
+    search_nodes = node_limit;
+}
+
+void batch_set_vertex_order(VertexOrder order)
+{
+    vertex_order = order;
+}
+
+void batch_write_header(FILE *out, BatchFormat format)
+{
+    if (format == BATCH_FORMAT_CSV)
+        fputs("job,source,analysis,metric,value\n", out);
+}
+
+void batch_run_graph(Graph *graph, int job, const char *source, unsigned analyses, BatchFormat format,
+                     FILE *out)
+{
+    Emitter e = {out, format, job, source, "graph", true, false, NULL};
+    begin_job(&e);
+
+    BatchContext ctx = {0};
+    ctx.graph = graph;
+    ctx.csr = graph_ensure_csr(graph);
+
+    // The analyses see the relabelled copy; the emitter maps vertices back
+    Graph relabelled = {0};
+    int *perm = NULL;
+    if (ctx.csr && vertex_order != VERTEX_ORDER_NONE)
+    {
+        perm = vertex_order_compute(ctx.csr, vertex_order);
+        if (perm && graph_reorder(graph, perm, &relabelled))
+        {
+            ctx.graph = &relabelled;
+            ctx.csr = relabelled.csr;
+            e.labels = perm;
+        }
+        else
+        {
+            ctx.csr = NULL;
+        }
+    }
+    if (!ctx.csr)
+    {
+        emit_string(&e, "error", "out of memory");
+        end_job(&e);
+        free(perm);
+        return;
+    }
+    emit_int(&e, "nodes", graph->node_count);
+    emit_int(&e, "edges", ctx.csr->edge_count);
+    emit_bool(&e, "directed", graph->is_directed);
+
+    for (int i = 0; i < BATCH_ANALYSIS_COUNT; i++)
+    {
+        if (!(analyses & batch_analyses[i].flag))
+            continue;
+        begin_analysis(&e, batch_analyses[i].name);
+        if (GRAPH_STATS_ENABLED)
+        {
+            GraphStatsSnapshot before, after;
+            graph_stats_reset_peak();
+            graph_stats_snapshot(&before);
+            double start = graph_stats_now();
+            batch_analyses[i].run(&ctx, &e);
+            double seconds = graph_stats_now() - start;
+            graph_stats_snapshot(&after);
+            emit_stats(&e, &before, &after, seconds);
+        }
+        else
+        {
+            batch_analyses[i].run(&ctx, &e);
+        }
+        end_analysis(&e);
+    }
+
+    context_free(&ctx);
+    graph_free_storage(&relabelled);
+    free(perm);
+    end_job(&e);
+}
+
+int batch_run_jobs(FILE *jobs, BatchFormat format, FILE *out)
+{
+    batch_write_header(out, format);
+
+    char *line = NULL;
+    size_t capacity = 0;
+    int job = 0, failed = 0;
+    while (getline(&line, &capacity, jobs) != -1)
+    {
+        // Job text: "<source> [: analyses]", trimmed
+        line[strcspn(line, "\r\n")] = '\0';
+        char *source = (char *)skip_spaces(line);
+        if (!*source || *source == '#')
+            continue;
+        job++;
+
+        unsigned analyses = BATCH_ALL;
+        const char *error = NULL;
+        char *colon = strchr(source, ':');
+        if (colon)
+        {
+            *colon = '\0';
+            if (!batch_parse_analyses(colon + 1, &analyses))
+                error = "unknown analysis";
+        }
+        size_t len = strlen(source);
+        while (len > 0 && (source[len - 1] == ' ' || source[len - 1] == '\t'))
+            source[--len] = '\0';
+
+        Graph graph;
+        if (!error && build_job_graph(source, &graph, &error))
+        {
+            batch_run_graph(&graph, job, source, analyses, format, out);
+            graph_free_storage(&graph);
+            continue;
+        }
+
+        Emitter e = {out, format, job, source, "graph", true, false, NULL};
+        begin_job(&e);
+        emit_string(&e, "error", error);
+        end_job(&e);
+        failed++;
+    }
+    free(line);
+    return failed;
+}
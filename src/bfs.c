@@ -0,0 +1,349 @@
+/**
+ * @file bfs.c
+ * @brief Direction-optimizing BFS implementation
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * The visit queue doubles as the sparse frontier: level d occupies
+ * queue[level_start, level_end). Bottom-up steps append their discoveries
+ * in vertex order, so the queue stays grouped by level whichever direction
+ * produced it.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "bfs.h"
+#include "bitset.h"
+#include "task_pool.h"
+
+/* ========================================================================
+ * WORKSPACE
+ * ========================================================================*/
+
+BFSWorkspace *bfs_workspace_create(int node_count, int threads)
+{
+    BFSWorkspace *ws = calloc(1, sizeof(BFSWorkspace));
+    if (!ws)
+        return NULL;
+
+    int slots = node_count > 0 ? node_count : 1;
+    ws->node_count = node_count;
+    ws->words = bitset_words(slots);
+    ws->threads = threads > 0 ? threads : task_pool_default_threads();
+    ws->level = malloc(slots * sizeof(int));
+    ws->queue = malloc(slots * sizeof(int));
+    ws->visited = calloc(ws->words, sizeof(uint64_t));
+    ws->frontier = calloc(ws->words, sizeof(uint64_t));
+    ws->next = calloc(ws->words, sizeof(uint64_t));
+    if (!ws->level || !ws->queue || !ws->visited || !ws->frontier || !ws->next)
+    {
+        bfs_workspace_destroy(ws);
+        return NULL;
+    }
+    for (int v = 0; v < node_count; v++)
+        ws->level[v] = -1;
+    return ws;
+}
+
+void bfs_workspace_destroy(BFSWorkspace *ws)
+{
+    if (!ws)
+        return;
+    free(ws->level);
+    free(ws->queue);
+    free(ws->visited);
+    free(ws->frontier);
+    free(ws->next);
+    free(ws);
+}
+
+/**
+ * @brief Undoes the previous run: only the vertices it reached are touched
+ */
+static void bfs_reset(BFSWorkspace *ws)
+{
+    for (int i = 0; i < ws->reached; i++)
+    {
+        int v = ws->queue[i];
+        ws->level[v] = -1;
+        bitset_clear(ws->visited, v);
+    }
+    ws->reached = 0;
+}
+
+/* ========================================================================
+ * STEPS
+ * ========================================================================*/
+
+static inline int arc_count(const CSRGraph *csr, int v, bool both_rows)
+{
+    int deg = csr->offsets[v + 1] - csr->offsets[v];
+    if (both_rows)
+        deg += csr->in_offsets[v + 1] - csr->in_offsets[v];
+    return deg;
+}
+
+static inline bool is_blocked(const uint64_t *blocked, int v)
+{
+    return blocked && bitset_test(blocked, v);
+}
+
+/**
+ * @brief Expands queue[begin, end) along out-rows (and in-rows when both_rows)
+ *
+ * @return Sum of the arc counts of the new frontier (scout count)
+ */
+static long long top_down_step(BFSWorkspace *ws, const CSRGraph *csr, int begin, int end, int depth,
+                               bool both_rows, const uint64_t *blocked)
+{
+    long long scout = 0;
+    for (int i = begin; i < end; i++)
+    {
+        int u = ws->queue[i];
+        for (int pass = 0; pass < (both_rows ? 2 : 1); pass++)
+        {
+            const int *offsets = pass ? csr->in_offsets : csr->offsets;
+            const int *neighbors = pass ? csr->in_neighbors : csr->neighbors;
+            for (int k = offsets[u]; k < offsets[u + 1]; k++)
+            {
+                int w = neighbors[k];
+                if (!bitset_test(ws->visited, w) && !is_blocked(blocked, w))
+                {
+                    bitset_set(ws->visited, w);
+                    ws->level[w] = depth + 1;
+                    ws->queue[ws->reached++] = w;
+                    scout += arc_count(csr, w, both_rows);
+                }
+            }
+        }
+    }
+    return scout;
+}
+
+typedef struct
+{
+    BFSWorkspace *ws;
+    const CSRGraph *csr;
+    const uint64_t *blocked;
+    int depth;
+    bool use_out_rows;  // Look for parents among out-neighbors
+    bool use_in_rows;   // ... and / or among in-neighbors
+    int word_begin;
+    int word_end;
+    int found;          // Output: vertices discovered in the range
+    long long scout;    // Output: their arc counts
+} BottomUpSlice;
+
+/**
+ * @brief Bottom-up step over the vertices of words [word_begin, word_end)
+ *
+ * Writes only the visited / next words and levels of its own range.
+ */
+static void bottom_up_slice(BottomUpSlice *slice)
+{
+    BFSWorkspace *ws = slice->ws;
+    const CSRGraph *csr = slice->csr;
+    int n = ws->node_count;
+    bool both_rows = slice->use_out_rows && slice->use_in_rows;
+    slice->found = 0;
+    slice->scout = 0;
+
+    for (int w = slice->word_begin; w < slice->word_end; w++)
+    {
+        ws->next[w] = 0;
+        uint64_t candidates = ~ws->visited[w];
+        if (slice->blocked)
+            candidates &= ~slice->blocked[w];
+        if (w == ws->words - 1 && n % BITSET_WORD_BITS)
+            candidates &= ((uint64_t)1 << (n % BITSET_WORD_BITS)) - 1;
+
+        while (candidates)
+        {
+            int v = w * BITSET_WORD_BITS + __builtin_ctzll(candidates);
+            candidates &= candidates - 1;
+
+            bool hit = false;
+            for (int pass = 0; pass < 2 && !hit; pass++)
+            {
+                bool out_row = pass == 0;
+                if ((out_row && !slice->use_out_rows) || (!out_row && !slice->use_in_rows))
+                    continue;
+                const int *offsets = out_row ? csr->offsets : csr->in_offsets;
+                const int *neighbors = out_row ? csr->neighbors : csr->in_neighbors;
+                for (int k = offsets[v]; k < offsets[v + 1]; k++)
+                {
+                    if (bitset_test(ws->frontier, neighbors[k]))
+                    {
+                        hit = true;
+                        break;
+                    }
+                }
+            }
+            if (hit)
+            {
+                ws->next[w] |= (uint64_t)1 << (v & 63);
+                ws->level[v] = slice->depth + 1;
+                slice->found++;
+                slice->scout += arc_count(csr, v, both_rows);
+            }
+        }
+        ws->visited[w] |= ws->next[w];
+    }
+}
+
+static void *bottom_up_main(void *arg)
+{
+    bottom_up_slice(arg);
+    return NULL;
+}
+
+/**
+ * @brief One bottom-up step; appends the discoveries to the queue in vertex order
+ *
+ * @return Number of vertices discovered; *scout receives their arc count
+ */
+static int bottom_up_step(BFSWorkspace *ws, const CSRGraph *csr, int depth, BFSMode mode,
+                          const uint64_t *blocked, long long *scout)
+{
+    // A parent of v in a forward search is an in-neighbor of v
+    bool use_in_rows = csr->is_directed;
+    bool use_out_rows = !csr->is_directed || mode == BFS_WEAK;
+
+    int threads = ws->node_count >= BFS_PARALLEL_MIN_VERTICES ? ws->threads : 1;
+    if (threads > ws->words)
+        threads = ws->words;
+
+    BottomUpSlice local[1];
+    BottomUpSlice *slices = threads > 1 ? malloc(threads * sizeof(BottomUpSlice)) : local;
+    pthread_t *handles = threads > 1 ? malloc(threads * sizeof(pthread_t)) : NULL;
+    if (!slices || (threads > 1 && !handles))
+    {
+        if (slices != local)
+            free(slices);
+        free(handles);
+        slices = local;
+        handles = NULL;
+        threads = 1;
+    }
+
+    int chunk = (ws->words + threads - 1) / threads;
+    for (int t = 0; t < threads; t++)
+    {
+        slices[t] = (BottomUpSlice){ws, csr, blocked, depth, use_out_rows, use_in_rows,
+                                    t * chunk, (t + 1) * chunk < ws->words ? (t + 1) * chunk : ws->words, 0, 0};
+    }
+
+    // Thread t > 0 runs slice t; the caller runs slice 0 and any slice whose thread failed to start
+    bool *started = threads > 1 ? calloc(threads, sizeof(bool)) : NULL;
+    for (int t = 1; t < threads && started; t++)
+        started[t] = pthread_create(&handles[t], NULL, bottom_up_main, &slices[t]) == 0;
+    bottom_up_slice(&slices[0]);
+    for (int t = 1; t < threads; t++)
+    {
+        if (started && started[t])
+            pthread_join(handles[t], NULL);
+        else
+            bottom_up_slice(&slices[t]);
+    }
+
+    int found = 0;
+    *scout = 0;
+    for (int t = 0; t < threads; t++)
+    {
+        found += slices[t].found;
+        *scout += slices[t].scout;
+    }
+    if (slices != local)
+        free(slices);
+    free(handles);
+    free(started);
+
+    // Append discoveries, then make them the dense frontier of the next step
+    for (int w = 0; w < ws->words; w++)
+    {
+        uint64_t bits = ws->next[w];
+        while (bits)
+        {
+            ws->queue[ws->reached++] = w * BITSET_WORD_BITS + __builtin_ctzll(bits);
+            bits &= bits - 1;
+        }
+    }
+    uint64_t *tmp = ws->frontier;
+    ws->frontier = ws->next;
+    ws->next = tmp;
+    return found;
+}
+
+/* ========================================================================
+ * DRIVER
+ * ========================================================================*/
+
+int bfs_run(BFSWorkspace *ws, const CSRGraph *csr, const int *sources, int source_count,
+            BFSMode mode, const uint64_t *blocked)
+{
+    bfs_reset(ws);
+    int n = ws->node_count;
+    bool both_rows = csr->is_directed && mode == BFS_WEAK;
+
+    // Arcs not yet explored: every arc of every vertex that is still unvisited
+    long long unexplored = csr->offsets[n];
+    if (both_rows)
+        unexplored += csr->in_offsets[n];
+
+    long long scout = 0;
+    for (int i = 0; i < source_count; i++)
+    {
+        int s = sources[i];
+        if (bitset_test(ws->visited, s) || is_blocked(blocked, s))
+            continue;
+        bitset_set(ws->visited, s);
+        ws->level[s] = 0;
+        ws->queue[ws->reached++] = s;
+        scout += arc_count(csr, s, both_rows);
+    }
+
+    int level_start = 0, level_end = ws->reached;
+    int depth = 0;
+    bool bottom_up = false;
+    while (level_end > level_start)
+    {
+        int frontier_size = level_end - level_start;
+        unexplored -= scout;
+
+        if (!bottom_up && scout > unexplored / BFS_ALPHA && frontier_size * (long long)BFS_BETA >= n)
+        {
+            // Switch to bottom-up: materialize the sparse frontier as a bitmap
+            memset(ws->frontier, 0, ws->words * sizeof(uint64_t));
+            for (int i = level_start; i < level_end; i++)
+                bitset_set(ws->frontier, ws->queue[i]);
+            bottom_up = true;
+        }
+        else if (bottom_up && frontier_size * (long long)BFS_BETA < n)
+        {
+            // The queue already holds the frontier in sparse form
+            bottom_up = false;
+        }
+
+        if (bottom_up)
+            bottom_up_step(ws, csr, depth, mode, blocked, &scout);
+        else
+            scout = top_down_step(ws, csr, level_start, level_end, depth, both_rows, blocked);
+
+        level_start = level_end;
+        level_end = ws->reached;
+        depth++;
+    }
+    return ws->reached;
+}
+
+int bfs_reach_count(const CSRGraph *csr, int source, BFSMode mode)
+{
+    BFSWorkspace *ws = bfs_workspace_create(csr->node_count, 0);
+    if (!ws)
+        return -1;
+    int reached = bfs_run(ws, csr, &source, 1, mode, NULL);
+    bfs_workspace_destroy(ws);
+    return reached;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file bitset.c
+ * @brief Bit-matrix adjacency construction
+ * @author Graph Theory Project Team
+ * @date 2024
+ */
+
+#include "bitset.h"
+#include "csr_graph.h"
+
+BitMatrix *bitmatrix_create_from_graph(Graph *graph)
+{
+    return bitmatrix_create_ordered(graph, NULL);
+}
+
+BitMatrix *bitmatrix_create_ordered(Graph *graph, const int *order)
+{
+    if (!graph)
+        return NULL;
+
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return NULL;
+
+    BitMatrix *matrix = malloc(sizeof(BitMatrix));
+    if (!matrix)
+        return NULL;
+
+    int n = graph->node_count;
+    int words = bitset_words(n);
+    int stride = (words + BITSET_ROW_ALIGN_WORDS - 1) / BITSET_ROW_ALIGN_WORDS * BITSET_ROW_ALIGN_WORDS;
+    if (stride == 0)
+        stride = BITSET_ROW_ALIGN_WORDS;
+
+    /* aligned_alloc requires the size to be a multiple of the alignment;
+       the stride already guarantees 64-byte multiples per row */
+    size_t bytes = (size_t)(n > 0 ? n : 1) * stride * sizeof(uint64_t);
+    matrix->bits = aligned_alloc(BITSET_ROW_ALIGN_WORDS * sizeof(uint64_t), bytes);
+    if (!matrix->bits)
+    {
+        free(matrix);
+        return NULL;
+    }
+    memset(matrix->bits, 0, bytes);
+    matrix->node_count = n;
+    matrix->words_per_row = stride;
+
+    /* rank[v] = new label of original vertex v */
+    int *rank = NULL;
+    if (order)
+    {
+        rank = malloc((n > 0 ? n : 1) * sizeof(int));
+        for (int i = 0; i < n; i++)
+            rank[order[i]] = i;
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        int u = order ? order[i] : i;
+        uint64_t *row = matrix->bits + (size_t)i * stride;
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+            bitset_set(row, rank ? rank[csr->neighbors[k]] : csr->neighbors[k]);
+    }
+    free(rank);
+    return matrix;
+}
+
+void bitmatrix_destroy(BitMatrix *matrix)
+{
+    if (!matrix)
+        return;
+    free(matrix->bits);
+    free(matrix);
+}
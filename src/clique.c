@@ -1,9 +1,24 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 #include "clique.h"
 #include "set_utils.h"
+#include "bitset.h"
+#include "csr_graph.h"
+#include "task_pool.h"
+#include "components.h"
+#include "graph_stats.h"
+#include "search_budget.h"
+
+/** Block size of the per-search recursion arena (bytes) */
+#define CLIQUE_ARENA_BLOCK_SIZE (256 * 1024)
+
+/** Parallel engines only split off subtrees with at least this many candidates */
+#define CLIQUE_SPLIT_MIN_CANDIDATES 8
 
 /**
  * @file clique.c
@@ -17,6 +32,16 @@
  * Implemented algorithms:
  * 1. Backtracking algorithm: Finds all cliques (may include duplicates)
  * 2. Bron-Kerbosch algorithm: Finds maximal cliques efficiently with pivot selection
+ * 3. Bitset Bron-Kerbosch: Same pivoted recursion with P, S and N(v) kept as
+ *    bitsets, so intersections and pivot scores are word-wise AND + popcount
+ * 4. Degeneracy-ordered Bron-Kerbosch (Eppstein-Löffler-Strash): outer loop in
+ *    degeneracy order over CSR adjacency, so cost depends on degeneracy, not n
+ * 5. Maximum clique branch-and-bound: greedy-coloring upper bounds over a
+ *    renumbered bit matrix, pruning against the incumbent (MCS/BBMC style)
+ * 
+ * Engines 3 and 5 also run on a work-stealing task pool: subtrees are split
+ * off as tasks when a worker is idle, results go to per-worker stores and
+ * the maximum clique search prunes against a shared atomic incumbent size.
  * 
  * Both algorithms use the fundamental sets:
  * - R (or C): Current clique being constructed
@@ -24,46 +49,105 @@
  * - X (or S): Vertices already processed/excluded
  */
 
+/* ============================================================================
+ * RESULT SINK: Where the engines deliver cliques
+ * ============================================================================*/
+
 /**
- * @brief Finds all cliques using recursive backtracking algorithm
- * 
- * This function implements a recursive backtracking approach to enumerate all possible
- * cliques in the graph. The algorithm explores all combinations of vertices and
- * identifies which ones form cliques.
- * 
- * Algorithm Description:
- * 1. If current set C is non-empty, it's a clique - add to results
- * 2. For each candidate vertex v in P:
- *    - Create new candidate set P' = P ∩ N(v) (neighbors of v)
- *    - Create new excluded set S' = S ∩ N(v)
- *    - Recursively search with C ∪ {v}, P', S'
- *    - Move v from P to S for future iterations
+ * @brief Destination of found cliques shared by all engines
+ *
+ * Wraps a visitor callback together with a stop flag. Engines call
+ * clique_sink_emit() for every clique and unwind as soon as the visitor
+ * asks to stop. When several workers share one sink, lock serializes the
+ * visitor calls. Engines also charge every recursion node to the sink's
+ * budget (if any) and unwind the same way once it runs out.
+ */
+typedef struct {
+    CliqueVisitor visit;
+    void *user_data;
+    pthread_mutex_t *lock;  // Non-NULL when the sink is shared between threads
+    SearchBudget *budget;   // NULL for an unlimited search
+    atomic_bool stopped;
+} CliqueSink;
+
+static void clique_sink_init(CliqueSink *sink, CliqueVisitor visit, void *user_data, pthread_mutex_t *lock) {
+    sink->visit = visit;
+    sink->user_data = user_data;
+    sink->lock = lock;
+    sink->budget = NULL;
+    atomic_init(&sink->stopped, false);
+}
+
+static bool clique_sink_stopped(const CliqueSink *sink) {
+    return atomic_load_explicit(&sink->stopped, memory_order_relaxed);
+}
+
+/**
+ * @brief Charges one recursion node to the sink's budget
+ *
+ * @return false once the search has to unwind (budget spent or sink stopped)
+ */
+static bool clique_sink_charge(CliqueSink *sink) {
+    if (!search_budget_charge(sink->budget)) {
+        atomic_store(&sink->stopped, true);
+        return false;
+    }
+    return !clique_sink_stopped(sink);
+}
+
+/**
+ * @brief Hands one clique to the visitor
+ *
+ * @return false once the enumeration has to stop
+ */
+static bool clique_sink_emit(CliqueSink *sink, const int *vertices, int size) {
+    if (sink->lock) {
+        pthread_mutex_lock(sink->lock);
+    }
+    bool keep_going = !clique_sink_stopped(sink) && sink->visit(vertices, size, sink->user_data);
+    if (!keep_going) {
+        atomic_store(&sink->stopped, true);
+    }
+    if (sink->lock) {
+        pthread_mutex_unlock(sink->lock);
+    }
+    return keep_going;
+}
+
+/**
+ * @brief Visitor used by the Set*** wrappers: copies each clique into a SetStore
+ */
+static bool clique_store_visitor(const int *vertices, int size, void *user_data) {
+    set_store_push(user_data, vertices, size);
+    return true;
+}
+
+/**
+ * @brief Backtracking recursion behind find_all_cliques()
  * 
- * Note: This algorithm may find duplicate cliques due to different discovery paths.
- * It's more exhaustive but less efficient than Bron-Kerbosch for maximal cliques.
+ * Temporary P' and S' sets live in the arena and are released in LIFO
+ * order after each branch; every non-empty C is emitted to the sink.
  * 
  * @param graph Pointer to the graph structure
  * @param C Current clique set being constructed
  * @param P Candidate set of vertices that can extend current clique
- * @param S Excluded set of vertices already processed
- * @param all_cliques Pointer to dynamically allocated array of clique pointers
- * @param count Pointer to counter tracking number of cliques found
+ * @param S Excluded set (must have room for |S| + |P| vertices)
+ * @param arena Scratch allocator for recursion frames
+ * @param sink Receives every clique; the search unwinds once it stops
  */
-void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques, int *count) {
+static void all_cliques_recurse(Graph *graph, Set *C, Set *P, Set *S, SetArena *arena, CliqueSink *sink) {
+    if (!clique_sink_charge(sink)) {
+        return;
+    }
+    GRAPH_STAT_INC(GRAPH_STAT_BACKTRACK_CALLS);
+
     /* ========================================================================
      * CLIQUE RECORDING: Store current clique if non-empty
      * ========================================================================*/
     
     // If current set C is non-empty, it represents a valid clique
-    if (C->size > 0) {
-        // Create a new set to store this clique
-        Set *new_clique = set_create(C->size);
-        memcpy(new_clique->vertices, C->vertices, C->size * sizeof(int));
-        new_clique->size = C->size;
-        
-        // Dynamically expand the cliques array
-        (*all_cliques) = realloc(*all_cliques, (*count + 1) * sizeof(Set *));
-        (*all_cliques)[(*count)++] = new_clique;
+    if (C->size > 0 && !clique_sink_emit(sink, C->vertices, C->size)) {
+        return;
     }
 
     /* ========================================================================
@@ -73,13 +157,14 @@ void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques,
     // Try each vertex in the candidate set P
     for (int i = 0; i < P->size; i++) {
         int v = P->vertices[i];
+        SetArenaMark mark = set_arena_mark(arena);
 
         /* ====================================================================
-         * NEIGHBOR INTERSECTION: Create new P and S sets
+         * NEIGHBOR INTERSECTION: Create new P and S sets (arena frames)
          * ====================================================================*/
         
         // Create new candidate set: P' = P ∩ N(v)
-        Set *PP = set_create(P->size);
+        Set *PP = set_arena_create_set(arena, P->size);
         for (int j = 0; j < P->size; j++) {
             int w = P->vertices[j];
             if (graph->adjacency[v][w]) {   // w is neighbor of v
@@ -87,8 +172,8 @@ void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques,
             }
         }
         
-        // Create new excluded set: S' = S ∩ N(v)
-        Set *SS = set_create(S->size);
+        // Create new excluded set: S' = S ∩ N(v) (room for vertices moved from P')
+        Set *SS = set_arena_create_set(arena, S->size + PP->size);
         for (int j = 0; j < S->size; j++) {
             int w = S->vertices[j];
             if (graph->adjacency[v][w]) {   // w is neighbor of v
@@ -104,18 +189,21 @@ void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques,
         set_add(C, v);
         
         // Recurse with extended clique and restricted candidate/excluded sets
-        find_all_cliques(graph, C, PP, SS, all_cliques, count);
+        all_cliques_recurse(graph, C, PP, SS, arena, sink);
         
         // Backtrack: remove v from current clique
         set_remove(C);
+        if (clique_sink_stopped(sink)) {
+            set_arena_release(arena, mark);
+            return;
+        }
 
         /* ====================================================================
          * CLEANUP AND STATE UPDATE: Prepare for next iteration
          * ====================================================================*/
         
-        // Free temporary sets
-        set_destroy(PP);
-        set_destroy(SS);
+        // Pop the temporary sets off the arena
+        set_arena_release(arena, mark);
 
         // Move vertex v from P to S (mark as processed)
         // Remove v from P by shifting remaining elements
@@ -131,42 +219,88 @@ void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques,
 }
 
 /**
- * @brief Finds maximal cliques using Bron-Kerbosch algorithm with pivot selection
+ * @brief Finds all cliques using recursive backtracking algorithm
  * 
- * Implements the Bron-Kerbosch algorithm with pivot heuristic for efficiently finding
- * all maximal cliques. A maximal clique is one that cannot be extended by adding
- * another vertex.
+ * This function implements a recursive backtracking approach to enumerate all possible
+ * cliques in the graph. The algorithm explores all combinations of vertices and
+ * identifies which ones form cliques.
  * 
- * Algorithm with Pivot:
- * 1. If P and S are both empty, C is a maximal clique
- * 2. Choose pivot u ∈ P ∪ S with maximum |N(u) ∩ P|
- * 3. For each v ∈ P \ N(u):
- *    - Recursively call with R ∪ {v}, P ∩ N(v), S ∩ N(v)
- *    - Move v from P to S
+ * Algorithm Description:
+ * 1. If current set C is non-empty, it's a clique - add to results
+ * 2. For each candidate vertex v in P:
+ *    - Create new candidate set P' = P ∩ N(v) (neighbors of v)
+ *    - Create new excluded set S' = S ∩ N(v)
+ *    - Recursively search with C ∪ {v}, P', S'
+ *    - Move v from P to S for future iterations
  * 
- * The pivot selection reduces the branching factor by avoiding vertices
- * that are adjacent to the pivot, leading to significant performance improvements.
+ * Recursion-frame sets come from a per-search SetArena and results are
+ * collected in a chunked SetStore, then appended to the output array once.
+ * Use visit_cliques() with CLIQUE_ENGINE_BACKTRACKING to stream instead.
+ * 
+ * Note: This algorithm may find duplicate cliques due to different discovery paths.
+ * It's more exhaustive but less efficient than Bron-Kerbosch for maximal cliques.
  * 
  * @param graph Pointer to the graph structure
- * @param C Current clique being constructed (R in classical notation)
- * @param P Candidate set of vertices
- * @param S Excluded set of vertices
- * @param maximal_cliques Pointer to array of maximal clique pointers
- * @param count Pointer to counter of maximal cliques found
+ * @param C Current clique set being constructed
+ * @param P Candidate set of vertices that can extend current clique
+ * @param S Excluded set of vertices already processed
+ * @param all_cliques Pointer to dynamically allocated array of clique pointers
+ * @param count Pointer to counter tracking number of cliques found
  */
-void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_cliques, int *count) {
+void find_all_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***all_cliques, int *count) {
+    find_all_cliques_budget(graph, C, P, S, NULL, all_cliques, count);
+}
+
+/**
+ * @brief find_all_cliques() that unwinds once the budget runs out
+ * 
+ * The cliques found before that are kept; C, P and S are left in the state
+ * the recursion was in when it stopped.
+ */
+SearchStatus find_all_cliques_budget(Graph *graph, Set *C, Set *P, Set *S, SearchBudget *budget,
+                                     Set ***all_cliques, int *count) {
+    SetArena arena;
+    SetStore store;
+    CliqueSink sink;
+    set_arena_init(&arena, CLIQUE_ARENA_BLOCK_SIZE);
+    set_store_init(&store);
+    clique_sink_init(&sink, clique_store_visitor, &store, NULL);
+    sink.budget = budget;
+
+    all_cliques_recurse(graph, C, P, S, &arena, &sink);
+
+    set_store_flatten(&store, all_cliques, count);
+    set_arena_destroy(&arena);
+    return search_budget_status(budget);
+}
+
+/**
+ * @brief Pivoted Bron-Kerbosch recursion with arena-backed frames
+ * 
+ * See find_maximal_cliques() for the algorithm. All temporary sets of a
+ * frame (P ∩ N(v), S ∩ N(v) and the candidate list) are carved from the
+ * arena and released in LIFO order when the frame finishes.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param C Current clique being constructed
+ * @param P Candidate set of vertices (must have room for no additions)
+ * @param S Excluded set of vertices (must have room for |S| + |P| vertices)
+ * @param arena Scratch allocator for recursion frames
+ * @param sink Receives maximal cliques; the search unwinds once it stops
+ */
+static void maximal_cliques_recurse(Graph *graph, Set *C, Set *P, Set *S, SetArena *arena, CliqueSink *sink) {
+    if (!clique_sink_charge(sink)) {
+        return;
+    }
+    GRAPH_STAT_INC(GRAPH_STAT_BK_CALLS);
+
     /* ========================================================================
      * BASE CASE: Check for maximal clique
      * ========================================================================*/
     
     // If both P and S are empty, C is a maximal clique
     if (P->size == 0 && S->size == 0) {
-        Set *new_clique = set_create(C->size);
-        memcpy(new_clique->vertices, C->vertices, C->size * sizeof(int));
-        new_clique->size = C->size;
-        
-        (*maximal_cliques) = realloc(*maximal_cliques, (*count + 1) * sizeof(Set *));
-        (*maximal_cliques)[(*count)++] = new_clique;
+        clique_sink_emit(sink, C->vertices, C->size);
         return;
     }
 
@@ -205,21 +339,20 @@ void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_c
      * CANDIDATE SET CONSTRUCTION: P \ N(u)
      * ========================================================================*/
     
-    // Create set P \ N(u) - vertices not adjacent to pivot
-    Set *P_without_Nu = set_create(P->size);
+    SetArenaMark frame_mark = set_arena_mark(arena);
+
+    // Copy candidates P \ N(u) (since we'll modify P during iteration)
+    int *candidates = set_arena_alloc(arena, (P->size > 0 ? P->size : 1) * sizeof(int));
+    int cand_size = 0;
     for (int i = 0; i < P->size; i++) {
         int v = P->vertices[i];
         // Include v if no pivot or v is not adjacent to pivot
         if (u == -1 || !graph->adjacency[u][v]) {
-            set_add(P_without_Nu, v);
+            candidates[cand_size++] = v;
         }
     }
-
-    // Copy candidates for processing (since we'll modify P during iteration)
-    int *candidates = malloc(P_without_Nu->size * sizeof(int));
-    int cand_size = P_without_Nu->size;
-    memcpy(candidates, P_without_Nu->vertices, cand_size * sizeof(int));
-    set_destroy(P_without_Nu);
+    GRAPH_STAT_ADD(GRAPH_STAT_BK_BRANCHES, cand_size);
+    GRAPH_STAT_ADD(GRAPH_STAT_BK_PIVOT_SKIPS, P->size - cand_size);
 
     /* ========================================================================
      * RECURSIVE EXPLORATION: Process each candidate
@@ -227,13 +360,14 @@ void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_c
     
     for (int i = 0; i < cand_size; i++) {
         int v = candidates[i];
+        SetArenaMark mark = set_arena_mark(arena);
 
         /* ====================================================================
          * SET INTERSECTION: Create P ∩ N(v) and S ∩ N(v)
          * ====================================================================*/
         
         // P_intersect_Nv = P ∩ N(v)
-        Set *P_intersect_Nv = set_create(graph->node_count);
+        Set *P_intersect_Nv = set_arena_create_set(arena, P->size);
         for (int j = 0; j < P->size; j++) {
             int w = P->vertices[j];
             if (graph->adjacency[v][w]) {
@@ -241,8 +375,8 @@ void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_c
             }
         }
         
-        // S_intersect_Nv = S ∩ N(v)
-        Set *S_intersect_Nv = set_create(graph->node_count);
+        // S_intersect_Nv = S ∩ N(v), with room for vertices moved from P ∩ N(v)
+        Set *S_intersect_Nv = set_arena_create_set(arena, S->size + P_intersect_Nv->size);
         for (int j = 0; j < S->size; j++) {
             int w = S->vertices[j];
             if (graph->adjacency[v][w]) {
@@ -255,9 +389,15 @@ void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_c
          * ====================================================================*/
         
         set_add(C, v);
-        find_maximal_cliques(graph, C, P_intersect_Nv, S_intersect_Nv, maximal_cliques, count);
+        maximal_cliques_recurse(graph, C, P_intersect_Nv, S_intersect_Nv, arena, sink);
         set_remove(C);
 
+        // Pop the temporary sets off the arena
+        set_arena_release(arena, mark);
+        if (clique_sink_stopped(sink)) {
+            break;
+        }
+
         /* ====================================================================
          * STATE UPDATE: Move v from P to S
          * ====================================================================*/
@@ -273,167 +413,1731 @@ void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_c
         
         // Add v to S
         set_add(S, v);
-
-        // Cleanup temporary sets
-        set_destroy(P_intersect_Nv);
-        set_destroy(S_intersect_Nv);
     }
 
-    free(candidates);
+    set_arena_release(arena, frame_mark);
 }
 
+/* ============================================================================
+ * PER-COMPONENT SEARCH: Independent Bron-Kerbosch runs on a task pool
+ * ============================================================================*/
+
 /**
- * @brief Finds one maximum clique (largest among maximal cliques)
- * 
- * This function finds the maximum clique by first computing all maximal cliques
- * using the Bron-Kerbosch algorithm, then selecting the largest one.
- * 
- * The maximum clique is the largest possible clique in the graph, while
- * maximal cliques are cliques that cannot be extended further.
- * 
- * @param graph Pointer to the graph structure
- * @return Pointer to Set containing vertices of maximum clique, or NULL if none found
+ * @brief One connected component's share of a maximal clique search
  */
-Set *find_maximum_clique(Graph *graph) {
-    /* ========================================================================
-     * INITIALIZATION: Set up algorithm data structures
-     * ========================================================================*/
-    
-    Set **maximal_cliques = NULL;
-    int count = 0;
-
-    // Initialize the three fundamental sets for Bron-Kerbosch
-    Set *C = set_create(graph->node_count);  // Current clique (initially empty)
-    Set *P = set_create(graph->node_count);  // Candidates (initially all vertices)
-    Set *S = set_create(graph->node_count);  // Excluded (initially empty)
+typedef struct {
+    Set *P;                // Candidates inside the component
+    Set *S;                // Excluded vertices inside the component
+    SetStore store;        // Cliques of this component, in discovery order
+    CliqueSink sink;
+} CliqueComponentJob;
 
-    // Add all vertices to candidate set P
-    for (int i = 0; i < graph->node_count; i++) {
-        set_add(P, i);
-    }
+/**
+ * @brief Shared state of a per-component search
+ */
+typedef struct {
+    Graph *graph;
+    SetArena *arenas;      // One recursion arena per worker
+} CliqueComponentRun;
 
-    /* ========================================================================
-     * MAXIMAL CLIQUE COMPUTATION: Find all maximal cliques
-     * ========================================================================*/
-    
-    find_maximal_cliques(graph, C, P, S, &maximal_cliques, &count);
+/**
+ * @brief Task body: runs the pivoted recursion on one component
+ *
+ * The job lives in the caller's job array, which is freed once the pool has
+ * finished, so the task does not free its payload.
+ */
+static void clique_component_task(TaskPool *pool, int worker, void *payload, void *user) {
+    (void)pool;
+    CliqueComponentRun *run = user;
+    CliqueComponentJob *job = payload;
 
-    // Cleanup algorithm sets
+    Set *C = set_create(job->P->size);
+    maximal_cliques_recurse(run->graph, C, job->P, job->S, &run->arenas[worker], &job->sink);
     set_destroy(C);
-    set_destroy(P);
-    set_destroy(S);
+}
 
-    /* ========================================================================
-     * MAXIMUM SELECTION: Find largest maximal clique
-     * ========================================================================*/
-    
-    int max_size = 0;
-    Set *max_clique = NULL;
-    
-    // Find the maximal clique with maximum size
-    for (int i = 0; i < count; i++) {
-        if (maximal_cliques[i]->size > max_size) {
-            max_size = maximal_cliques[i]->size;
-            max_clique = maximal_cliques[i];
+/**
+ * @brief Splits a search from C = ∅ by connected component and runs the parts in parallel
+ *
+ * Every clique lies inside one component, and excluded vertices in a
+ * component without candidates can never block a clique, so the components
+ * holding candidates are searched independently. Results are appended in
+ * component order, which keeps the output independent of scheduling.
+ *
+ * @return false if fewer than two components hold candidates or memory ran
+ *         out before anything was emitted (the caller then searches as a whole)
+ */
+static bool maximal_cliques_by_component(Graph *graph, Set *P, Set *S, SearchBudget *budget,
+                                         Set ***maximal_cliques, int *count) {
+    ComponentLabeling cc;
+    if (P->size < 2 || components_compute(graph, 0, &cc) != 0) {
+        return false;
+    }
+
+    // job_of[c] = job index of component c, -1 while it holds no candidate
+    int *job_of = malloc((cc.count > 0 ? cc.count : 1) * sizeof(int));
+    int job_count = 0;
+    if (job_of) {
+        for (int c = 0; c < cc.count; c++) {
+            job_of[c] = -1;
+        }
+        for (int i = 0; i < P->size; i++) {
+            job_of[cc.label[P->vertices[i]]] = 0;
+        }
+        for (int c = 0; c < cc.count; c++) {
+            if (job_of[c] == 0) {
+                job_of[c] = job_count++;
+            }
         }
     }
+    int workers = task_pool_default_threads();
+    if (workers > job_count) {
+        workers = job_count;
+    }
+    CliqueComponentRun run = {graph, NULL};
+    CliqueComponentJob *jobs = job_count >= 2 ? calloc(job_count, sizeof(CliqueComponentJob)) : NULL;
+    run.arenas = jobs ? malloc(workers * sizeof(SetArena)) : NULL;
+    // Without a pool the jobs run one after another on arenas[0]
+    TaskPool *pool = run.arenas ? task_pool_create(workers, clique_component_task, &run) : NULL;
+    if (!run.arenas) {
+        free(jobs);
+        free(job_of);
+        components_free(&cc);
+        return false;
+    }
+    if (!pool) {
+        workers = 1;
+    }
 
-    /* ========================================================================
-     * CLEANUP: Free all cliques except the maximum one
-     * ========================================================================*/
-    
-    // Free all cliques except the maximum one
-    for (int i = 0; i < count; i++) {
-        if (maximal_cliques[i] != max_clique) {
-            set_destroy(maximal_cliques[i]);
+    for (int c = 0; c < cc.count; c++) {
+        if (job_of[c] != -1) {
+            CliqueComponentJob *job = &jobs[job_of[c]];
+            job->P = set_create(cc.sizes[c]);
+            job->S = set_create(cc.sizes[c]);
+            set_store_init(&job->store);
+            clique_sink_init(&job->sink, clique_store_visitor, &job->store, NULL);
+            job->sink.budget = budget;
+        }
+    }
+    for (int i = 0; i < P->size; i++) {
+        set_add(jobs[job_of[cc.label[P->vertices[i]]]].P, P->vertices[i]);
+    }
+    for (int i = 0; i < S->size; i++) {
+        int job = job_of[cc.label[S->vertices[i]]];
+        if (job != -1) {
+            set_add(jobs[job].S, S->vertices[i]);
         }
     }
-    free(maximal_cliques);
+    free(job_of);
+    components_free(&cc);
 
-    return max_clique; // Caller must free this using set_destroy()
+    for (int w = 0; w < workers; w++) {
+        set_arena_init(&run.arenas[w], CLIQUE_ARENA_BLOCK_SIZE);
+    }
+    if (pool) {
+        for (int j = 0; j < job_count; j++) {
+            task_pool_submit(pool, j % workers, &jobs[j]);
+        }
+        task_pool_run(pool);
+        task_pool_destroy(pool);
+    } else {
+        for (int j = 0; j < job_count; j++) {
+            clique_component_task(NULL, 0, &jobs[j], &run);
+        }
+    }
+
+    for (int j = 0; j < job_count; j++) {
+        set_store_flatten(&jobs[j].store, maximal_cliques, count);
+        set_destroy(jobs[j].P);
+        set_destroy(jobs[j].S);
+    }
+    for (int w = 0; w < workers; w++) {
+        set_arena_destroy(&run.arenas[w]);
+    }
+    free(run.arenas);
+    free(jobs);
+    return true;
 }
 
 /**
- * @brief Analyzes and prints comprehensive clique information
+ * @brief Finds maximal cliques using Bron-Kerbosch algorithm with pivot selection
  * 
- * This convenience function performs complete clique analysis and provides
- * formatted output. It allows choosing between different algorithms and
- * focuses on non-trivial cliques (size ≥ 3).
+ * Implements the Bron-Kerbosch algorithm with pivot heuristic for efficiently finding
+ * all maximal cliques. A maximal clique is one that cannot be extended by adding
+ * another vertex.
+ * 
+ * Algorithm with Pivot:
+ * 1. If P and S are both empty, C is a maximal clique
+ * 2. Choose pivot u ∈ P ∪ S with maximum |N(u) ∩ P|
+ * 3. For each v ∈ P \ N(u):
+ *    - Recursively call with R ∪ {v}, P ∩ N(v), S ∩ N(v)
+ *    - Move v from P to S
+ * 
+ * The pivot selection reduces the branching factor by avoiding vertices
+ * that are adjacent to the pivot, leading to significant performance improvements.
+ * 
+ * Memory: recursion frames are carved from one SetArena per search (no
+ * malloc per recursion node), and results go into a chunked SetStore that
+ * is appended to the output array with a single realloc.
+ * 
+ * Starting from C = ∅ with candidates in several connected components, each
+ * component is searched on its own, in parallel on a task pool; cliques are
+ * then listed component by component.
  * 
  * @param graph Pointer to the graph structure
- * @param algorithm_choice 1 for backtracking (all cliques), 2 for Bron-Kerbosch (maximal)
+ * @param C Current clique being constructed (R in classical notation)
+ * @param P Candidate set of vertices
+ * @param S Excluded set of vertices
+ * @param maximal_cliques Pointer to array of maximal clique pointers
+ * @param count Pointer to counter of maximal cliques found
  */
-void analyze_cliques(Graph *graph, int algorithm_choice) {
-    /* ========================================================================
-     * INITIALIZATION: Set up analysis
-     * ========================================================================*/
-    
-    Set *C = set_create(graph->node_count);
-    Set *P = set_create(graph->node_count);
-    Set *S = set_create(graph->node_count);
-    
-    // Initialize candidate set with all vertices
-    for (int i = 0; i < graph->node_count; i++) {
-        set_add(P, i);
+void find_maximal_cliques(Graph *graph, Set *C, Set *P, Set *S, Set ***maximal_cliques, int *count) {
+    find_maximal_cliques_budget(graph, C, P, S, NULL, maximal_cliques, count);
+}
+
+/**
+ * @brief find_maximal_cliques() that unwinds once the budget runs out
+ * 
+ * Every clique reported is maximal: a node is charged before it can emit,
+ * so a stopped search only loses cliques, it never reports partial ones.
+ * With several components, every component search stops on the shared budget.
+ */
+SearchStatus find_maximal_cliques_budget(Graph *graph, Set *C, Set *P, Set *S, SearchBudget *budget,
+                                         Set ***maximal_cliques, int *count) {
+    if (C->size == 0 && maximal_cliques_by_component(graph, P, S, budget, maximal_cliques, count)) {
+        return search_budget_status(budget);
+    }
+
+    SetArena arena;
+    SetStore store;
+    CliqueSink sink;
+    set_arena_init(&arena, CLIQUE_ARENA_BLOCK_SIZE);
+    set_store_init(&store);
+    clique_sink_init(&sink, clique_store_visitor, &store, NULL);
+    sink.budget = budget;
+
+    maximal_cliques_recurse(graph, C, P, S, &arena, &sink);
+
+    set_store_flatten(&store, maximal_cliques, count);
+    set_arena_destroy(&arena);
+    return search_budget_status(budget);
+}
+
+/**
+ * @brief Per-search state of the bitset Bron-Kerbosch engine
+ *
+ * Each recursion depth owns one frame of three bitsets (P, S and the
+ * branching candidates P \ N(u)). Frames are allocated the first time a
+ * depth is reached and reused afterwards, so the recursion itself performs
+ * no allocation.
+ */
+typedef struct {
+    BitMatrix *adj;        // Bit-packed adjacency rows N(v)
+    int words;             // Words per vertex set
+    uint64_t **frames;     // frames[d] = P | S | candidates at depth d
+    int frame_capacity;    // Length of frames (node_count + 2)
+    int *R;                // Current clique
+    int R_size;
+    CliqueSink *sink;      // Receives maximal cliques (shared by all workers in parallel mode)
+    TaskPool *pool;        // Parallel mode only: pool that split-off subtrees go to
+    int worker;            // Parallel mode only: worker owning this context
+} BitsetBKContext;
+
+/**
+ * @brief Subtree handed to another worker in parallel mode: R, P and S
+ */
+typedef struct {
+    int R_size;
+    uint64_t *sets;        // P | S, stored right after the struct
+    int *R;                // Stored after the sets
+} BitsetBKTask;
+
+/**
+ * @brief Returns the frame for a recursion depth, allocating it on first use
+ */
+static uint64_t *bk_bitset_frame(BitsetBKContext *ctx, int depth) {
+    if (!ctx->frames[depth]) {
+        ctx->frames[depth] = malloc(3 * (size_t)(ctx->words > 0 ? ctx->words : 1) * sizeof(uint64_t));
+    }
+    return ctx->frames[depth];
+}
+
+/**
+ * @brief Prepares a context over a shared bit matrix (sequential mode)
+ */
+static void bk_context_init(BitsetBKContext *ctx, BitMatrix *adj, int n, CliqueSink *sink) {
+    ctx->adj = adj;
+    ctx->words = bitset_words(n);
+    ctx->frame_capacity = n + 2;
+    ctx->frames = calloc(ctx->frame_capacity, sizeof(uint64_t *));
+    ctx->R = malloc((n > 0 ? n : 1) * sizeof(int));
+    ctx->R_size = 0;
+    ctx->sink = sink;
+    ctx->pool = NULL;
+    ctx->worker = 0;
+}
+
+/**
+ * @brief Frees the frames and clique buffer (the matrix and sink are left alone)
+ */
+static void bk_context_release(BitsetBKContext *ctx) {
+    for (int d = 0; d < ctx->frame_capacity; d++) {
+        free(ctx->frames[d]);
+    }
+    free(ctx->frames);
+    free(ctx->R);
+}
+
+/**
+ * @brief Copies R, P and S into a single-allocation task
+ */
+static BitsetBKTask *bk_task_create(int words, const uint64_t *P, const uint64_t *S,
+                                    const int *R, int R_size) {
+    BitsetBKTask *task = malloc(sizeof(BitsetBKTask) + 2 * (size_t)words * sizeof(uint64_t)
+                                + (size_t)R_size * sizeof(int));
+    task->R_size = R_size;
+    task->sets = (uint64_t *)(task + 1);
+    task->R = (int *)(task->sets + 2 * words);
+    memcpy(task->sets, P, words * sizeof(uint64_t));
+    memcpy(task->sets + words, S, words * sizeof(uint64_t));
+    if (R_size > 0) {
+        memcpy(task->R, R, R_size * sizeof(int));
     }
+    return task;
+}
+
+/**
+ * @brief Pivoted Bron-Kerbosch recursion over bitsets
+ *
+ * Works on the frame at the given depth, whose P and S were filled by the
+ * caller. Children get P ∩ N(v) and S ∩ N(v) computed word by word.
+ *
+ * @param ctx Search state
+ * @param depth Current recursion depth (frame index)
+ */
+static void bk_bitset_recurse(BitsetBKContext *ctx, int depth) {
+    int words = ctx->words;
+    uint64_t *P = ctx->frames[depth];
+    uint64_t *S = P + words;
+    uint64_t *cand = S + words;
 
-    Set **cliques = NULL;
-    int count = 0;
-    int max_clique_size = 0;
+    if (!clique_sink_charge(ctx->sink)) {
+        return;
+    }
+    GRAPH_STAT_INC(GRAPH_STAT_BK_CALLS);
 
     /* ========================================================================
-     * CLIQUE COMPUTATION: Run chosen algorithm
+     * BASE CASE: P empty => C is maximal iff S is empty as well
      * ========================================================================*/
-    
-    if (algorithm_choice == 1) {
-        find_all_cliques(graph, C, P, S, &cliques, &count);
-    } else {
-        find_maximal_cliques(graph, C, P, S, &cliques, &count);
-    }
 
-    // Find maximum clique size
-    for (int i = 0; i < count; i++) {
-        if (cliques[i]->size > max_clique_size) {
-            max_clique_size = cliques[i]->size;
+    if (bitset_is_empty(P, words)) {
+        if (bitset_is_empty(S, words)) {
+            clique_sink_emit(ctx->sink, ctx->R, ctx->R_size);
         }
+        return;
     }
 
     /* ========================================================================
-     * RESULTS PRESENTATION: Format and display findings
+     * PIVOT SELECTION: u ∈ P ∪ S maximizing |P ∩ N(u)| via popcount
      * ========================================================================*/
-    
-    printf("\n=== Clique Analysis ===\n");
-    printf("Algorithm used: %s\n", algorithm_choice == 1 ? "Backtracking (all cliques)" : "Bron-Kerbosch (maximal cliques)");
-    printf("Maximum clique size: %d\n", max_clique_size);
-    printf("Total cliques found: %d\n", count);
-    printf("Non-trivial cliques (size ≥ 3):\n");
-    
-    // Display non-trivial cliques
-    int non_trivial_count = 0;
-    for (int i = 0; i < count; i++) {
-        if (cliques[i]->size >= 3) {
-            printf("  Clique %d (size %d): ", ++non_trivial_count, cliques[i]->size);
-            for (int j = 0; j < cliques[i]->size; j++) {
-                printf("%d ", cliques[i]->vertices[j]);
+
+    int p_size = bitset_count(P, words);
+    int u = -1;
+    int best = -1;
+    for (int w = 0; w < words && best < p_size; w++) {
+        uint64_t word = P[w] | S[w];
+        while (word) {
+            int vertex = w * BITSET_WORD_BITS + __builtin_ctzll(word);
+            word &= word - 1;
+            int score = bitset_and_count(P, bitmatrix_row(ctx->adj, vertex), words);
+            if (score > best) {
+                best = score;
+                u = vertex;
+                if (best == p_size) {
+                    break;  // Cannot do better than covering all of P
+                }
             }
-            printf("\n");
         }
     }
-    
-    if (non_trivial_count == 0) {
-        printf("  No non-trivial cliques found (all cliques have size < 3)\n");
-    }
+
+    // Candidates: P \ N(u)
+    bitset_andnot(cand, P, bitmatrix_row(ctx->adj, u), words);
+    GRAPH_STAT_ADD(GRAPH_STAT_BK_PIVOT_SKIPS, best);
+    GRAPH_STAT_ADD(GRAPH_STAT_BK_BRANCHES, p_size - best);
 
     /* ========================================================================
-     * CLEANUP: Free all allocated memory
+     * RECURSIVE EXPLORATION: Branch on each candidate
      * ========================================================================*/
-    
-    for (int i = 0; i < count; i++) {
-        set_destroy(cliques[i]);
-    }
-    free(cliques);
 
-    set_destroy(C);
-    set_destroy(P);
-    set_destroy(S);
-}
\ No newline at end of file
+    uint64_t *child = bk_bitset_frame(ctx, depth + 1);
+    for (int w = 0; w < words; w++) {
+        uint64_t word = cand[w];
+        while (word) {
+            int v = w * BITSET_WORD_BITS + __builtin_ctzll(word);
+            word &= word - 1;
+
+            const uint64_t *Nv = bitmatrix_row(ctx->adj, v);
+            bitset_and(child, P, Nv, words);           // P ∩ N(v)
+            bitset_and(child + words, S, Nv, words);   // S ∩ N(v)
+
+            ctx->R[ctx->R_size++] = v;
+            if (ctx->pool && task_pool_has_idle(ctx->pool)
+                && bitset_count(child, words) >= CLIQUE_SPLIT_MIN_CANDIDATES) {
+                // Someone is starving: hand this subtree over instead of descending
+                task_pool_submit(ctx->pool, ctx->worker,
+                                 bk_task_create(words, child, child + words, ctx->R, ctx->R_size));
+            } else {
+                bk_bitset_recurse(ctx, depth + 1);
+            }
+            ctx->R_size--;
+            if (clique_sink_stopped(ctx->sink)) {
+                return;
+            }
+
+            // Move v from P to S
+            bitset_clear(P, v);
+            bitset_set(S, v);
+        }
+    }
+}
+
+/**
+ * @brief Runs the sequential bitset Bron-Kerbosch engine into a sink
+ */
+static void bitset_bk_enumerate(Graph *graph, CliqueSink *sink) {
+    int n = graph->node_count;
+    if (n == 0) {
+        return;
+    }
+
+    BitMatrix *adj = bitmatrix_create_from_graph(graph);
+    if (!adj) {
+        return;
+    }
+    BitsetBKContext ctx;
+    bk_context_init(&ctx, adj, n, sink);
+
+    // Root frame: P = V, S = ∅
+    uint64_t *root = bk_bitset_frame(&ctx, 0);
+    memset(root, 0, 3 * ctx.words * sizeof(uint64_t));
+    for (int v = 0; v < n; v++) {
+        bitset_set(root, v);
+    }
+
+    bk_bitset_recurse(&ctx, 0);
+
+    bk_context_release(&ctx);
+    bitmatrix_destroy(adj);
+}
+
+/**
+ * @brief Finds all maximal cliques with the bitset Bron-Kerbosch engine
+ *
+ * Equivalent to find_maximal_cliques() started from C = ∅, P = V, S = ∅, but
+ * all set operations run over 64-bit words using a BitMatrix adjacency.
+ *
+ * @param graph Pointer to the graph structure
+ * @param maximal_cliques Pointer to array of maximal clique pointers
+ * @param count Pointer to counter of maximal cliques found
+ */
+void find_maximal_cliques_bitset(Graph *graph, Set ***maximal_cliques, int *count) {
+    SetStore store;
+    CliqueSink sink;
+    set_store_init(&store);
+    clique_sink_init(&sink, clique_store_visitor, &store, NULL);
+
+    bitset_bk_enumerate(graph, &sink);
+    set_store_flatten(&store, maximal_cliques, count);
+}
+
+/**
+ * @brief Task body of the parallel Bron-Kerbosch engine
+ *
+ * Loads the task's R, P and S into the worker's root frame and continues
+ * the ordinary bitset recursion; results go to the worker's sink. Tasks
+ * still queued after the sink stopped are just freed.
+ */
+static void bk_parallel_task(TaskPool *pool, int worker, void *payload, void *user) {
+    (void)pool;
+    BitsetBKContext *ctx = (BitsetBKContext *)user + worker;
+    BitsetBKTask *task = payload;
+
+    if (clique_sink_stopped(ctx->sink)) {
+        free(task);
+        return;
+    }
+
+    uint64_t *root = bk_bitset_frame(ctx, 0);
+    memcpy(root, task->sets, 2 * ctx->words * sizeof(uint64_t));
+    memcpy(ctx->R, task->R, task->R_size * sizeof(int));
+    ctx->R_size = task->R_size;
+    free(task);
+
+    bk_bitset_recurse(ctx, 0);
+}
+
+/**
+ * @brief Runs the bitset engine on a work-stealing pool
+ *
+ * The whole search starts as one root task; whenever a worker is idle, the
+ * running workers turn their next branch into a task, so both top-level
+ * branches and deep subtrees of uneven size get distributed.
+ *
+ * @param graph Pointer to the graph structure
+ * @param workers Number of worker threads (≥ 1)
+ * @param sinks sinks[w] receives the cliques found by worker w; entries may
+ *              alias one shared, locked sink
+ * @return false if the pool could not be set up (nothing was emitted)
+ */
+static bool parallel_bk_enumerate(Graph *graph, int workers, CliqueSink **sinks) {
+    int n = graph->node_count;
+    if (n == 0) {
+        return true;
+    }
+
+    BitsetBKContext *contexts = malloc(workers * sizeof(BitsetBKContext));
+    TaskPool *pool = contexts ? task_pool_create(workers, bk_parallel_task, contexts) : NULL;
+    BitMatrix *adj = pool ? bitmatrix_create_from_graph(graph) : NULL;
+    if (!adj) {
+        task_pool_destroy(pool);
+        free(contexts);
+        return false;
+    }
+
+    for (int w = 0; w < workers; w++) {
+        bk_context_init(&contexts[w], adj, n, sinks[w]);
+        contexts[w].pool = pool;
+        contexts[w].worker = w;
+    }
+
+    // Root task: R = ∅, P = V, S = ∅
+    int words = bitset_words(n);
+    uint64_t *root = calloc(2 * words, sizeof(uint64_t));
+    for (int v = 0; v < n; v++) {
+        bitset_set(root, v);
+    }
+    task_pool_submit(pool, 0, bk_task_create(words, root, root + words, NULL, 0));
+    free(root);
+
+    task_pool_run(pool);
+
+    for (int w = 0; w < workers; w++) {
+        bk_context_release(&contexts[w]);
+    }
+    task_pool_destroy(pool);
+    free(contexts);
+    bitmatrix_destroy(adj);
+    return true;
+}
+
+/**
+ * @brief Finds all maximal cliques with the bitset engine on a work-stealing pool
+ *
+ * Each worker collects into its own SetStore (no locking on the hot path)
+ * and the stores are concatenated at the end, so the clique order varies
+ * between runs.
+ *
+ * @param graph Pointer to the graph structure
+ * @param num_threads Number of worker threads (≤ 0 for all online cores)
+ * @param maximal_cliques Pointer to array of maximal clique pointers
+ * @param count Pointer to counter of maximal cliques found
+ */
+void find_maximal_cliques_parallel(Graph *graph, int num_threads, Set ***maximal_cliques, int *count) {
+    int workers = num_threads > 0 ? num_threads : task_pool_default_threads();
+    SetStore *stores = malloc(workers * sizeof(SetStore));
+    CliqueSink *worker_sinks = malloc(workers * sizeof(CliqueSink));
+    CliqueSink **sinks = malloc(workers * sizeof(CliqueSink *));
+    for (int w = 0; w < workers; w++) {
+        set_store_init(&stores[w]);
+        clique_sink_init(&worker_sinks[w], clique_store_visitor, &stores[w], NULL);
+        sinks[w] = &worker_sinks[w];
+    }
+
+    if (parallel_bk_enumerate(graph, workers, sinks)) {
+        for (int w = 0; w < workers; w++) {
+            set_store_flatten(&stores[w], maximal_cliques, count);
+        }
+    } else {
+        find_maximal_cliques_bitset(graph, maximal_cliques, count);
+    }
+
+    free(sinks);
+    free(worker_sinks);
+    free(stores);
+}
+
+/**
+ * @brief Moves u into the next lower degree bucket (one Batagelj-Zaversnik decrement)
+ */
+static void degeneracy_decrement(int *order, int *pos, int *bin, int *deg, int u) {
+    // Swap u with the first vertex of its bucket, then shrink the bucket
+    int du = deg[u];
+    int pu = pos[u];
+    int pw = bin[du];
+    int w = order[pw];
+    if (u != w) {
+        order[pu] = w;
+        pos[w] = pu;
+        order[pw] = u;
+        pos[u] = pw;
+    }
+    bin[du]++;
+    deg[u]--;
+}
+
+/**
+ * @brief Bucket peeling shared by the ordering of a graph and of its complement
+ * 
+ * For the complement, degrees start at n - 1 - deg(v) and removing v
+ * decrements every remaining vertex that is not a neighbor of v; neighbors
+ * are marked from the CSR row, so no complement structure is built.
+ * 
+ * @param csr CSR view of the graph
+ * @param n Number of vertices
+ * @param complement If true, orders the complement graph
+ * @param order_out Receives vertices in removal order
+ * @param degeneracy_out Receives the degeneracy (may be NULL)
+ */
+static void degeneracy_peel(const CSRGraph *csr, int n, bool complement, int *order_out, int *degeneracy_out) {
+    int max_deg = 0;
+
+    int *deg = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *pos = malloc((n > 0 ? n : 1) * sizeof(int));
+    bool *marked = complement ? calloc(n > 0 ? n : 1, sizeof(bool)) : NULL;
+    for (int v = 0; v < n; v++) {
+        deg[v] = complement ? n - 1 - csr_degree(csr, v) : csr_degree(csr, v);
+        if (deg[v] > max_deg) {
+            max_deg = deg[v];
+        }
+    }
+
+    /* ========================================================================
+     * BUCKET SORT: vertices ordered by degree, bin[d] = first index of degree d
+     * ========================================================================*/
+    
+    int *bin = calloc(max_deg + 2, sizeof(int));
+    for (int v = 0; v < n; v++) {
+        bin[deg[v]]++;
+    }
+    int start = 0;
+    for (int d = 0; d <= max_deg; d++) {
+        int num = bin[d];
+        bin[d] = start;
+        start += num;
+    }
+    for (int v = 0; v < n; v++) {
+        pos[v] = bin[deg[v]];
+        order_out[pos[v]] = v;
+        bin[deg[v]]++;
+    }
+    for (int d = max_deg; d > 0; d--) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+
+    /* ========================================================================
+     * PEELING: take vertices in order, decrement later neighbors in O(1)
+     * ========================================================================*/
+    
+    int degeneracy = 0;
+    for (int i = 0; i < n; i++) {
+        int v = order_out[i];
+        if (deg[v] > degeneracy) {
+            degeneracy = deg[v];
+        }
+        if (!complement) {
+            for (int k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+                int u = csr->neighbors[k];
+                if (deg[u] > deg[v]) {
+                    degeneracy_decrement(order_out, pos, bin, deg, u);
+                }
+            }
+            continue;
+        }
+
+        // Complement neighbors of v: every later vertex outside N(v)
+        for (int k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+            marked[csr->neighbors[k]] = true;
+        }
+        for (int u = 0; u < n; u++) {
+            if (pos[u] > i && !marked[u] && deg[u] > deg[v]) {
+                degeneracy_decrement(order_out, pos, bin, deg, u);
+            }
+        }
+        for (int k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+            marked[csr->neighbors[k]] = false;
+        }
+    }
+
+    if (degeneracy_out) {
+        *degeneracy_out = degeneracy;
+    }
+    free(bin);
+    free(deg);
+    free(pos);
+    free(marked);
+}
+
+/**
+ * @brief Computes a degeneracy ordering with the Batagelj-Zaversnik bucket algorithm
+ * 
+ * Repeatedly removes a vertex of minimum remaining degree. Vertices are kept
+ * in an array sorted by current degree with bucket start indices, so each
+ * removal and each neighbor decrement is O(1) and the whole pass is O(V + E).
+ * 
+ * @param graph Pointer to the graph structure
+ * @param order_out Array of size node_count receiving vertices in removal order
+ * @param degeneracy_out Receives the graph degeneracy (max core number), may be NULL
+ * @return false if the CSR view cannot be built (order_out is then untouched)
+ */
+bool compute_degeneracy_ordering(Graph *graph, int *order_out, int *degeneracy_out) {
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr) {
+        return false;
+    }
+    degeneracy_peel(csr, graph->node_count, false, order_out, degeneracy_out);
+    return true;
+}
+
+/**
+ * @brief Pivoted Bron-Kerbosch recursion over CSR adjacency (list-based sets)
+ * 
+ * P and X are plain arrays carved from the arena; membership in N(v) is
+ * tested by binary search on the sorted CSR row, so no O(n) structure is
+ * touched and memory stays proportional to the current subproblem.
+ * 
+ * @param csr CSR adjacency of the graph
+ * @param R Current clique (stack, grows with depth)
+ * @param r_size Current clique size
+ * @param P Candidate vertices
+ * @param p_size Number of candidates
+ * @param X Excluded vertices (capacity ≥ x_size + p_size)
+ * @param x_size Number of excluded vertices
+ * @param arena Scratch allocator for recursion frames
+ * @param sink Receives maximal cliques; the search unwinds once it stops
+ */
+static void degeneracy_bk_recurse(const CSRGraph *csr, int *R, int r_size,
+                                  int *P, int p_size, int *X, int x_size,
+                                  SetArena *arena, CliqueSink *sink) {
+    if (!clique_sink_charge(sink)) {
+        return;
+    }
+    GRAPH_STAT_INC(GRAPH_STAT_BK_CALLS);
+    if (p_size == 0) {
+        if (x_size == 0) {
+            clique_sink_emit(sink, R, r_size);
+        }
+        return;
+    }
+
+    /* ========================================================================
+     * PIVOT SELECTION: u ∈ P ∪ X maximizing |P ∩ N(u)|
+     * ========================================================================*/
+    
+    int u = -1;
+    int best = -1;
+    for (int list = 0; list < 2 && best < p_size; list++) {
+        int *sel = (list == 0) ? P : X;
+        int sel_size = (list == 0) ? p_size : x_size;
+        for (int i = 0; i < sel_size; i++) {
+            int vertex = sel[i];
+            if (csr_degree(csr, vertex) <= best) {
+                continue;  // Cannot beat the current pivot
+            }
+            int score = 0;
+            for (int j = 0; j < p_size; j++) {
+                if (csr_has_edge(csr, vertex, P[j])) {
+                    score++;
+                }
+            }
+            if (score > best) {
+                best = score;
+                u = vertex;
+                if (best == p_size) {
+                    break;
+                }
+            }
+        }
+    }
+
+    SetArenaMark frame_mark = set_arena_mark(arena);
+
+    // Candidates: P \ N(u)
+    int *candidates = set_arena_alloc(arena, p_size * sizeof(int));
+    int cand_size = 0;
+    for (int i = 0; i < p_size; i++) {
+        if (!csr_has_edge(csr, u, P[i])) {
+            candidates[cand_size++] = P[i];
+        }
+    }
+    GRAPH_STAT_ADD(GRAPH_STAT_BK_BRANCHES, cand_size);
+    GRAPH_STAT_ADD(GRAPH_STAT_BK_PIVOT_SKIPS, p_size - cand_size);
+
+    /* ========================================================================
+     * RECURSIVE EXPLORATION: Branch on each candidate
+     * ========================================================================*/
+    
+    for (int i = 0; i < cand_size; i++) {
+        int v = candidates[i];
+        SetArenaMark mark = set_arena_mark(arena);
+
+        int *newP = set_arena_alloc(arena, p_size * sizeof(int));
+        int new_p = 0;
+        for (int j = 0; j < p_size; j++) {
+            if (csr_has_edge(csr, v, P[j])) {
+                newP[new_p++] = P[j];
+            }
+        }
+        int *newX = set_arena_alloc(arena, (x_size + new_p + 1) * sizeof(int));
+        int new_x = 0;
+        for (int j = 0; j < x_size; j++) {
+            if (csr_has_edge(csr, v, X[j])) {
+                newX[new_x++] = X[j];
+            }
+        }
+
+        R[r_size] = v;
+        degeneracy_bk_recurse(csr, R, r_size + 1, newP, new_p, newX, new_x, arena, sink);
+        set_arena_release(arena, mark);
+        if (clique_sink_stopped(sink)) {
+            break;
+        }
+
+        // Move v from P to X
+        for (int k = 0; k < p_size; k++) {
+            if (P[k] == v) {
+                P[k] = P[--p_size];
+                break;
+            }
+        }
+        X[x_size++] = v;
+    }
+
+    set_arena_release(arena, frame_mark);
+}
+
+/**
+ * @brief Degeneracy-ordered Bron-Kerbosch engine feeding a sink
+ * 
+ * Eppstein-Löffler-Strash algorithm:
+ * 1. Compute a degeneracy ordering v_1, ..., v_n
+ * 2. For each v_i run the pivoted recursion with R = {v_i},
+ *    P = N(v_i) ∩ {v_j : j > i}, X = N(v_i) ∩ {v_j : j < i}
+ * 
+ * Every maximal clique is reported exactly once, from its earliest vertex
+ * in the ordering. Since |P| ≤ d (the degeneracy) at the top level, the
+ * running time is O(d · n · 3^(d/3)) rather than depending on n alone.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param sink Receives maximal cliques
+ */
+static void degeneracy_bk_enumerate(Graph *graph, CliqueSink *sink) {
+    int n = graph->node_count;
+    if (n == 0) {
+        return;
+    }
+
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr) {
+        atomic_store(&sink->stopped, true); // Out of memory: report an incomplete enumeration
+        return;
+    }
+    int *order = malloc(n * sizeof(int));
+    int *position = malloc(n * sizeof(int));
+    degeneracy_peel(csr, n, false, order, NULL);
+    for (int i = 0; i < n; i++) {
+        position[order[i]] = i;
+    }
+
+    SetArena arena;
+    set_arena_init(&arena, CLIQUE_ARENA_BLOCK_SIZE);
+    int *R = malloc(n * sizeof(int));
+
+    /* ========================================================================
+     * OUTER LOOP: one subproblem per vertex in degeneracy order
+     * ========================================================================*/
+    
+    for (int i = 0; i < n && !clique_sink_stopped(sink); i++) {
+        int v = order[i];
+        int deg = csr_degree(csr, v);
+        SetArenaMark mark = set_arena_mark(&arena);
+
+        int *P = set_arena_alloc(&arena, (deg + 1) * sizeof(int));
+        int *X = set_arena_alloc(&arena, (deg + 1) * sizeof(int));
+        int p_size = 0, x_size = 0;
+        for (int k = csr->offsets[v]; k < csr->offsets[v + 1]; k++) {
+            int w = csr->neighbors[k];
+            if (position[w] > i) {
+                P[p_size++] = w;
+            } else {
+                X[x_size++] = w;
+            }
+        }
+
+        R[0] = v;
+        degeneracy_bk_recurse(csr, R, 1, P, p_size, X, x_size, &arena, sink);
+        set_arena_release(&arena, mark);
+    }
+
+    set_arena_destroy(&arena);
+    free(R);
+    free(order);
+    free(position);
+}
+
+/**
+ * @brief Finds all maximal cliques with degeneracy-ordered Bron-Kerbosch
+ * 
+ * Collects the output of the Eppstein-Löffler-Strash engine into an array.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param maximal_cliques Pointer to array of maximal clique pointers
+ * @param count Pointer to counter of maximal cliques found
+ */
+void find_maximal_cliques_degeneracy(Graph *graph, Set ***maximal_cliques, int *count) {
+    SetStore store;
+    CliqueSink sink;
+    set_store_init(&store);
+    clique_sink_init(&sink, clique_store_visitor, &store, NULL);
+
+    degeneracy_bk_enumerate(graph, &sink);
+    set_store_flatten(&store, maximal_cliques, count);
+}
+
+/**
+ * @brief Incumbent shared by all workers of the parallel maximum clique search
+ *
+ * best_size is read without locking on every bound check; the lock only
+ * serializes improvements so that best always holds a clique of that size.
+ */
+typedef struct {
+    atomic_int best_size;
+    pthread_mutex_t lock;
+    int *best;             // Renumbered labels of the incumbent
+    TaskPool *pool;
+} MaxCliqueShared;
+
+/**
+ * @brief Per-search state of the coloring-bound maximum clique solver
+ *
+ * Vertices are renumbered so that bit i of every set is vertex order[i] of
+ * the original graph; the initial order is the reverse degeneracy ordering.
+ * Each depth owns a candidate bitset plus a branching list and its color
+ * bounds; only the current and the best clique are kept, so result memory
+ * is O(n) regardless of how many maximal cliques exist.
+ */
+typedef struct {
+    BitMatrix *adj;        // Renumbered bit-packed adjacency rows
+    bool complement;       // Search the complement of adj (rows negated on the fly)
+    int words;             // Words per vertex set
+    int n;
+    uint64_t **frames;     // frames[d] = candidate set P at depth d
+    int **branch;          // branch[d] = vertices of P in increasing color order
+    int **color;           // color[d][i] = greedy color (upper bound) of branch[d][i]
+    int frame_capacity;
+    uint64_t *uncolored;   // Coloring scratch: vertices not yet colored
+    uint64_t *color_class; // Coloring scratch: vertices still allowed in the current color
+    int *current;          // Current clique (renumbered labels)
+    int current_size;
+    int *best;             // Incumbent (renumbered labels), sequential mode
+    int best_size;
+    MaxCliqueShared *shared; // Parallel mode only: shared incumbent and pool
+    int worker;            // Parallel mode only: worker owning this context
+    SearchBudget *budget;  // Sequential mode only, NULL for an unlimited search
+    int open_bound;        // Largest bound of a subtree left unexplored by the budget
+} MaxCliqueContext;
+
+/**
+ * @brief Subtree handed to another worker: clique C, candidates P and its bound
+ */
+typedef struct {
+    int bound;             // |C| - 1 + color of the last vertex of C when split off
+    int C_size;
+    uint64_t *P;           // Stored right after the struct
+    int *C;                // Stored after P
+} MaxCliqueTask;
+
+/**
+ * @brief Allocates the per-depth tables and scratch sets (sequential mode)
+ */
+static void max_clique_context_init(MaxCliqueContext *ctx, BitMatrix *adj, int n) {
+    ctx->adj = adj;
+    ctx->complement = false;
+    ctx->n = n;
+    ctx->words = bitset_words(n);
+    ctx->frame_capacity = n + 2;
+    ctx->frames = calloc(ctx->frame_capacity, sizeof(uint64_t *));
+    ctx->branch = calloc(ctx->frame_capacity, sizeof(int *));
+    ctx->color = calloc(ctx->frame_capacity, sizeof(int *));
+    ctx->uncolored = malloc(ctx->words * sizeof(uint64_t));
+    ctx->color_class = malloc(ctx->words * sizeof(uint64_t));
+    ctx->current = malloc(n * sizeof(int));
+    ctx->best = malloc(n * sizeof(int));
+    ctx->current_size = 0;
+    ctx->best_size = 0;
+    ctx->shared = NULL;
+    ctx->worker = 0;
+    ctx->budget = NULL;
+    ctx->open_bound = 0;
+}
+
+/**
+ * @brief Frees everything allocated by max_clique_context_init()
+ */
+static void max_clique_context_release(MaxCliqueContext *ctx) {
+    for (int d = 0; d < ctx->frame_capacity; d++) {
+        free(ctx->frames[d]);
+        free(ctx->branch[d]);
+        free(ctx->color[d]);
+    }
+    free(ctx->frames);
+    free(ctx->branch);
+    free(ctx->color);
+    free(ctx->uncolored);
+    free(ctx->color_class);
+    free(ctx->current);
+    free(ctx->best);
+}
+
+/**
+ * @brief Returns the frame for a recursion depth, allocating it on first use
+ */
+static uint64_t *max_clique_frame(MaxCliqueContext *ctx, int depth) {
+    if (!ctx->frames[depth]) {
+        ctx->frames[depth] = malloc((size_t)(ctx->words > 0 ? ctx->words : 1) * sizeof(uint64_t));
+        ctx->branch[depth] = malloc(ctx->n * sizeof(int));
+        ctx->color[depth] = malloc(ctx->n * sizeof(int));
+    }
+    return ctx->frames[depth];
+}
+
+/**
+ * @brief dst = P ∩ N(v) in the searched graph
+ *
+ * For the complement, N(v) is the negated row without v itself; P never
+ * holds padding bits, so the negation needs no further masking.
+ */
+static void max_clique_neighbors(const MaxCliqueContext *ctx, uint64_t *dst, const uint64_t *P, int v) {
+    if (!ctx->complement) {
+        bitset_and(dst, P, bitmatrix_row(ctx->adj, v), ctx->words);
+        return;
+    }
+    bitset_andnot(dst, P, bitmatrix_row(ctx->adj, v), ctx->words);
+    bitset_clear(dst, v);
+}
+
+/**
+ * @brief Adjacency test in the searched graph (u ≠ v)
+ */
+static bool max_clique_adjacent(const MaxCliqueContext *ctx, int u, int v) {
+    return bitset_test(bitmatrix_row(ctx->adj, u), v) != ctx->complement;
+}
+
+/**
+ * @brief Size of the best clique known to this search (shared in parallel mode)
+ */
+static int max_clique_incumbent(const MaxCliqueContext *ctx) {
+    if (ctx->shared) {
+        return atomic_load_explicit(&ctx->shared->best_size, memory_order_relaxed);
+    }
+    return ctx->best_size;
+}
+
+/**
+ * @brief Makes the current clique the incumbent if it is larger
+ */
+static void max_clique_record(MaxCliqueContext *ctx) {
+    if (!ctx->shared) {
+        if (ctx->current_size > ctx->best_size) {
+            ctx->best_size = ctx->current_size;
+            memcpy(ctx->best, ctx->current, ctx->current_size * sizeof(int));
+        }
+        return;
+    }
+
+    MaxCliqueShared *shared = ctx->shared;
+    pthread_mutex_lock(&shared->lock);
+    if (ctx->current_size > atomic_load(&shared->best_size)) {
+        memcpy(shared->best, ctx->current, ctx->current_size * sizeof(int));
+        atomic_store(&shared->best_size, ctx->current_size);
+    }
+    pthread_mutex_unlock(&shared->lock);
+}
+
+/**
+ * @brief Greedy sequential coloring of P used as the branching bound
+ *
+ * Colors classes one at a time: a class takes the lowest-numbered uncolored
+ * vertex and repeatedly removes its neighbors from the class candidates.
+ * Vertices whose color k could not lift the current clique above the
+ * incumbent (|C| + k ≤ best) are never branched on, so they are skipped
+ * from the list; the remaining ones appear in nondecreasing color order.
+ *
+ * @return Number of vertices written to the branching list
+ */
+static int max_clique_color(MaxCliqueContext *ctx, const uint64_t *P, int *branch, int *color) {
+    int words = ctx->words;
+    uint64_t *U = ctx->uncolored;
+    uint64_t *Q = ctx->color_class;
+    int k_min = max_clique_incumbent(ctx) - ctx->current_size + 1;
+    int listed = 0;
+
+    memcpy(U, P, words * sizeof(uint64_t));
+    for (int k = 1; !bitset_is_empty(U, words); k++) {
+        memcpy(Q, U, words * sizeof(uint64_t));
+        for (int w = 0; w < words; w++) {
+            while (Q[w]) {
+                int v = w * BITSET_WORD_BITS + __builtin_ctzll(Q[w]);
+                bitset_clear(U, v);
+                bitset_clear(Q, v);
+                // Later vertices in this class must be non-adjacent to v
+                const uint64_t *row = bitmatrix_row(ctx->adj, v) + w;
+                if (ctx->complement) {
+                    bitset_and(Q + w, Q + w, row, words - w);
+                } else {
+                    bitset_andnot(Q + w, Q + w, row, words - w);
+                }
+                if (k >= k_min) {
+                    branch[listed] = v;
+                    color[listed] = k;
+                    listed++;
+                }
+            }
+        }
+    }
+    return listed;
+}
+
+/**
+ * @brief Copies C and P into a single-allocation task
+ */
+static MaxCliqueTask *max_clique_task_create(int words, int bound, const uint64_t *P,
+                                             const int *C, int C_size) {
+    MaxCliqueTask *task = malloc(sizeof(MaxCliqueTask) + (size_t)words * sizeof(uint64_t)
+                                 + (size_t)C_size * sizeof(int));
+    task->bound = bound;
+    task->C_size = C_size;
+    task->P = (uint64_t *)(task + 1);
+    task->C = (int *)(task->P + words);
+    memcpy(task->P, P, words * sizeof(uint64_t));
+    if (C_size > 0) {
+        memcpy(task->C, C, C_size * sizeof(int));
+    }
+    return task;
+}
+
+/**
+ * @brief Branch-and-bound recursion (Tomita MCQ/MCS with bitsets, BBMC style)
+ *
+ * Branches on the candidates from the highest color down; as soon as
+ * |C| + color(v) ≤ |best| no remaining candidate can improve the
+ * incumbent and the whole subtree is cut. In parallel mode a branch is
+ * submitted as a task instead when another worker is idle.
+ *
+ * When the budget runs out the recursion unwinds, and every level records
+ * in open_bound what it leaves unexplored: the node itself if it never got
+ * to color, otherwise its remaining (lower-colored) branches. The largest
+ * such bound, or the incumbent, bounds ω from above.
+ *
+ * @param ctx Search state
+ * @param depth Current recursion depth (frame index)
+ * @param node_bound Upper bound on any clique in this subtree
+ */
+static void max_clique_expand(MaxCliqueContext *ctx, int depth, int node_bound) {
+    int words = ctx->words;
+    uint64_t *P = ctx->frames[depth];
+    int *branch = ctx->branch[depth];
+    int *color = ctx->color[depth];
+    if (!search_budget_charge(ctx->budget)) {
+        ctx->open_bound = node_bound > ctx->open_bound ? node_bound : ctx->open_bound;
+        return;
+    }
+    GRAPH_STAT_INC(GRAPH_STAT_MAX_CLIQUE_NODES);
+
+    int listed = max_clique_color(ctx, P, branch, color);
+    uint64_t *child = max_clique_frame(ctx, depth + 1);
+
+    for (int i = listed - 1; i >= 0; i--) {
+        int bound = ctx->current_size + color[i];
+        if (bound <= max_clique_incumbent(ctx)) {
+            GRAPH_STAT_INC(GRAPH_STAT_MAX_CLIQUE_PRUNES);
+            return;  // Bound: colors are nondecreasing, nothing left can win
+        }
+        int v = branch[i];
+        ctx->current[ctx->current_size++] = v;
+        max_clique_neighbors(ctx, child, P, v);
+
+        if (bitset_is_empty(child, words)) {
+            max_clique_record(ctx);
+        } else if (ctx->shared && task_pool_has_idle(ctx->shared->pool)
+                   && bitset_count(child, words) >= CLIQUE_SPLIT_MIN_CANDIDATES) {
+            task_pool_submit(ctx->shared->pool, ctx->worker,
+                             max_clique_task_create(words, bound, child, ctx->current, ctx->current_size));
+        } else {
+            max_clique_expand(ctx, depth + 1, bound);
+        }
+
+        ctx->current_size--;
+        if (search_budget_spent(ctx->budget)) {
+            // Siblings left: colors are nondecreasing, so branch i - 1 bounds them all
+            int rest = i > 0 ? ctx->current_size + color[i - 1] : 0;
+            rest = rest < node_bound ? rest : node_bound;
+            ctx->open_bound = rest > ctx->open_bound ? rest : ctx->open_bound;
+            return;
+        }
+        bitset_clear(P, v);
+    }
+}
+
+/**
+ * @brief Reverse degeneracy order (of the graph or its complement): innermost core first
+ *
+ * @return Newly allocated permutation (order[i] = original vertex at rank i),
+ *         or NULL if the CSR view cannot be built
+ */
+static int *max_clique_initial_order(Graph *graph, bool complement, int *degeneracy) {
+    int n = graph->node_count;
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr) {
+        return NULL;
+    }
+    int *removal = malloc(n * sizeof(int));
+    int *order = malloc(n * sizeof(int));
+    degeneracy_peel(csr, n, complement, removal, degeneracy);
+    for (int i = 0; i < n; i++) {
+        order[i] = removal[n - 1 - i];  // Last-removed (innermost core) first
+    }
+    free(removal);
+    return order;
+}
+
+/**
+ * @brief Seeds the incumbent with a greedy clique along the renumbered order
+ */
+static void max_clique_greedy(MaxCliqueContext *ctx) {
+    for (int v = 0; v < ctx->n; v++) {
+        bool adjacent_to_all = true;
+        for (int i = 0; i < ctx->best_size && adjacent_to_all; i++) {
+            adjacent_to_all = max_clique_adjacent(ctx, v, ctx->best[i]);
+        }
+        if (adjacent_to_all) {
+            ctx->best[ctx->best_size++] = v;
+        }
+    }
+}
+
+/**
+ * @brief Maps renumbered labels back to original vertices
+ */
+static Set *max_clique_result(const int *best, int best_size, const int *order) {
+    Set *max_clique = set_create(best_size > 0 ? best_size : 1);
+    for (int i = 0; i < best_size; i++) {
+        set_add(max_clique, order[best[i]]);
+    }
+    return max_clique;
+}
+
+/**
+ * @brief Finds one maximum clique with a coloring-bound branch-and-bound search
+ * 
+ * Algorithm (MCS/BBMC family):
+ * 1. Order vertices by reverse degeneracy and renumber the bit matrix so that
+ *    greedy coloring scans high-core vertices first
+ * 2. Seed the incumbent with a greedy clique along that order; stop at once
+ *    if it already meets the degeneracy bound d + 1
+ * 3. Recurse with greedy-coloring upper bounds, pruning every branch that
+ *    cannot beat the incumbent
+ * 
+ * Unlike enumerating all maximal cliques, only the current and best cliques
+ * are stored, and most of the search space is cut by the bounds.
+ * 
+ * With complement set, the bit matrix still holds the rows of graph and
+ * every row access negates them word by word (see max_clique_neighbors()),
+ * so the complement graph is never stored.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param complement If true, searches the complement of graph
+ * @param budget Search budget, or NULL to search to the end
+ * @param upper_bound_out Receives a proven upper bound on the clique number
+ *                        (the result size unless the budget ran out)
+ * @return Pointer to Set containing vertices of maximum clique, or NULL if none found
+ */
+static Set *max_clique_search(Graph *graph, bool complement, SearchBudget *budget, int *upper_bound_out) {
+    /* ========================================================================
+     * INITIALIZATION: Initial ordering and renumbered adjacency
+     * ========================================================================*/
+    
+    int n = graph->node_count;
+    *upper_bound_out = n;
+    if (n == 0) {
+        return NULL;
+    }
+
+    int degeneracy = 0;
+    int *order = max_clique_initial_order(graph, complement, &degeneracy);
+    BitMatrix *adj = order ? bitmatrix_create_ordered(graph, order) : NULL;
+    if (!adj) {
+        free(order);
+        return NULL;
+    }
+    MaxCliqueContext ctx;
+    max_clique_context_init(&ctx, adj, n);
+    ctx.complement = complement;
+    ctx.budget = budget;
+
+    /* ========================================================================
+     * INITIAL INCUMBENT: Greedy clique along the ordering
+     * ========================================================================*/
+    
+    max_clique_greedy(&ctx);
+
+    /* ========================================================================
+     * SEARCH: Skip entirely when the greedy clique meets the d + 1 bound
+     * ========================================================================*/
+    
+    if (ctx.best_size < degeneracy + 1) {
+        uint64_t *root = max_clique_frame(&ctx, 0);
+        memset(root, 0, ctx.words * sizeof(uint64_t));
+        for (int v = 0; v < n; v++) {
+            bitset_set(root, v);
+        }
+        max_clique_expand(&ctx, 0, degeneracy + 1);
+    }
+
+    /* ========================================================================
+     * RESULT: Map renumbered labels back to original vertices
+     * ========================================================================*/
+    
+    Set *max_clique = max_clique_result(ctx.best, ctx.best_size, order);
+    *upper_bound_out = ctx.open_bound > ctx.best_size ? ctx.open_bound : ctx.best_size;
+
+    max_clique_context_release(&ctx);
+    free(order);
+    bitmatrix_destroy(adj);
+
+    return max_clique; // Caller must free this using set_destroy()
+}
+
+Set *find_maximum_clique(Graph *graph) {
+    int upper_bound;
+    return max_clique_search(graph, false, NULL, &upper_bound);
+}
+
+Set *find_maximum_clique_complement(Graph *graph) {
+    int upper_bound;
+    return max_clique_search(graph, true, NULL, &upper_bound);
+}
+
+/**
+ * @brief find_maximum_clique() with a budget: the incumbent plus a proven bound
+ * 
+ * A search that stops with no open subtree bound above the incumbent has
+ * still proven it maximum and reports SEARCH_COMPLETE.
+ */
+MaxCliqueResult find_maximum_clique_budget(Graph *graph, SearchBudget *budget) {
+    MaxCliqueResult result = {SEARCH_COMPLETE, NULL, 0};
+    result.clique = max_clique_search(graph, false, budget, &result.upper_bound);
+    int size = result.clique ? result.clique->size : 0;
+    if (result.upper_bound > size) {
+        result.status = search_budget_status(budget);
+    }
+    return result;
+}
+
+/**
+ * @brief Task body of the parallel maximum clique search
+ *
+ * Drops the task outright if its bound no longer beats the shared
+ * incumbent; otherwise restores C and P and continues the recursion.
+ */
+static void max_clique_parallel_task(TaskPool *pool, int worker, void *payload, void *user) {
+    (void)pool;
+    MaxCliqueContext *ctx = (MaxCliqueContext *)user + worker;
+    MaxCliqueTask *task = payload;
+
+    if (task->bound > max_clique_incumbent(ctx)) {
+        uint64_t *root = max_clique_frame(ctx, 0);
+        memcpy(root, task->P, ctx->words * sizeof(uint64_t));
+        if (task->C_size > 0) {
+            memcpy(ctx->current, task->C, task->C_size * sizeof(int));
+        }
+        ctx->current_size = task->C_size;
+        max_clique_expand(ctx, 0, task->bound);
+    }
+    free(task);
+}
+
+/**
+ * @brief Finds one maximum clique with the branch-and-bound search on a work-stealing pool
+ * 
+ * Same ordering, greedy seed and coloring bounds as find_maximum_clique().
+ * The search starts as one root task and branches are split off whenever a
+ * worker is idle; every worker prunes against a shared atomic incumbent
+ * size, so an improvement found by one thread immediately tightens the
+ * bounds of all others.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param num_threads Number of worker threads (≤ 0 for all online cores)
+ * @return Pointer to Set containing vertices of maximum clique, or NULL if none found
+ */
+Set *find_maximum_clique_parallel(Graph *graph, int num_threads) {
+    int n = graph->node_count;
+    if (n == 0) {
+        return NULL;
+    }
+
+    int degeneracy = 0;
+    int *order = max_clique_initial_order(graph, false, &degeneracy);
+    BitMatrix *adj = order ? bitmatrix_create_ordered(graph, order) : NULL;
+    if (!adj) {
+        free(order);
+        return NULL;
+    }
+
+    // The seed context holds the greedy incumbent and later the shared best array
+    MaxCliqueContext seed;
+    max_clique_context_init(&seed, adj, n);
+    max_clique_greedy(&seed);
+
+    if (seed.best_size < degeneracy + 1) {
+        int workers = num_threads > 0 ? num_threads : task_pool_default_threads();
+        MaxCliqueContext *contexts = malloc(workers * sizeof(MaxCliqueContext));
+        MaxCliqueShared shared;
+        atomic_init(&shared.best_size, seed.best_size);
+        pthread_mutex_init(&shared.lock, NULL);
+        shared.best = seed.best;
+        shared.pool = contexts ? task_pool_create(workers, max_clique_parallel_task, contexts) : NULL;
+
+        if (shared.pool) {
+            for (int w = 0; w < workers; w++) {
+                max_clique_context_init(&contexts[w], adj, n);
+                contexts[w].shared = &shared;
+                contexts[w].worker = w;
+            }
+
+            uint64_t *root = calloc(seed.words > 0 ? seed.words : 1, sizeof(uint64_t));
+            for (int v = 0; v < n; v++) {
+                bitset_set(root, v);
+            }
+            task_pool_submit(shared.pool, 0, max_clique_task_create(seed.words, INT_MAX, root, NULL, 0));
+            free(root);
+
+            task_pool_run(shared.pool);
+            seed.best_size = atomic_load(&shared.best_size);
+
+            for (int w = 0; w < workers; w++) {
+                max_clique_context_release(&contexts[w]);
+            }
+            task_pool_destroy(shared.pool);
+        } else {
+            // No pool: fall back to the sequential search on the seed context
+            uint64_t *root = max_clique_frame(&seed, 0);
+            memset(root, 0, seed.words * sizeof(uint64_t));
+            for (int v = 0; v < n; v++) {
+                bitset_set(root, v);
+            }
+            max_clique_expand(&seed, 0, degeneracy + 1);
+        }
+        pthread_mutex_destroy(&shared.lock);
+        free(contexts);
+    }
+
+    Set *max_clique = max_clique_result(seed.best, seed.best_size, order);
+
+    max_clique_context_release(&seed);
+    free(order);
+    bitmatrix_destroy(adj);
+
+    return max_clique;
+}
+
+/* ============================================================================
+ * STREAMING API: Visitors, counting and top-k collection
+ * ============================================================================*/
+
+/**
+ * @brief Streams cliques from the chosen engine to a visitor
+ * 
+ * Nothing is materialized: each clique is passed to the visitor as a
+ * transient vertex array that is only valid during the call. Memory is the
+ * engine's recursion state (O(depth) frames) plus whatever the visitor keeps.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param engine Enumeration engine
+ * @param visitor Called once per clique; return false to stop early
+ * @param user_data Forwarded to the visitor
+ * @return true if the enumeration ran to completion, false if it was stopped
+ */
+bool visit_cliques(Graph *graph, CliqueEngine engine, CliqueVisitor visitor, void *user_data) {
+    return visit_cliques_budget(graph, engine, NULL, visitor, user_data);
+}
+
+/**
+ * @brief visit_cliques() that unwinds once the budget runs out
+ * 
+ * @return true if the enumeration ran to completion; search_budget_status()
+ *         tells whether a false came from the budget or from the visitor
+ */
+bool visit_cliques_budget(Graph *graph, CliqueEngine engine, SearchBudget *budget,
+                          CliqueVisitor visitor, void *user_data) {
+    CliqueSink sink;
+    clique_sink_init(&sink, visitor, user_data, NULL);
+    sink.budget = budget;
+    int n = graph->node_count;
+
+    switch (engine) {
+    case CLIQUE_ENGINE_BACKTRACKING: {
+        Set *C = set_create(n > 0 ? n : 1);
+        Set *P = set_create(n > 0 ? n : 1);
+        Set *S = set_create(n > 0 ? n : 1);
+        for (int v = 0; v < n; v++) {
+            set_add(P, v);
+        }
+        SetArena arena;
+        set_arena_init(&arena, CLIQUE_ARENA_BLOCK_SIZE);
+        all_cliques_recurse(graph, C, P, S, &arena, &sink);
+        set_arena_destroy(&arena);
+        set_destroy(C);
+        set_destroy(P);
+        set_destroy(S);
+        break;
+    }
+    case CLIQUE_ENGINE_DEGENERACY:
+        degeneracy_bk_enumerate(graph, &sink);
+        break;
+    case CLIQUE_ENGINE_PARALLEL: {
+        // One locked sink shared by all workers keeps the visitor single-threaded
+        pthread_mutex_t lock;
+        pthread_mutex_init(&lock, NULL);
+        sink.lock = &lock;
+        int workers = task_pool_default_threads();
+        CliqueSink **sinks = malloc(workers * sizeof(CliqueSink *));
+        for (int w = 0; w < workers; w++) {
+            sinks[w] = &sink;
+        }
+        bool ran = parallel_bk_enumerate(graph, workers, sinks);
+        free(sinks);
+        sink.lock = NULL;
+        pthread_mutex_destroy(&lock);
+        if (!ran) {
+            bitset_bk_enumerate(graph, &sink);
+        }
+        break;
+    }
+    case CLIQUE_ENGINE_BITSET:
+    default:
+        bitset_bk_enumerate(graph, &sink);
+        break;
+    }
+    return !clique_sink_stopped(&sink);
+}
+
+/**
+ * @brief Visitor behind count_cliques()
+ */
+static bool clique_count_visitor(const int *vertices, int size, void *user_data) {
+    (void)vertices;
+    CliqueCounts *counts = user_data;
+    counts->count++;
+    if (size > counts->max_size) {
+        counts->max_size = size;
+    }
+    return true;
+}
+
+/**
+ * @brief Counts cliques and records the largest size without storing any
+ * 
+ * @param graph Pointer to the graph structure
+ * @param engine Enumeration engine
+ * @return Number of cliques visited and the maximum size among them
+ */
+CliqueCounts count_cliques(Graph *graph, CliqueEngine engine) {
+    return count_cliques_budget(graph, engine, NULL);
+}
+
+CliqueCounts count_cliques_budget(Graph *graph, CliqueEngine engine, SearchBudget *budget) {
+    CliqueCounts counts = {0, 0};
+    visit_cliques_budget(graph, engine, budget, clique_count_visitor, &counts);
+    return counts;
+}
+
+/**
+ * @brief State of collect_largest_cliques(): a min-heap of sets keyed by size
+ */
+typedef struct {
+    Set **items;
+    int count;
+    int capacity;
+    int k;          // Heap bound, ≤ 0 for unbounded
+    int min_size;
+} CliqueTopK;
+
+static void top_k_sift_down(CliqueTopK *top, int i) {
+    for (;;) {
+        int smallest = i;
+        int l = 2 * i + 1, r = 2 * i + 2;
+        if (l < top->count && top->items[l]->size < top->items[smallest]->size) {
+            smallest = l;
+        }
+        if (r < top->count && top->items[r]->size < top->items[smallest]->size) {
+            smallest = r;
+        }
+        if (smallest == i) {
+            return;
+        }
+        Set *tmp = top->items[i];
+        top->items[i] = top->items[smallest];
+        top->items[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+static Set *top_k_copy(const int *vertices, int size) {
+    Set *copy = set_create(size > 0 ? size : 1);
+    memcpy(copy->vertices, vertices, size * sizeof(int));
+    copy->size = size;
+    return copy;
+}
+
+/**
+ * @brief Visitor behind collect_largest_cliques()
+ *
+ * Keeps at most k cliques; a new clique replaces the smallest one kept only
+ * if it is strictly larger, so memory stays O(k · ω).
+ */
+static bool clique_top_k_visitor(const int *vertices, int size, void *user_data) {
+    CliqueTopK *top = user_data;
+    if (size < top->min_size) {
+        return true;
+    }
+
+    if (top->k > 0 && top->count == top->k) {
+        if (size > top->items[0]->size) {
+            set_destroy(top->items[0]);
+            top->items[0] = top_k_copy(vertices, size);
+            top_k_sift_down(top, 0);
+        }
+        return true;
+    }
+
+    if (top->count == top->capacity) {
+        top->capacity = top->capacity ? 2 * top->capacity : 16;
+        top->items = realloc(top->items, top->capacity * sizeof(Set *));
+    }
+    // Sift up the new leaf
+    int i = top->count++;
+    top->items[i] = top_k_copy(vertices, size);
+    while (i > 0 && top->items[(i - 1) / 2]->size > top->items[i]->size) {
+        Set *tmp = top->items[i];
+        top->items[i] = top->items[(i - 1) / 2];
+        top->items[(i - 1) / 2] = tmp;
+        i = (i - 1) / 2;
+    }
+    return true;
+}
+
+static int compare_sets_by_size_desc(const void *a, const void *b) {
+    const Set *x = *(Set *const *)a;
+    const Set *y = *(Set *const *)b;
+    return (y->size > x->size) - (y->size < x->size);
+}
+
+/**
+ * @brief Keeps only the k largest cliques of at least min_size vertices
+ * 
+ * @param graph Pointer to the graph structure
+ * @param engine Enumeration engine
+ * @param k Maximum number of cliques to keep (≤ 0 keeps every qualifying clique)
+ * @param min_size Smallest clique size of interest
+ * @param cliques Receives a newly allocated array sorted by decreasing size
+ * @return Number of cliques in the array
+ */
+int collect_largest_cliques(Graph *graph, CliqueEngine engine, int k, int min_size, Set ***cliques) {
+    CliqueTopK top = {NULL, 0, 0, k, min_size};
+    visit_cliques(graph, engine, clique_top_k_visitor, &top);
+    if (top.count > 1) {
+        qsort(top.items, top.count, sizeof(Set *), compare_sets_by_size_desc);
+    }
+    *cliques = top.items;
+    return top.count;
+}
+
+/**
+ * @brief Visitor state of analyze_cliques()
+ */
+typedef struct {
+    CliqueCounts counts;
+    int non_trivial_count;
+} CliqueReport;
+
+/**
+ * @brief Prints non-trivial cliques as they are found and keeps the totals
+ */
+static bool clique_report_visitor(const int *vertices, int size, void *user_data) {
+    CliqueReport *report = user_data;
+    clique_count_visitor(vertices, size, &report->counts);
+    if (size >= 3) {
+        printf("  Clique %d (size %d): ", ++report->non_trivial_count, size);
+        for (int j = 0; j < size; j++) {
+            printf("%d ", vertices[j]);
+        }
+        printf("\n");
+    }
+    return true;
+}
+
+/**
+ * @brief Analyzes and prints comprehensive clique information
+ * 
+ * This convenience function performs complete clique analysis and provides
+ * formatted output. It allows choosing between different algorithms and
+ * focuses on non-trivial cliques (size ≥ 3). Built on visit_cliques():
+ * cliques are printed as they are found and never stored, so the summary
+ * (maximum size, total count) follows the list.
+ * 
+ * @param graph Pointer to the graph structure
+ * @param algorithm_choice 1 for backtracking (all cliques), 2 for Bron-Kerbosch (maximal),
+ *                         3 for degeneracy-ordered Bron-Kerbosch (maximal, sparse graphs),
+ *                         4 for parallel bitset Bron-Kerbosch (maximal, all cores)
+ */
+void analyze_cliques(Graph *graph, int algorithm_choice) {
+    /* ========================================================================
+     * INITIALIZATION: Map the menu choice onto an engine
+     * ========================================================================*/
+    
+    CliqueEngine engine = CLIQUE_ENGINE_BITSET;
+    const char *algorithm_name = "Bron-Kerbosch (maximal cliques)";
+    if (algorithm_choice == 1) {
+        engine = CLIQUE_ENGINE_BACKTRACKING;
+        algorithm_name = "Backtracking (all cliques)";
+    } else if (algorithm_choice == 3) {
+        engine = CLIQUE_ENGINE_DEGENERACY;
+        algorithm_name = "Degeneracy-ordered Bron-Kerbosch (maximal cliques)";
+    } else if (algorithm_choice == 4) {
+        engine = CLIQUE_ENGINE_PARALLEL;
+        algorithm_name = "Parallel Bron-Kerbosch (maximal cliques)";
+    }
+
+    /* ========================================================================
+     * STREAMING PASS: Print non-trivial cliques while counting
+     * ========================================================================*/
+    
+    printf("\n=== Clique Analysis ===\n");
+    printf("Algorithm used: %s\n", algorithm_name);
+    printf("Non-trivial cliques (size ≥ 3):\n");
+
+    CliqueReport report = {{0, 0}, 0};
+    visit_cliques(graph, engine, clique_report_visitor, &report);
+
+    if (report.non_trivial_count == 0) {
+        printf("  No non-trivial cliques found (all cliques have size < 3)\n");
+    }
+
+    /* ========================================================================
+     * SUMMARY: Totals are known only after the stream ends
+     * ========================================================================*/
+    
+    printf("Maximum clique size: %d\n", report.counts.max_size);
+    printf("Total cliques found: %lld\n", report.counts.count);
+}
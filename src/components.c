@@ -0,0 +1,243 @@
+/**
+ * @file components.c
+ * @brief Concurrent union-find component labelling
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Invariant: parent[x] ≤ x at all times. Links go from a root to a smaller
+ * vertex and path splitting only replaces a parent by one of its ancestors,
+ * so any concurrent interleaving keeps the forest acyclic.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "components.h"
+#include "csr_graph.h"
+#include "task_pool.h"
+
+/* ========================================================================
+ * UNION-FIND
+ * ========================================================================*/
+
+static int uf_find(atomic_int *parent, int x)
+{
+    for (;;)
+    {
+        int p = atomic_load_explicit(&parent[x], memory_order_relaxed);
+        if (p == x)
+            return x;
+        int gp = atomic_load_explicit(&parent[p], memory_order_relaxed);
+        if (gp != p)
+        {
+            // Path splitting; if another thread moved parent[x] first, its value is at least as good
+            atomic_compare_exchange_weak_explicit(&parent[x], &p, gp, memory_order_relaxed,
+                                                  memory_order_relaxed);
+        }
+        x = p;
+    }
+}
+
+static void uf_union(atomic_int *parent, int a, int b)
+{
+    for (;;)
+    {
+        a = uf_find(parent, a);
+        b = uf_find(parent, b);
+        if (a == b)
+            return;
+        if (a < b)
+        {
+            int t = a;
+            a = b;
+            b = t;
+        }
+        // Only a root may be linked; retry if a stopped being one meanwhile
+        int expected = a;
+        if (atomic_compare_exchange_strong(&parent[a], &expected, b))
+            return;
+    }
+}
+
+/* ========================================================================
+ * PARALLEL UNIONS
+ * ========================================================================*/
+
+typedef struct
+{
+    const CSRGraph *csr;
+    atomic_int *parent;
+    int begin;          // Row range [begin, end)
+    int end;
+} UnionSlice;
+
+static void union_slice(const UnionSlice *slice)
+{
+    const CSRGraph *csr = slice->csr;
+    for (int u = slice->begin; u < slice->end; u++)
+    {
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+        {
+            int v = csr->neighbors[k];
+            // Undirected rows list every edge twice; the u < v copy suffices
+            if (csr->is_directed || u < v)
+                uf_union(slice->parent, u, v);
+        }
+    }
+}
+
+static void *union_main(void *arg)
+{
+    union_slice(arg);
+    return NULL;
+}
+
+/**
+ * @brief First row whose arcs start at or after the given arc index
+ */
+static int row_at_arc(const CSRGraph *csr, int arc)
+{
+    int lo = 0, hi = csr->node_count;
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (csr->offsets[mid] < arc)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void union_all_edges(const CSRGraph *csr, atomic_int *parent, int num_threads)
+{
+    int n = csr->node_count;
+    int arcs = csr->offsets[n];
+    int threads = arcs >= COMPONENTS_PARALLEL_MIN_ARCS
+                      ? (num_threads > 0 ? num_threads : task_pool_default_threads())
+                      : 1;
+
+    UnionSlice local[1];
+    UnionSlice *slices = threads > 1 ? malloc(threads * sizeof(UnionSlice)) : local;
+    pthread_t *handles = threads > 1 ? malloc(threads * sizeof(pthread_t)) : NULL;
+    bool *started = threads > 1 ? calloc(threads, sizeof(bool)) : NULL;
+    if (!slices || (threads > 1 && (!handles || !started)))
+    {
+        if (slices != local)
+            free(slices);
+        free(handles);
+        free(started);
+        slices = local;
+        handles = NULL;
+        started = NULL;
+        threads = 1;
+    }
+
+    // Balance slices by arcs, not rows: hubs would otherwise serialise the work
+    for (int t = 0; t < threads; t++)
+    {
+        int begin = t == 0 ? 0 : row_at_arc(csr, (int)((long long)arcs * t / threads));
+        int end = t == threads - 1 ? n : row_at_arc(csr, (int)((long long)arcs * (t + 1) / threads));
+        slices[t] = (UnionSlice){csr, parent, begin, end};
+    }
+
+    // Thread t > 0 runs slice t; the caller runs slice 0 and any slice whose thread failed to start
+    for (int t = 1; t < threads; t++)
+        started[t] = pthread_create(&handles[t], NULL, union_main, &slices[t]) == 0;
+    union_slice(&slices[0]);
+    for (int t = 1; t < threads; t++)
+    {
+        if (started[t])
+            pthread_join(handles[t], NULL);
+        else
+            union_slice(&slices[t]);
+    }
+
+    if (slices != local)
+        free(slices);
+    free(handles);
+    free(started);
+}
+
+/* ========================================================================
+ * PUBLIC API
+ * ========================================================================*/
+
+int components_compute_csr(const CSRGraph *csr, int num_threads, ComponentLabeling *out)
+{
+    memset(out, 0, sizeof(ComponentLabeling));
+    int n = csr->node_count;
+    int slots = n > 0 ? n : 1;
+
+    atomic_int *parent = malloc(slots * sizeof(atomic_int));
+    out->label = malloc(slots * sizeof(int));
+    out->members = malloc(slots * sizeof(int));
+    if (!parent || !out->label || !out->members)
+    {
+        free(parent);
+        components_free(out);
+        return -1;
+    }
+
+    for (int v = 0; v < n; v++)
+        atomic_init(&parent[v], v);
+    union_all_edges(csr, parent, num_threads);
+
+    // Roots are component minima, so a root is always labelled before its members
+    int count = 0;
+    for (int v = 0; v < n; v++)
+    {
+        int root = uf_find(parent, v);
+        out->label[v] = root == v ? count++ : out->label[root];
+    }
+    free(parent);
+
+    out->count = count;
+    out->sizes = calloc(count > 0 ? count : 1, sizeof(int));
+    out->offsets = malloc((count + 1) * sizeof(int));
+    if (!out->sizes || !out->offsets)
+    {
+        components_free(out);
+        return -1;
+    }
+
+    // Counting sort by label keeps each group in ascending vertex order
+    for (int v = 0; v < n; v++)
+        out->sizes[out->label[v]]++;
+    out->offsets[0] = 0;
+    for (int c = 0; c < count; c++)
+        out->offsets[c + 1] = out->offsets[c] + out->sizes[c];
+    int *fill = malloc((count > 0 ? count : 1) * sizeof(int));
+    if (!fill)
+    {
+        components_free(out);
+        return -1;
+    }
+    memcpy(fill, out->offsets, count * sizeof(int));
+    for (int v = 0; v < n; v++)
+        out->members[fill[out->label[v]]++] = v;
+    free(fill);
+    return 0;
+}
+
+int components_compute(Graph *graph, int num_threads, ComponentLabeling *out)
+{
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+    {
+        memset(out, 0, sizeof(ComponentLabeling));
+        return -1;
+    }
+    return components_compute_csr(csr, num_threads, out);
+}
+
+void components_free(ComponentLabeling *cc)
+{
+    free(cc->label);
+    free(cc->sizes);
+    free(cc->offsets);
+    free(cc->members);
+    memset(cc, 0, sizeof(ComponentLabeling));
+}
@@ -1,4 +1,6 @@
 #include "connectivity.h"
+#include "csr_graph.h"
+#include "components.h"
 
 /**
  * @file connectivity.c
@@ -7,166 +9,235 @@
  * @date 2024
  * 
  * This file implements connectivity analysis for both directed and undirected graphs.
- * Uses BFS (Breadth-First Search) to determine reachability and various types of connectivity.
+ * Undirected connectivity and weak connectivity are read off a union-find
+ * component labelling (components.h), which also yields the component count;
+ * strong and one-sided connectivity are read off the strongly connected
+ * components, computed with an iterative Tarjan search.
  * 
  * Connectivity types analyzed:
  * - Undirected graphs: Simple connectivity (all vertices reachable)
  * - Directed graphs: Strong, weak, and one-sided connectivity
  * 
  * The implementation is efficient with O(V + E) complexity per connectivity test.
+ * Neighbor scans go through the graph's CSR view (see csr_graph.h), so each
+ * traversal only touches real edges instead of full adjacency matrix rows.
  */
 
+/* ========================================================================
+ * STRONGLY CONNECTED COMPONENTS (ITERATIVE TARJAN)
+ * ========================================================================*/
+
+/**
+ * @brief Tarjan's search with an explicit call stack of (vertex, next arc) frames
+ *
+ * @param scratch 5 * n ints: DFS number, low-link, component stack and the
+ *                two halves of the call stack
+ * @param on_stack n flags, all false on entry
+ */
+static void tarjan_search(const CSRGraph *csr, SCCDecomposition *scc, int *scratch, bool *on_stack) {
+    int n = csr->node_count;
+    int *index = scratch;
+    int *low = scratch + n;
+    int *tarjan_stack = scratch + 2 * n;
+    int *call_vertex = scratch + 3 * n;
+    int *call_arc = scratch + 4 * n;
+
+    for (int v = 0; v < n; v++)
+        index[v] = -1;
+
+    int next_index = 0, stack_top = 0;
+    for (int root = 0; root < n; root++) {
+        if (index[root] != -1)
+            continue;
+
+        int depth = 0;
+        call_vertex[depth] = root;
+        call_arc[depth] = csr->offsets[root];
+        index[root] = low[root] = next_index++;
+        tarjan_stack[stack_top++] = root;
+        on_stack[root] = true;
+
+        while (depth >= 0) {
+            int v = call_vertex[depth];
+
+            if (call_arc[depth] < csr->offsets[v + 1]) {
+                int w = csr->neighbors[call_arc[depth]++];
+                if (index[w] == -1) {
+                    // Tree arc: descend
+                    index[w] = low[w] = next_index++;
+                    tarjan_stack[stack_top++] = w;
+                    on_stack[w] = true;
+                    depth++;
+                    call_vertex[depth] = w;
+                    call_arc[depth] = csr->offsets[w];
+                } else if (on_stack[w] && index[w] < low[v]) {
+                    low[v] = index[w];
+                }
+                continue;
+            }
+
+            // All arcs of v done: pop v's component if v is its root
+            if (low[v] == index[v]) {
+                int c = scc->count++;
+                int size = 0, w;
+                do {
+                    w = tarjan_stack[--stack_top];
+                    on_stack[w] = false;
+                    scc->component[w] = c;
+                    size++;
+                } while (w != v);
+                scc->sizes[c] = size;
+            }
+
+            depth--;
+            if (depth >= 0) {
+                int parent = call_vertex[depth];
+                if (low[v] < low[parent])
+                    low[parent] = low[v];
+            }
+        }
+    }
+
+    // Tarjan emits sink components first; flip ids into topological order
+    for (int v = 0; v < n; v++)
+        scc->component[v] = scc->count - 1 - scc->component[v];
+    for (int i = 0, j = scc->count - 1; i < j; i++, j--) {
+        int tmp = scc->sizes[i];
+        scc->sizes[i] = scc->sizes[j];
+        scc->sizes[j] = tmp;
+    }
+}
+
+SCCDecomposition *scc_compute_csr(const CSRGraph *csr) {
+    int slots = csr->node_count > 0 ? csr->node_count : 1;
+
+    SCCDecomposition *scc = malloc(sizeof(SCCDecomposition));
+    if (!scc)
+        return NULL;
+    scc->count = 0;
+    scc->component = malloc(slots * sizeof(int));
+    scc->sizes = malloc(slots * sizeof(int));
+
+    int *scratch = malloc(5 * (size_t)slots * sizeof(int));
+    bool *on_stack = calloc(slots, sizeof(bool));
+    if (scc->component && scc->sizes && scratch && on_stack) {
+        tarjan_search(csr, scc, scratch, on_stack);
+    } else {
+        scc_free(scc);
+        scc = NULL;
+    }
+
+    free(scratch);
+    free(on_stack);
+    return scc;
+}
+
+SCCDecomposition *scc_compute(Graph *graph) {
+    CSRGraph *csr = graph_ensure_csr(graph);
+    return csr ? scc_compute_csr(csr) : NULL;
+}
+
+void scc_free(SCCDecomposition *scc) {
+    if (!scc)
+        return;
+    free(scc->component);
+    free(scc->sizes);
+    free(scc);
+}
+
+bool scc_condensation_has_hamiltonian_path(const CSRGraph *csr, const SCCDecomposition *scc) {
+    if (scc->count <= 1)
+        return true;
+
+    // A DAG has a Hamiltonian path iff its topological order is unique, i.e.
+    // iff every consecutive pair (c, c + 1) of the order is joined by an arc
+    bool *linked = calloc(scc->count, sizeof(bool));
+    if (!linked)
+        return false;
+    int links = 0;
+    for (int u = 0; u < csr->node_count; u++) {
+        int cu = scc->component[u];
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++) {
+            if (scc->component[csr->neighbors[k]] == cu + 1 && !linked[cu]) {
+                linked[cu] = true;
+                links++;
+            }
+        }
+    }
+    free(linked);
+    return links == scc->count - 1;
+}
+
+/* ========================================================================
+ * CONNECTIVITY ANALYSIS
+ * ========================================================================*/
+
 /**
  * @brief Comprehensive connectivity analysis for directed and undirected graphs
  * 
  * This function performs different connectivity analyses based on graph type:
  * 
  * For Directed Graphs:
- * - Strong Connectivity: Every vertex can reach every other vertex via directed paths
+ * - Strong Connectivity: exactly one strongly connected component
  * - Weak Connectivity: Graph is connected when all edges are treated as undirected
- * - One-sided Connectivity: For any pair of vertices, at least one can reach the other
+ * - One-sided Connectivity: the condensation DAG has a Hamiltonian path
  * 
  * For Undirected Graphs:
  * - Simple Connectivity: All vertices are reachable from any starting vertex
  * 
- * The algorithm uses BFS traversal for reachability analysis, which is optimal
- * for unweighted graphs and provides O(V + E) complexity per test.
+ * Strong ⇒ one-sided ⇒ weak, so the weak BFS only runs when the
+ * condensation test fails.
  * 
  * @param graph Pointer to the graph structure to analyze
  * @return Connectivity structure with analysis results
  */
 Connectivity check_connectivity(Graph *graph) {
-    /* ========================================================================
-     * INITIALIZATION: Set up connectivity result structure and working arrays
-     * ========================================================================*/
-    
-    // Initialize connectivity results (all false initially, one_sided true by default)
-    Connectivity conn = {false, false, true, false};
-    
-    // Allocate working arrays for BFS traversal
-    bool *visited = calloc(graph->node_count, sizeof(bool));    // Visited vertex tracking
-    int *queue = malloc(graph->node_count * sizeof(int));       // BFS queue
-    int front, rear;                                            // Queue pointers
+    Connectivity conn = {false, false, false, false, 0, 0, 0};
+
+    if (graph->node_count == 0) {
+        // Empty graphs are trivially connected in every sense
+        conn.is_strong = conn.is_weak = conn.is_one_sided = conn.is_connected = true;
+        return conn;
+    }
+
+    // CSR view: neighbor scans cost O(deg) instead of O(V)
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return conn;
+
+    // Components ignore arc directions: weak components for digraphs
+    ComponentLabeling cc;
+    if (components_compute_csr(csr, 0, &cc) != 0)
+        return conn;
+    conn.component_count = cc.count;
+    for (int c = 0; c < cc.count; c++) {
+        if (cc.sizes[c] > conn.largest_component)
+            conn.largest_component = cc.sizes[c];
+    }
+    components_free(&cc);
 
     /* ========================================================================
      * DIRECTED GRAPH ANALYSIS: Strong, weak, and one-sided connectivity
      * ========================================================================*/
     
     if (graph->is_directed) {
-        
-        /* ====================================================================
-         * STRONG CONNECTIVITY TEST: All vertices reachable via directed edges
-         * ====================================================================*/
-        
-        // Initialize BFS from vertex 0 following directed edges only
-        front = rear = 0;
-        queue[rear++] = 0;           // Start BFS from vertex 0
-        visited[0] = true;
-        int reachable_count = 1;
-        
-        // BFS traversal following directed edges
-        while (front < rear) {
-            int current = queue[front++];
-            
-            // Explore all outgoing edges from current vertex
-            for (int i = 0; i < graph->node_count; i++) {
-                if (graph->adjacency[current][i] > 0 && !visited[i]) {
-                    visited[i] = true;
-                    queue[rear++] = i;
-                    reachable_count++;
-                }
-            }
-        }
-        
-        // Strong connectivity: all vertices reachable from vertex 0
-        conn.is_strong = (reachable_count == graph->node_count);
-
-        /* ====================================================================
-         * WEAK CONNECTIVITY TEST: Connectivity treating edges as undirected
-         * ====================================================================*/
-        
-        // Reset visited array for weak connectivity test
-        free(visited);
-        visited = calloc(graph->node_count, sizeof(bool));
-        front = rear = 0;
-        queue[rear++] = 0;
-        visited[0] = true;
-        reachable_count = 1;
-        
-        // BFS treating all edges as bidirectional
-        while (front < rear) {
-            int current = queue[front++];
-            
-            // Check both outgoing and incoming edges
-            for (int i = 0; i < graph->node_count; i++) {
-                // Edge exists in either direction (treat as undirected)
-                if ((graph->adjacency[current][i] > 0 || graph->adjacency[i][current] > 0) && !visited[i]) {
-                    visited[i] = true;
-                    queue[rear++] = i;
-                    reachable_count++;
-                }
-            }
-        }
-        
-        // Weak connectivity: all vertices reachable when treating edges as undirected
-        conn.is_weak = (reachable_count == graph->node_count);
-
-        /* ====================================================================
-         * ONE-SIDED CONNECTIVITY TEST: Simplified implementation
-         * ====================================================================*/
-        
-        // Simplified one-sided connectivity check
-        // Note: This is a basic implementation that checks for bidirectional edges
-        // A complete implementation would require more complex analysis
-        for (int i = 0; i < graph->node_count; i++) {
-            for (int j = 0; j < graph->node_count; j++) {
-                // If bidirectional edge exists and bidirectional edges aren't explicitly allowed
-                if (graph->adjacency[i][j] > 0 && graph->adjacency[j][i] > 0 && !graph->allow_bidirectional) {
-                    conn.is_one_sided = false;
-                    break;
-                }
-            }
-            if (!conn.is_one_sided)
-                break;
-        }
-        
-    } else {
-        /* ====================================================================
-         * UNDIRECTED GRAPH ANALYSIS: Simple connectivity
-         * ====================================================================*/
-        
-        // Initialize BFS from vertex 0 (if graph is non-empty)
-        front = rear = 0;
-        if (graph->node_count > 0) {
-            queue[rear++] = 0;
-            visited[0] = true;
-        }
-        int reachable_count = (graph->node_count > 0) ? 1 : 0;
-        
-        // BFS traversal for undirected graph
-        while (front < rear) {
-            int current = queue[front++];
-            
-            // Explore all adjacent vertices (undirected edges)
-            for (int i = 0; i < graph->node_count; i++) {
-                if (graph->adjacency[current][i] > 0 && !visited[i]) {
-                    visited[i] = true;
-                    queue[rear++] = i;
-                    reachable_count++;
-                }
-            }
-        }
-        
-        // Simple connectivity: all vertices reachable
-        conn.is_connected = (reachable_count == graph->node_count);
+        SCCDecomposition *scc = scc_compute_csr(csr);
+        if (!scc)
+            return conn;
+
+        conn.scc_count = scc->count;
+        conn.is_strong = (scc->count == 1);
+        conn.is_one_sided = scc_condensation_has_hamiltonian_path(csr, scc);
+        scc_free(scc);
+
+        conn.is_weak = (conn.component_count == 1);
+        return conn;
     }
 
     /* ========================================================================
-     * CLEANUP: Free allocated working arrays
+     * UNDIRECTED GRAPH ANALYSIS: Simple connectivity
      * ========================================================================*/
-    
-    free(visited);
-    free(queue);
-    
+
+    conn.is_connected = (conn.component_count == 1);
     return conn;
-}
\ No newline at end of file
+}
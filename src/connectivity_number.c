@@ -9,8 +9,9 @@
  * vertices whose removal disconnects the graph or reduces it to a single vertex.
  *
  * The module provides:
- * 1. Exact algorithms for small graphs using brute force enumeration
- * 2. Approximation algorithms for large graphs using min-degree heuristic
+ * 1. Exact vertex connectivity via vertex-split unit-capacity max-flow (Even)
+ * 2. An exhaustive brute-force reference algorithm for small graphs, with the
+ *    subsets of each size tested in parallel against a removed-vertex bitmask
  * 3. Comprehensive analysis and reporting functions
  *
  * Key concepts:
@@ -19,8 +20,8 @@
  * - Vertex Cut: Set of vertices whose removal disconnects the graph
  * - Whitney's Theorem: κ(G) ≤ λ(G) ≤ δ(G) (vertex ≤ edge ≤ min degree)
  *
- * Time Complexity: O(2^n) for exact (small graphs), O(n²) for approximation
- * Space Complexity: O(n²) for adjacency matrix and auxiliary structures
+ * Time Complexity: O(n + δ²) Dinic flows for the max-flow algorithm, O(2^n) for brute force
+ * Space Complexity: O(V + E) for the flow network
  */
 
 #include <stdlib.h>
@@ -28,80 +29,135 @@
 #include <string.h>
 #include <stdbool.h>
 #include <limits.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 #include "connectivity_number.h"
 #include "structs.h"
+#include "csr_graph.h"
+#include "max_flow.h"
+#include "bitset.h"
+#include "bfs.h"
+#include "task_pool.h"
+#include "graph_stats.h"
+
+/** Below this many subsets of one size the brute-force search stays on the calling thread */
+#define CONNECTIVITY_PARALLEL_MIN_SUBSETS 4096
+
+/* ========================================================================
+ * SUBSET TESTING
+ * ========================================================================*/
 
 /**
- * @brief Performs DFS to count reachable vertices after vertex removal
+ * @struct CutTester
+ * @brief Reusable scratch for "is G - S connected?" queries
+ *
+ * The removed set S is a bitmask that callers update in place, so moving to
+ * the next combination only flips the bits that changed. The traversal is
+ * the shared BFS kernel with S as its blocked mask; the workspace is reused
+ * and only resets what the previous query reached, so a query allocates
+ * nothing and never recurses.
+ *
+ * The vertex cut searches follow arcs in both directions (BFS_WEAK), the
+ * same undirected view as the flow network, so digraphs get one definition
+ * of κ throughout.
+ */
+typedef struct
+{
+    const CSRGraph *csr;
+    int n;
+    BFSMode mode;       // BFS_WEAK for the cut searches
+    uint64_t *removed;  // Bitmask of removed vertices
+    BFSWorkspace *bfs;  // Single-threaded: brute-force workers are parallel already
+    int *combination;   // Current subset of the brute-force search (n entries)
+} CutTester;
+
+static bool cut_tester_init(CutTester *tester, const CSRGraph *csr, int n, BFSMode mode)
+{
+    int slots = n > 0 ? n : 1;
+    tester->csr = csr;
+    tester->n = n;
+    tester->mode = mode;
+    tester->removed = calloc(bitset_words(slots), sizeof(uint64_t));
+    tester->bfs = bfs_workspace_create(n, 1);
+    tester->combination = malloc(slots * sizeof(int));
+    return tester->removed && tester->bfs && tester->combination;
+}
+
+static void cut_tester_release(CutTester *tester)
+{
+    free(tester->removed);
+    bfs_workspace_destroy(tester->bfs);
+    free(tester->combination);
+}
+
+/**
+ * @brief Checks whether the vertices outside the removed mask are connected
  *
- * This helper function implements depth-first search while avoiding removed
- * vertices to determine connectivity after vertex removal. It counts the
- * number of vertices reachable from a given start vertex.
+ * @param tester Scratch with the removed mask already set
+ * @param removed_count Number of bits set in the mask
+ * @return true if the remaining vertices form one component, false if they
+ *         are split or none remain
  *
- * @param graph Pointer to the graph structure
- * @param start Starting vertex for DFS traversal
- * @param visited Boolean array tracking visited vertices
- * @param removed_vertices Array of vertex indices to avoid during traversal
- * @param removed_count Number of vertices in removed_vertices array
- * @param reachable_count Pointer to counter for reachable vertices
- *
- * @complexity O(V + E) for DFS traversal
- *
- * @pre graph must have valid adjacency matrix
- * @pre visited array must be allocated with size ≥ node_count
- * @pre removed_vertices must be valid array or NULL if removed_count = 0
- * @pre reachable_count must point to valid integer
- * @post visited array is modified to reflect DFS traversal
- * @post reachable_count is incremented for each reachable vertex
- *
- * @note Recursive implementation - may cause stack overflow for very large graphs
- * @note Does not reset visited array - caller responsibility
+ * @complexity O(V + E)
  */
-static void dfs_reachable(Graph *graph, int start, bool *visited, int *removed_vertices, int removed_count, int *reachable_count)
+static bool cut_tester_connected(CutTester *tester, int removed_count)
 {
-    /* Check if start vertex is removed */
-    for (int i = 0; i < removed_count; i++)
+    int remaining = tester->n - removed_count;
+    if (remaining <= 0)
+        return false;
+
+    /* First vertex outside the mask */
+    int start = -1;
+    for (int w = 0; start < 0; w++)
     {
-        if (removed_vertices[i] == start)
-            return;
+        uint64_t free_bits = ~tester->removed[w];
+        if (free_bits)
+            start = w * BITSET_WORD_BITS + __builtin_ctzll(free_bits);
     }
 
-    visited[start] = true;
-    (*reachable_count)++;
+    return bfs_run(tester->bfs, tester->csr, &start, 1, tester->mode, tester->removed) == remaining;
+}
 
-    for (int v = 0; v < graph->node_count; v++)
+/**
+ * @brief is_connected_after_removal() with a choice of arc directions
+ *
+ * @param mode BFS_FORWARD (out-arcs from the first remaining vertex) or BFS_WEAK
+ */
+static bool connected_after_removal(Graph *graph, int *removed_vertices, int removed_count, BFSMode mode)
+{
+    if (!graph || graph->node_count <= 1)
+        return true;
+
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return false;
+    CutTester tester;
+    if (!cut_tester_init(&tester, csr, graph->node_count, mode))
     {
-        if (graph->adjacency[start][v] && !visited[v])
-        {
-            /* Check if v is removed */
-            bool is_removed = false;
-            for (int i = 0; i < removed_count; i++)
-            {
-                if (removed_vertices[i] == v)
-                {
-                    is_removed = true;
-                    break;
-                }
-            }
-            if (!is_removed)
-            {
-                dfs_reachable(graph, v, visited, removed_vertices, removed_count, reachable_count);
-            }
-        }
+        cut_tester_release(&tester);
+        return false;
     }
+    for (int i = 0; i < removed_count; i++)
+        bitset_set(tester.removed, removed_vertices[i]);
+
+    bool connected = cut_tester_connected(&tester, removed_count);
+    cut_tester_release(&tester);
+    return connected;
 }
 
 /**
  * @brief Checks if graph remains connected after removing specified vertices
  *
  * This function determines whether a graph remains connected after removing
- * a specific set of vertices by performing DFS from any remaining vertex
- * and checking if all non-removed vertices are reachable.
+ * a specific set of vertices by traversing the graph from any remaining
+ * vertex and checking if all non-removed vertices are reachable.
  *
  * Algorithm steps:
- * 1. Find first non-removed vertex as starting point
- * 2. Perform DFS avoiding removed vertices
+ * 1. Mark the removed vertices in a bitmask (O(1) membership tests)
+ * 2. Run the shared BFS kernel from the first non-removed vertex, with the
+ *    mask as its blocked set
  * 3. Compare reachable count with total remaining vertices
  *
  * @param graph Pointer to the graph structure
@@ -110,10 +166,10 @@ static void dfs_reachable(Graph *graph, int start, bool *visited, int *removed_v
  *
  * @return true if graph remains connected, false if disconnected
  *
- * @complexity O(V + E) for single DFS traversal
+ * @complexity O(V + E) for single BFS traversal
  *
  * @pre graph must be valid with proper adjacency matrix
- * @pre removed_vertices must be valid array if removed_count > 0
+ * @pre removed_vertices must be valid array of distinct vertices if removed_count > 0
  * @pre removed_count must be ≤ node_count
  * @post Original graph structure unchanged
  * @post Returns true for trivial graphs (≤1 vertices)
@@ -127,108 +183,191 @@ static void dfs_reachable(Graph *graph, int start, bool *visited, int *removed_v
  */
 bool is_connected_after_removal(Graph *graph, int *removed_vertices, int removed_count)
 {
-    if (!graph || graph->node_count <= 1)
-        return true;
-
-    int n = graph->node_count;
-    bool *visited = calloc(n, sizeof(bool));
-
-    /* Find first non-removed vertex as start point */
-    int start = -1;
-    for (int i = 0; i < n; i++)
-    {
-        bool is_removed = false;
-        for (int j = 0; j < removed_count; j++)
-        {
-            if (removed_vertices[j] == i)
-            {
-                is_removed = true;
-                break;
-            }
-        }
-        if (!is_removed)
-        {
-            start = i;
-            break;
-        }
-    }
-
-    if (start == -1)
-    {
-        free(visited);
-        return false; /* All vertices removed */
-    }
-
-    /* Count reachable vertices from start */
-    int reachable_count = 0;
-    dfs_reachable(graph, start, visited, removed_vertices, removed_count, &reachable_count);
-
-    /* Count total non-removed vertices */
-    int total_remaining = n - removed_count;
-
-    free(visited);
-    return (reachable_count == total_remaining);
+    return connected_after_removal(graph, removed_vertices, removed_count, BFS_FORWARD);
 }
 
 /**
- * @brief Generates next lexicographic combination using algorithm
+ * @brief Advances positions [lo, k) of a combination to the next one in lexicographic order
  *
- * This utility function generates combinations in lexicographic order for
- * systematic enumeration of vertex subsets. Used internally by brute force
- * algorithms to iterate through all possible vertex cuts.
+ * Positions before lo are a fixed prefix. Only the elements that actually
+ * change are flipped in the removed mask, so consecutive subsets cost
+ * O(changed positions) to set up instead of O(k).
  *
  * Algorithm: Standard next combination generation using rightmost increment
  * and cascade update pattern.
  *
  * @param combination Array representing current combination (modified in-place)
+ * @param lo First position that may change
  * @param k Size of combination (number of elements to choose)
  * @param n Total number of elements to choose from
+ * @param mask Removed-vertex bitmask mirroring combination (can be NULL)
  *
  * @return true if next combination generated, false if no more combinations
  *
  * @complexity O(k) worst case for cascade updates
  *
- * @pre combination must be valid array of size k
- * @pre combination must contain valid indices [0, n-1]
- * @pre k ≤ n and both must be positive
- * @post combination array is modified to next lexicographic combination
- * @post Returns false when all combinations exhausted
- *
- * @note Modifies combination array in-place
- * @note Used internally for systematic vertex subset enumeration
- *
- * @example
- * int combo[] = {0, 1, 2}; // Choose 3 from 5
- * while (next_combination(combo, 3, 5)) {
- *     // Process current combination
- * }
+ * @pre combination holds a valid strictly increasing combination of [0, n-1]
+ * @post combination and mask are advanced together; both unchanged on false
  */
-static bool next_combination(int *combination, int k, int n)
+static bool next_combination(int *combination, int lo, int k, int n, uint64_t *mask)
 {
     int i = k - 1;
-    while (i >= 0 && combination[i] == n - k + i)
+    while (i >= lo && combination[i] == n - k + i)
     {
         i--;
     }
 
-    if (i < 0)
+    if (i < lo)
         return false;
 
-    combination[i]++;
-    for (int j = i + 1; j < k; j++)
+    for (int j = i; j < k; j++)
     {
-        combination[j] = combination[j - 1] + 1;
+        if (mask)
+            bitset_clear(mask, combination[j]);
+        combination[j] = j == i ? combination[j] + 1 : combination[j - 1] + 1;
+        if (mask)
+            bitset_set(mask, combination[j]);
     }
 
     return true;
 }
 
+/* ========================================================================
+ * BRUTE-FORCE SEARCH (PARALLEL OVER COMBINATION PREFIXES)
+ * ========================================================================*/
+
+/**
+ * @struct CutSearch
+ * @brief State shared by the workers testing all k-subsets
+ *
+ * The k-subsets are split by their first one or two elements; prefixes are
+ * ranked in lexicographic order, so the subsets of a lower-ranked task all
+ * come before those of a higher-ranked one. A worker that finds a cut
+ * publishes its rank, and every task ranked above it is abandoned. The
+ * result is therefore the lexicographically first minimum cut, the same one
+ * the sequential enumeration returns.
+ */
+typedef struct
+{
+    int n;
+    int k;
+    int prefix_len;
+    CutTester *testers;     // One per worker
+    SearchBudget *budget;   // One node per tested subset, NULL for no limit
+    atomic_int found_rank;  // Rank of the best task with a cut, INT_MAX if none
+    pthread_mutex_t lock;   // Guards cut
+    int *cut;               // k vertices of the best cut found
+} CutSearch;
+
+typedef struct
+{
+    int rank;
+    int prefix[2];
+} CutTask;
+
+static void cut_search_task(TaskPool *pool, int worker, void *task, void *user)
+{
+    (void)pool;
+    CutSearch *search = user;
+    CutTask *t = task;
+    int k = search->k;
+    int rank = t->rank;
+    CutTester *tester = &search->testers[worker];
+    int *combination = tester->combination;
+
+    if (atomic_load(&search->found_rank) < rank)
+    {
+        free(t);
+        return;
+    }
+
+    /* First subset with this prefix: prefix, then consecutive vertices */
+    for (int i = 0; i < k; i++)
+    {
+        combination[i] = i < search->prefix_len ? t->prefix[i] : combination[i - 1] + 1;
+        bitset_set(tester->removed, combination[i]);
+    }
+
+    do
+    {
+        if (!search_budget_charge(search->budget))
+            break;
+        GRAPH_STAT_INC(GRAPH_STAT_CUT_SUBSETS);
+        if (!cut_tester_connected(tester, k))
+        {
+            pthread_mutex_lock(&search->lock);
+            if (rank < atomic_load(&search->found_rank))
+            {
+                memcpy(search->cut, combination, k * sizeof(int));
+                atomic_store(&search->found_rank, rank);
+            }
+            pthread_mutex_unlock(&search->lock);
+            break;
+        }
+    } while (atomic_load(&search->found_rank) > rank &&
+             next_combination(combination, search->prefix_len, k, search->n, tester->removed));
+
+    for (int i = 0; i < k; i++)
+        bitset_clear(tester->removed, combination[i]);
+    free(t);
+}
+
+/**
+ * @brief C(n, k), saturating at INT_MAX
+ */
+static long long binomial_capped(int n, int k)
+{
+    long long c = 1;
+    for (int i = 1; i <= k && c < INT_MAX; i++)
+        c = c * (n - k + i) / i;
+    return c < INT_MAX ? c : INT_MAX;
+}
+
+/**
+ * @brief Tests every k-subset on the pool
+ *
+ * @return true if a cut of size k was found (written to search->cut)
+ */
+static bool cut_search_run(CutSearch *search, int k, int threads)
+{
+    int n = search->n;
+    search->k = k;
+    search->prefix_len = k >= 2 ? 2 : 1;
+    atomic_store(&search->found_rank, INT_MAX);
+
+    int workers = binomial_capped(n, k) < CONNECTIVITY_PARALLEL_MIN_SUBSETS ? 1 : threads;
+    TaskPool *pool = task_pool_create(workers, cut_search_task, search);
+    if (!pool)
+        return false;
+
+    /* Prefixes that still leave room for the remaining k - prefix_len elements */
+    int rank = 0;
+    for (int a = 0; a <= n - k; a++)
+    {
+        int b_end = search->prefix_len == 2 ? n - k + 1 : a + 1;
+        for (int b = a + 1; b <= b_end; b++)
+        {
+            CutTask *t = malloc(sizeof(CutTask));
+            if (!t)
+                continue;
+            t->rank = rank++;
+            t->prefix[0] = a;
+            t->prefix[1] = b;
+            task_pool_submit(pool, t->rank % workers, t);
+        }
+    }
+    task_pool_run(pool);
+    task_pool_destroy(pool);
+    return atomic_load(&search->found_rank) != INT_MAX;
+}
+
 /**
  * @brief Finds minimum vertex cut using brute force enumeration
  *
  * This function implements an exact algorithm for finding vertex connectivity
  * by systematically trying all possible vertex subsets in increasing size
- * order until a disconnecting set is found.
+ * order until a disconnecting set is found. It runs on every available core;
+ * see find_min_vertex_cut_bruteforce_parallel().
  *
  * Algorithm steps:
  * 1. Check if graph is already disconnected (return 0)
@@ -249,172 +388,427 @@ static bool next_combination(int *combination, int k, int n)
  * @post Returns exact vertex connectivity number
  * @post Original graph unchanged
  *
- * @warning Exponential time complexity - only suitable for small graphs (n ≤ 12)
+ * @warning Exponential time complexity - only suitable for small graphs (n ≤ 20)
  * @warning cut_vertices_out memory must be freed by caller if not NULL
  *
  * @note Returns 0 for trivial graphs or already disconnected graphs
  * @note Returns n-1 for complete graphs
  *
- * @see find_min_vertex_cut_maxflow() for approximation algorithm
+ * @see find_min_vertex_cut_maxflow() for the polynomial exact algorithm
  */
 int find_min_vertex_cut_bruteforce(Graph *graph, int **cut_vertices_out)
 {
-    if (!graph || graph->node_count <= 2)
-        return 0;
+    return find_min_vertex_cut_bruteforce_parallel(graph, 0, cut_vertices_out);
+}
 
-    int n = graph->node_count;
+/**
+ * @brief Brute-force minimum vertex cut with the subsets of each size split across threads
+ *
+ * Every worker owns a CutTester, so subset tests share nothing but the
+ * graph. Sizes are still processed in increasing order: the first size with
+ * a cut is the answer, and within that size the search stops as soon as
+ * the lowest-ranked task that can still contain a cut has found one.
+ *
+ * @param graph Pointer to the graph structure
+ * @param num_threads Number of worker threads (≤ 0 for all online processors)
+ * @param cut_vertices_out Output parameter for minimum cut vertices (can be NULL)
+ *
+ * @return Size of minimum vertex cut (vertex connectivity number), or -1 if
+ *         the per-thread scratch cannot be allocated
+ *
+ * @complexity O(2^n * (V + E) / threads)
+ */
+int find_min_vertex_cut_bruteforce_parallel(Graph *graph, int num_threads, int **cut_vertices_out)
+{
+    VertexCutResult result = find_min_vertex_cut_bruteforce_budget(graph, num_threads, NULL);
+    if (cut_vertices_out)
+        *cut_vertices_out = result.cut;
+    else
+        free(result.cut);
+    return result.size;
+}
+
+/**
+ * @brief Tests adjacency in the undirected sense (either arc for digraphs)
+ */
+static bool adjacent_undirected(const CSRGraph *csr, int u, int v)
+{
+    return csr_has_edge(csr, u, v) || (csr->is_directed && csr_has_edge(csr, v, u));
+}
 
-    /* Check if graph is already disconnected */
-    if (!is_connected_after_removal(graph, NULL, 0))
+/**
+ * @brief Writes the undirected neighborhood of v (merging out- and in-rows for digraphs)
+ *
+ * @return Number of neighbors written
+ */
+static int undirected_neighbors(const CSRGraph *csr, int v, int *out)
+{
+    int count = 0;
+    int a = csr->offsets[v], a_end = csr->offsets[v + 1];
+    if (!csr->is_directed)
     {
-        if (cut_vertices_out)
-            *cut_vertices_out = NULL;
-        return 0;
+        for (; a < a_end; a++)
+            if (csr->neighbors[a] != v)
+                out[count++] = csr->neighbors[a];
+        return count;
     }
 
-    /* Try removing k vertices for k = 1 to n-2 */
-    for (int k = 1; k < n - 1; k++)
+    /* Both rows are sorted: merge without duplicates */
+    int b = csr->in_offsets[v], b_end = csr->in_offsets[v + 1];
+    while (a < a_end || b < b_end)
     {
-        int *combination = malloc(k * sizeof(int));
+        int x;
+        if (b >= b_end || (a < a_end && csr->neighbors[a] < csr->in_neighbors[b]))
+            x = csr->neighbors[a++];
+        else if (a >= a_end || csr->in_neighbors[b] < csr->neighbors[a])
+            x = csr->in_neighbors[b++];
+        else
+        {
+            x = csr->neighbors[a++];
+            b++;
+        }
+        if (x != v)
+            out[count++] = x;
+    }
+    return count;
+}
 
-        /* Initialize first combination */
-        for (int i = 0; i < k; i++)
+/**
+ * @brief Neighborhood of a minimum-degree vertex: a cut of size δ unless G is complete
+ *
+ * @return δ, with the cut in a new array (caller frees), or -1 without memory
+ */
+static int min_degree_cut(const CSRGraph *csr, int n, int **cut_out)
+{
+    int *scratch = malloc(2 * n * sizeof(int));
+    if (!scratch)
+        return -1;
+    int best = n, pivot = 0;
+    for (int v = 0; v < n; v++)
+    {
+        int deg = undirected_neighbors(csr, v, scratch);
+        if (deg < best)
         {
-            combination[i] = i;
+            best = deg;
+            pivot = v;
         }
+    }
+    undirected_neighbors(csr, pivot, scratch);
+    *cut_out = malloc((best > 0 ? best : 1) * sizeof(int));
+    if (*cut_out)
+        memcpy(*cut_out, scratch, best * sizeof(int));
+    free(scratch);
+    return *cut_out ? best : -1;
+}
 
-        do
+/**
+ * @brief Brute-force search that stops when the budget runs out
+ *
+ * Every tested subset is one budget node. Stopping while size k is tested
+ * proves that no smaller set disconnects the graph, so κ ≥ k; the
+ * neighborhood of a minimum-degree vertex is the incumbent, κ ≤ δ. A cut
+ * found at size k before the stop is a minimum cut (possibly not the
+ * lexicographically first one) and completes the search.
+ */
+VertexCutResult find_min_vertex_cut_bruteforce_budget(Graph *graph, int num_threads, SearchBudget *budget)
+{
+    VertexCutResult result = {SEARCH_COMPLETE, 0, 0, NULL};
+    if (!graph || graph->node_count <= 1)
+        return result;
+
+    int n = graph->node_count;
+    int threads = num_threads > 0 ? num_threads : task_pool_default_threads();
+    CSRGraph *csr = graph_ensure_csr(graph);
+
+    CutSearch search;
+    search.n = n;
+    search.budget = budget;
+    search.testers = calloc(threads, sizeof(CutTester));
+    search.cut = malloc(n * sizeof(int));
+    pthread_mutex_init(&search.lock, NULL);
+    bool ready = csr && search.testers && search.cut;
+    int initialized = 0;
+    while (ready && initialized < threads)
+        ready = cut_tester_init(&search.testers[initialized++], csr, n, BFS_WEAK);
+
+    result.size = n - 1; // No cut found: complete graph
+    result.lower_bound = n - 1;
+    if (!ready)
+        result.size = result.lower_bound = -1;
+    else if (!cut_tester_connected(&search.testers[0], 0))
+        result.size = result.lower_bound = 0; // Already disconnected
+    else
+    {
+        /* Try removing k vertices for k = 1 to n-2 */
+        for (int k = 1; k < n - 1; k++)
         {
-            if (!is_connected_after_removal(graph, combination, k))
+            if (cut_search_run(&search, k, threads))
+            {
+                result.cut = malloc(k * sizeof(int));
+                if (result.cut)
+                    memcpy(result.cut, search.cut, k * sizeof(int));
+                result.size = result.lower_bound = k;
+                break;
+            }
+            if (search_budget_spent(budget))
             {
-                /* Found minimum cut */
-                if (cut_vertices_out)
+                /* Sizes below k are exhausted; N(v) of a minimum-degree v is the incumbent */
+                result.lower_bound = k;
+                result.size = min_degree_cut(csr, n, &result.cut);
+                if (result.size == n - 1)
+                {
+                    // Complete graph: N(v) disconnects nothing, κ = n - 1 without a cut
+                    free(result.cut);
+                    result.cut = NULL;
+                    result.lower_bound = n - 1;
+                }
+                else if (result.size != k) // δ = k: the incumbent is already minimum
                 {
-                    *cut_vertices_out = malloc(k * sizeof(int));
-                    memcpy(*cut_vertices_out, combination, k * sizeof(int));
+                    result.status = search_budget_status(budget);
                 }
-                free(combination);
-                return k;
+                break;
             }
-        } while (next_combination(combination, k, n));
+        }
+    }
+
+    for (int w = 0; w < initialized; w++)
+        cut_tester_release(&search.testers[w]);
+    free(search.testers);
+    free(search.cut);
+    pthread_mutex_destroy(&search.lock);
+    return result;
+}
 
-        free(combination);
+/**
+ * @brief Builds the vertex-split network used by Even's algorithm
+ *
+ * Vertex v becomes v_in = 2v and v_out = 2v + 1 joined by an arc of
+ * capacity 1; every edge {u, w} becomes u_out → w_in and w_out → u_in with
+ * capacity n (effectively infinite). A minimum s_out–t_in cut then consists
+ * of internal arcs only, i.e. of vertices.
+ */
+static FlowNetwork *build_vertex_split_network(const CSRGraph *csr, int n, int *scratch)
+{
+    FlowNetwork *net = flow_network_create(2 * n, n + 2 * csr->edge_count);
+    if (!net)
+        return NULL;
+
+    for (int v = 0; v < n; v++)
+        flow_network_add_arc(net, 2 * v, 2 * v + 1, 1);
+
+    for (int u = 0; u < n; u++)
+    {
+        int deg = undirected_neighbors(csr, u, scratch);
+        for (int k = 0; k < deg; k++)
+            flow_network_add_arc(net, 2 * u + 1, 2 * scratch[k], n);
     }
+    return net;
+}
 
-    /* If no cut found, connectivity is n-1 (complete graph) */
-    if (cut_vertices_out)
-        *cut_vertices_out = NULL;
-    return n - 1;
+/**
+ * @brief Computes κ(s, t) capped at *best and records a smaller cut if found
+ *
+ * The cut consists of the vertices whose v_in is reachable from the source
+ * in the residual network while v_out is not.
+ */
+static void refine_vertex_cut(FlowNetwork *net, int n, int s, int t, bool *side,
+                              int *best, int *best_cut, int *best_cut_size)
+{
+    GRAPH_STAT_INC(GRAPH_STAT_CUT_FLOWS);
+    int flow = flow_network_max_flow(net, 2 * s + 1, 2 * t, *best);
+    if (flow < *best)
+    {
+        flow_network_source_side(net, 2 * s + 1, side);
+        *best = flow;
+        *best_cut_size = 0;
+        for (int v = 0; v < n; v++)
+            if (side[2 * v] && !side[2 * v + 1])
+                best_cut[(*best_cut_size)++] = v;
+    }
+    flow_network_reset(net);
 }
 
 /**
- * @brief Approximates minimum vertex cut using min-degree heuristic
+ * @brief Computes exact vertex connectivity with unit-capacity max-flow (Even's algorithm)
  *
- * This function provides a fast approximation for vertex connectivity using
- * the theoretical result that κ(G) ≤ δ(G) (connectivity ≤ minimum degree).
- * For many graph classes, this bound is tight.
+ * Uses vertex splitting to turn local vertex connectivity κ(s, t) into a
+ * maximum flow, computed with Dinic's algorithm on a network that is built
+ * once and reset between queries.
  *
- * Algorithm steps:
- * 1. Check basic connectivity
- * 2. Find vertex with minimum degree
- * 3. Return minimum degree as approximation
+ * Algorithm steps (Even's reduction, with the Esfahanian-Hakimi choice of pairs):
+ * 1. Check basic connectivity (κ = 0 if disconnected)
+ * 2. Take a minimum-degree vertex v; δ(G) with N(v) as the cut is the start bound
+ * 3. Compute κ(v, w) for every w not adjacent to v
+ * 4. Compute κ(x, y) for every non-adjacent pair x, y of neighbors of v
+ * 5. Each flow is capped at the current best; a smaller flow yields a new
+ *    cut, read off the residual network
+ *
+ * If some minimum cut S avoids v, step 3 pairs v with a vertex behind S;
+ * otherwise v has neighbors on both sides of S and step 4 covers them. This
+ * needs n - δ - 1 + δ(δ - 1) / 2 flows instead of (κ + 1) · n, and the cap
+ * keeps every query at O(κ) augmentations.
  *
  * @param graph Pointer to the graph structure
- * @param cut_vertices_out Output parameter for cut vertex (can be NULL)
+ * @param cut_vertices_out Output parameter for minimum cut vertices (can be NULL)
  *
- * @return Approximated vertex connectivity (minimum degree)
+ * @return Exact vertex connectivity κ(G)
  *
- * @complexity O(V²) for degree computation in adjacency matrix
+ * @complexity O((n + δ²) · κ · (V + E)) worst case, O(V + E) memory
  *
- * @pre graph must be undirected with valid adjacency matrix
- * @post cut_vertices_out contains min-degree vertex if not NULL (caller must free)
- * @post Returns upper bound on vertex connectivity
+ * @pre graph must be a valid graph structure (directed graphs are treated as undirected)
+ * @post cut_vertices_out holds κ vertices if not NULL and a cut exists (caller must free)
  * @post Original graph unchanged
  *
- * @note This is an approximation - may overestimate actual connectivity
- * @note For many graph classes (e.g., regular graphs), gives exact result
- * @note Suitable for large graphs where exact computation is infeasible
- *
- * @warning Result may not be exact vertex connectivity
- * @warning cut_vertices_out memory must be freed by caller if not NULL
+ * @note Complete graphs have no vertex cut: returns n - 1 with a NULL cut
+ *       (1 for two adjacent vertices)
+ * @note Returns 0 with a NULL cut for disconnected graphs
+ * @note Returns -1 with a NULL cut if the CSR view, the flow network or the
+ *       scratch arrays cannot be allocated
  *
- * @see find_min_vertex_cut_bruteforce() for exact algorithm
+ * @see find_min_vertex_cut_bruteforce() for the exhaustive reference algorithm
  */
 int find_min_vertex_cut_maxflow(Graph *graph, int **cut_vertices_out)
 {
-    /* For larger graphs, we use a simplified approach based on minimum degree */
-    /* This is an approximation - exact vertex connectivity for large graphs requires complex algorithms */
-
-    if (!graph || graph->node_count <= 2)
+    if (cut_vertices_out)
+        *cut_vertices_out = NULL;
+    if (!graph || graph->node_count <= 1)
         return 0;
 
     int n = graph->node_count;
 
-    /* Check if graph is already disconnected */
-    if (!is_connected_after_removal(graph, NULL, 0))
-    {
-        if (cut_vertices_out)
-            *cut_vertices_out = NULL;
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return -1;
+
+    /* Check if graph is already disconnected (arcs taken both ways, as in the network) */
+    CutTester tester;
+    bool ready = cut_tester_init(&tester, csr, n, BFS_WEAK);
+    bool connected = ready && cut_tester_connected(&tester, 0);
+    cut_tester_release(&tester);
+    if (!ready)
+        return -1;
+    if (!connected)
         return 0;
+
+    int *scratch = malloc(2 * n * sizeof(int));
+    int *best_cut = malloc(n * sizeof(int));
+    if (!scratch || !best_cut)
+    {
+        free(scratch);
+        free(best_cut);
+        return -1;
     }
 
-    /* Find minimum degree as upper bound */
-    int min_degree = n;
-    int min_degree_vertex = 0;
+    /* ========================================================================
+     * UPPER BOUND: minimum degree and its neighborhood
+     * ========================================================================*/
 
-    for (int i = 0; i < n; i++)
+    int best = n;
+    int best_cut_size = 0;
+    int pivot = 0;
+    for (int v = 0; v < n; v++)
     {
-        int degree = 0;
-        for (int j = 0; j < n; j++)
+        int deg = undirected_neighbors(csr, v, scratch);
+        if (deg < best)
         {
-            if (graph->adjacency[i][j])
-                degree++;
-        }
-        if (degree < min_degree)
-        {
-            min_degree = degree;
-            min_degree_vertex = i;
+            best = deg;
+            pivot = v;
         }
     }
+    int *pivot_neighbors = malloc((best > 0 ? best : 1) * sizeof(int));
+    if (!pivot_neighbors)
+    {
+        free(scratch);
+        free(best_cut);
+        return -1;
+    }
+    undirected_neighbors(csr, pivot, pivot_neighbors);
+    int pivot_degree = best;
 
-    /* For approximation, return minimum degree */
-    /* In many cases, vertex connectivity equals minimum degree */
-    if (cut_vertices_out)
+    if (best == n - 1)
+    {
+        /* Complete graph: no vertex cut exists */
+        free(pivot_neighbors);
+        free(scratch);
+        free(best_cut);
+        return n - 1;
+    }
+    memcpy(best_cut, pivot_neighbors, pivot_degree * sizeof(int));
+    best_cut_size = pivot_degree;
+
+    /* ========================================================================
+     * LOCAL CONNECTIVITIES: capped unit-capacity flows on the split network
+     * ========================================================================*/
+
+    FlowNetwork *net = build_vertex_split_network(csr, n, scratch);
+    bool *side = malloc(2 * n * sizeof(bool));
+    bool *near_pivot = calloc(n, sizeof(bool));
+    if (!net || !side || !near_pivot)
+    {
+        flow_network_destroy(net);
+        free(side);
+        free(near_pivot);
+        free(pivot_neighbors);
+        free(scratch);
+        free(best_cut);
+        return -1;
+    }
+    near_pivot[pivot] = true;
+    for (int k = 0; k < pivot_degree; k++)
+        near_pivot[pivot_neighbors[k]] = true;
+
+    /* Pairs (pivot, w) for every w outside N[pivot] */
+    for (int w = 0; w < n && best > 1; w++)
     {
-        *cut_vertices_out = malloc(sizeof(int));
-        (*cut_vertices_out)[0] = min_degree_vertex;
+        if (!near_pivot[w])
+            refine_vertex_cut(net, n, pivot, w, side, &best, best_cut, &best_cut_size);
     }
 
-    return min_degree;
+    /* Non-adjacent pairs of pivot neighbors */
+    for (int a = 0; a < pivot_degree && best > 1; a++)
+    {
+        for (int b = a + 1; b < pivot_degree && best > 1; b++)
+        {
+            int x = pivot_neighbors[a], y = pivot_neighbors[b];
+            if (!adjacent_undirected(csr, x, y))
+                refine_vertex_cut(net, n, x, y, side, &best, best_cut, &best_cut_size);
+        }
+    }
+
+    free(near_pivot);
+    free(pivot_neighbors);
+    flow_network_destroy(net);
+    free(side);
+    free(scratch);
+
+    if (cut_vertices_out && best_cut_size > 0)
+        *cut_vertices_out = best_cut;
+    else
+        free(best_cut);
+    return best;
 }
 
 /**
- * @brief Calculates vertex connectivity number with automatic algorithm selection
- *
- * This is the main function for computing vertex connectivity. It automatically
- * selects the appropriate algorithm based on graph size: exact algorithm for
- * small graphs (n ≤ 12) and approximation for larger graphs.
+ * @brief Calculates the exact vertex connectivity number
  *
- * The function handles various edge cases and provides informative output
- * about the algorithm choice and limitations.
+ * This is the main function for computing vertex connectivity. It handles
+ * the trivial cases and delegates to the max-flow algorithm, which is exact
+ * for every graph size.
  *
  * @param graph Pointer to the graph structure
  *
  * @return Vertex connectivity number κ(G)
  *
- * @complexity O(2^n * (V + E)) for small graphs, O(V²) for large graphs
+ * @complexity n - δ - 1 + δ(δ - 1) / 2 max-flow computations
  *
  * @pre graph must be valid with proper adjacency matrix
- * @post Returns exact result for small graphs (n ≤ 12)
- * @post Returns approximation for large graphs (n > 12) with warning
+ * @post Returns exact vertex connectivity
  * @post Original graph unchanged
  *
  * @note Automatically handles directed graphs by treating as undirected
- * @note Provides console output about algorithm selection
  * @note Returns 0 for trivial cases (n ≤ 1) and disconnected graphs
  * @note Returns 1 for graphs with exactly 2 vertices and an edge
- *
- * @warning For large graphs, result may be approximation, not exact
+ * @note Returns -1 on allocation failure
  *
  * @example
  * Graph *g = create_graph(6, false);
@@ -437,20 +831,9 @@ int calculate_connectivity_number(Graph *graph)
     /* Handle trivial cases */
     if (n <= 1)
         return 0;
-    if (n == 2)
-        return 1;
 
-    /* For small graphs, use exact algorithm */
-    if (n <= 12)
-    {
-        return find_min_vertex_cut_bruteforce(graph, NULL);
-    }
-    else
-    {
-        /* For larger graphs, use approximation */
-        printf("Note: Using approximation for large graph (n=%d). Result may not be exact.\n", n);
-        return find_min_vertex_cut_maxflow(graph, NULL);
-    }
+    /* Exact for every size: O(n + δ²) unit-capacity flows */
+    return find_min_vertex_cut_maxflow(graph, NULL);
 }
 
 /**
@@ -458,19 +841,19 @@ int calculate_connectivity_number(Graph *graph)
  *
  * This function performs detailed analysis of a graph's vertex connectivity
  * properties and prints comprehensive results including theoretical bounds,
- * exact/approximate connectivity values, minimum cuts, and structural insights.
+ * exact connectivity values, minimum cuts, and structural insights.
  *
  * Analysis includes:
  * - Basic graph statistics (vertices, edges, degree distribution)
  * - Theoretical bounds (Whitney's inequalities)
- * - Exact or approximate connectivity computation
+ * - Exact connectivity computation (vertex-split max-flow)
  * - Minimum vertex cut identification
  * - Structural properties and implications
  * - k-connectivity properties
  *
  * @param graph Pointer to the graph structure to analyze
  *
- * @complexity O(2^n * (V + E)) for small graphs, O(V²) for large graphs
+ * @complexity n - δ - 1 + δ(δ - 1) / 2 max-flow computations
  *
  * @pre graph must be valid with proper adjacency matrix
  * @post Comprehensive analysis printed to stdout
@@ -510,15 +893,13 @@ void analyze_connectivity_number(Graph *graph)
     printf("Graph has %d vertices.\n", n);
 
     /* Count edges */
-    int edge_count = 0;
-    for (int i = 0; i < n; i++)
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
     {
-        for (int j = graph->is_directed ? 0 : i + 1; j < n; j++)
-        {
-            if (graph->adjacency[i][j])
-                edge_count++;
-        }
+        printf("Error: Out of memory.\n");
+        return;
     }
+    int edge_count = csr->edge_count;
     printf("Graph has %d edges.\n", edge_count);
 
     /* Handle trivial cases */
@@ -544,8 +925,8 @@ void analyze_connectivity_number(Graph *graph)
         return;
     }
 
-    /* Check if already disconnected */
-    if (!is_connected_after_removal(graph, NULL, 0))
+    /* Check if already disconnected (as an undirected graph, like the flows) */
+    if (!connected_after_removal(graph, NULL, 0, BFS_WEAK))
     {
         printf("Connectivity number: 0\n");
         printf("Analysis: Graph is already disconnected.\n");
@@ -558,12 +939,7 @@ void analyze_connectivity_number(Graph *graph)
 
     for (int i = 0; i < n; i++)
     {
-        int degree = 0;
-        for (int j = 0; j < n; j++)
-        {
-            if (graph->adjacency[i][j])
-                degree++;
-        }
+        int degree = csr_degree(csr, i);
         if (degree < min_degree)
         {
             min_degree = degree;
@@ -583,25 +959,22 @@ void analyze_connectivity_number(Graph *graph)
     int *cut_vertices = NULL;
     int connectivity_num;
 
-    if (n <= 12)
+    connectivity_num = find_min_vertex_cut_maxflow(graph, &cut_vertices);
+    if (connectivity_num < 0)
     {
-        connectivity_num = find_min_vertex_cut_bruteforce(graph, &cut_vertices);
-        printf("Connectivity number (exact): %d\n", connectivity_num);
+        printf("Error: Out of memory.\n");
+        return;
+    }
+    printf("Connectivity number (exact): %d\n", connectivity_num);
 
-        if (cut_vertices && connectivity_num > 0)
+    if (cut_vertices && connectivity_num > 0)
+    {
+        printf("Minimum vertex cut: ");
+        for (int i = 0; i < connectivity_num; i++)
         {
-            printf("Minimum vertex cut: ");
-            for (int i = 0; i < connectivity_num; i++)
-            {
-                printf("v%d ", cut_vertices[i]);
-            }
-            printf("\n");
+            printf("v%d ", cut_vertices[i]);
         }
-    }
-    else
-    {
-        connectivity_num = find_min_vertex_cut_maxflow(graph, &cut_vertices);
-        printf("Connectivity number (approximation): %d\n", connectivity_num);
+        printf("\n");
     }
 
     /* Analysis of result */
@@ -0,0 +1,250 @@
+/**
+ * @file csr_graph.c
+ * @brief Compressed sparse row (CSR) graph storage implementation
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * CSR rows are built with two stable counting sorts, first by target and
+ * then by source. The second pass preserves the target order of the first,
+ * so every row ends up sorted in O(V + E) without comparison sorting.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <sys/mman.h>
+
+#include "csr_graph.h"
+
+/**
+ * @brief Groups arcs (src[i], dst[i]) into sorted CSR rows indexed by src
+ *
+ * @param n Number of vertices
+ * @param src Arc sources
+ * @param dst Arc targets
+ * @param m Number of arcs
+ * @param offsets_out Receives offsets array of size n + 1
+ * @param neighbors_out Receives neighbors array of size m
+ * @return true on success, false on allocation failure
+ *
+ * @complexity O(n + m)
+ */
+static bool build_sorted_rows(int n, const int *src, const int *dst, int m,
+                              int **offsets_out, int **neighbors_out)
+{
+    int *offsets = calloc(n + 1, sizeof(int));
+    int *neighbors = malloc((m > 0 ? m : 1) * sizeof(int));
+    int *order = malloc((m > 0 ? m : 1) * sizeof(int));
+    int *cursor = malloc((n + 1) * sizeof(int));
+    if (!offsets || !neighbors || !order || !cursor)
+    {
+        free(offsets);
+        free(neighbors);
+        free(order);
+        free(cursor);
+        return false;
+    }
+
+    /* Pass 1: stable counting sort of arc indices by target */
+    memset(cursor, 0, (n + 1) * sizeof(int));
+    for (int i = 0; i < m; i++)
+        cursor[dst[i] + 1]++;
+    for (int v = 0; v < n; v++)
+        cursor[v + 1] += cursor[v];
+    for (int i = 0; i < m; i++)
+        order[cursor[dst[i]]++] = i;
+
+    /* Pass 2: stable counting sort by source, keeping target order inside rows */
+    for (int i = 0; i < m; i++)
+        offsets[src[i] + 1]++;
+    for (int v = 0; v < n; v++)
+        offsets[v + 1] += offsets[v];
+    memcpy(cursor, offsets, (n + 1) * sizeof(int));
+    for (int k = 0; k < m; k++)
+    {
+        int i = order[k];
+        neighbors[cursor[src[i]]++] = dst[i];
+    }
+
+    free(order);
+    free(cursor);
+    *offsets_out = offsets;
+    *neighbors_out = neighbors;
+    return true;
+}
+
+CSRGraph *csr_create_from_edges(int node_count, const Edge *edges, int edge_count, bool is_directed)
+{
+    CSRGraph *csr = calloc(1, sizeof(CSRGraph));
+    if (!csr)
+        return NULL;
+    csr->node_count = node_count;
+    csr->edge_count = edge_count;
+    csr->is_directed = is_directed;
+
+    int m = is_directed ? edge_count : 2 * edge_count;
+    int *src = malloc((m > 0 ? m : 1) * sizeof(int));
+    int *dst = malloc((m > 0 ? m : 1) * sizeof(int));
+    if (!src || !dst)
+    {
+        free(src);
+        free(dst);
+        free(csr);
+        return NULL;
+    }
+
+    for (int i = 0; i < edge_count; i++)
+    {
+        src[i] = edges[i].u;
+        dst[i] = edges[i].v;
+        if (!is_directed)
+        {
+            src[edge_count + i] = edges[i].v;
+            dst[edge_count + i] = edges[i].u;
+        }
+    }
+
+    bool ok = build_sorted_rows(node_count, src, dst, m, &csr->offsets, &csr->neighbors);
+
+    /* Directed graphs: reverse CSR is the same construction with roles swapped */
+    if (ok && is_directed)
+        ok = build_sorted_rows(node_count, dst, src, m, &csr->in_offsets, &csr->in_neighbors);
+
+    free(src);
+    free(dst);
+    if (!ok)
+    {
+        csr_destroy(csr);
+        return NULL;
+    }
+    return csr;
+}
+
+CSRGraph *csr_create_from_adjacency(Graph *graph)
+{
+    if (!graph || !graph->adjacency)
+        return NULL;
+
+    int n = graph->node_count;
+    int edge_count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = (graph->is_directed ? 0 : i + 1); j < n; j++)
+        {
+            if (graph->adjacency[i][j])
+                edge_count++;
+        }
+    }
+
+    Edge *edges = malloc((edge_count > 0 ? edge_count : 1) * sizeof(Edge));
+    if (!edges)
+        return NULL;
+
+    int k = 0;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = (graph->is_directed ? 0 : i + 1); j < n; j++)
+        {
+            if (graph->adjacency[i][j])
+            {
+                edges[k].u = i;
+                edges[k].v = j;
+                k++;
+            }
+        }
+    }
+
+    CSRGraph *csr = csr_create_from_edges(n, edges, edge_count, graph->is_directed);
+    free(edges);
+    return csr;
+}
+
+void csr_destroy(CSRGraph *csr)
+{
+    if (!csr)
+        return;
+    if (csr->mapping)
+    {
+        // Arrays live in a graph_file_map() mapping
+        munmap(csr->mapping, csr->mapping_size);
+        free(csr);
+        return;
+    }
+    free(csr->offsets);
+    free(csr->neighbors);
+    free(csr->in_offsets);
+    free(csr->in_neighbors);
+    free(csr);
+}
+
+CSRGraph *graph_ensure_csr(Graph *graph)
+{
+    if (!graph)
+        return NULL;
+    if (!graph->csr)
+        graph->csr = csr_create_from_adjacency(graph);
+    return graph->csr;
+}
+
+bool graph_ensure_adjacency(Graph *graph)
+{
+    if (!graph)
+        return false;
+    if (graph->adjacency)
+        return true;
+    const CSRGraph *csr = graph->csr;
+    if (!csr)
+        return false;
+
+    int n = csr->node_count;
+    int **adjacency = calloc(n > 0 ? n : 1, sizeof(int *));
+    if (!adjacency)
+        return false;
+    for (int u = 0; u < n; u++)
+    {
+        adjacency[u] = calloc(n, sizeof(int));
+        if (!adjacency[u])
+        {
+            for (int v = 0; v < u; v++)
+                free(adjacency[v]);
+            free(adjacency);
+            return false;
+        }
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+            adjacency[u][csr->neighbors[k]] = 1;
+    }
+    graph->adjacency = adjacency;
+    return true;
+}
+
+void graph_free_storage(Graph *graph)
+{
+    if (!graph)
+        return;
+    if (graph->adjacency)
+    {
+        for (int i = 0; i < graph->node_count; i++)
+            free(graph->adjacency[i]);
+        free(graph->adjacency);
+        graph->adjacency = NULL;
+    }
+    csr_destroy(graph->csr);
+    graph->csr = NULL;
+}
+
+bool csr_has_edge(const CSRGraph *csr, int u, int v)
+{
+    int lo = csr->offsets[u];
+    int hi = csr->offsets[u + 1] - 1;
+    while (lo <= hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        int w = csr->neighbors[mid];
+        if (w == v)
+            return true;
+        if (w < v)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return false;
+}
@@ -0,0 +1,908 @@
+/**
+ * @file dynamic_graph.c
+ * @brief Graph with edge / vertex updates and cached analysis results
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Invariant while components_valid: the union-find nodes slot[v] of two
+ * vertices share a root iff the vertices are (weakly) connected, and
+ * components is the number of roots that some slot[v] leads to. While
+ * additionally bipartite and bipartite_valid, the parity of slot[v]
+ * relative to its root is a proper 2-coloring of v's component.
+ *
+ * Nodes left behind by a split stay in the forest as inner nodes, so the
+ * vertices still hanging below them keep their roots.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "dynamic_graph.h"
+#include "csr_graph.h"
+#include "graph_io.h"
+#include "clique.h"
+#include "independent_set.h"
+#include "connectivity_number.h"
+#include "set_utils.h"
+
+/** Outcome of the deletion probe */
+typedef enum
+{
+    PROBE_CONNECTED, /**< The endpoints are still connected */
+    PROBE_SPLIT,     /**< One endpoint's component ran out first */
+    PROBE_UNKNOWN    /**< DYNAMIC_GRAPH_PROBE_LIMIT reached */
+} ProbeResult;
+
+/* ========================================================================
+ * NEIGHBOR LISTS AND COUNTERS
+ * ========================================================================*/
+
+/**
+ * @brief Makes room for one more entry in the list of x
+ */
+static bool list_reserve(int **list, const int *len, int *cap, int x)
+{
+    if (len[x] < cap[x])
+        return true;
+    int new_cap = cap[x] > 0 ? 2 * cap[x] : 4;
+    int *grown = realloc(list[x], new_cap * sizeof(int));
+    if (!grown)
+        return false;
+    list[x] = grown;
+    cap[x] = new_cap;
+    return true;
+}
+
+/**
+ * @brief Removes v from the list of x by swapping in the last entry
+ */
+static bool list_erase(int **list, int *len, int x, int v)
+{
+    for (int i = 0; i < len[x]; i++)
+    {
+        if (list[x][i] == v)
+        {
+            list[x][i] = list[x][--len[x]];
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool list_contains(int *const *list, const int *len, int x, int v)
+{
+    for (int i = 0; i < len[x]; i++)
+        if (list[x][i] == v)
+            return true;
+    return false;
+}
+
+static int total_degree(const DynamicGraph *dg, int v)
+{
+    return dg->out_len[v] + (dg->graph.is_directed ? dg->in_len[v] : 0);
+}
+
+/**
+ * @brief Adds delta to the balance class of a vertex with out - in = diff
+ */
+static void count_balance(DynamicGraph *dg, int diff, int delta)
+{
+    if (diff == 1)
+        dg->surplus_vertices += delta;
+    else if (diff == -1)
+        dg->deficit_vertices += delta;
+    else if (diff != 0)
+        dg->skewed_vertices += delta;
+}
+
+/**
+ * @brief Updates the degree counters for one endpoint gaining (+1) or losing (-1) an edge
+ *
+ * Called before the lists change, so total_degree() is the old degree.
+ *
+ * @param out_side Digraphs: whether the arc leaves x
+ */
+static void count_endpoint(DynamicGraph *dg, int x, int delta, bool out_side)
+{
+    int before = total_degree(dg, x);
+    if (before == 0)
+        dg->isolated_vertices--;
+    else if (before + delta == 0)
+        dg->isolated_vertices++;
+
+    if (dg->graph.is_directed)
+    {
+        int diff = dg->out_len[x] - dg->in_len[x];
+        count_balance(dg, diff, -1);
+        count_balance(dg, diff + (out_side ? delta : -delta), 1);
+    }
+    else
+    {
+        dg->odd_vertices += before % 2 == 1 ? -1 : 1;
+    }
+}
+
+/* ========================================================================
+ * PARITY UNION-FIND
+ * ========================================================================*/
+
+/**
+ * @brief Root of node x with full path compression; *parity_out = color of x relative to the root
+ */
+static int uf_find(DynamicGraph *dg, int x, int *parity_out)
+{
+    int root = x, parity = 0;
+    while (dg->parent[root] != root)
+    {
+        parity ^= dg->parity[root];
+        root = dg->parent[root];
+    }
+    *parity_out = parity;
+
+    // Second pass: hang every vertex on the path below the root directly
+    int cur = x;
+    while (dg->parent[cur] != root && cur != root)
+    {
+        int next = dg->parent[cur];
+        int next_parity = parity ^ dg->parity[cur];
+        dg->parent[cur] = root;
+        dg->parity[cur] = (unsigned char)parity;
+        cur = next;
+        parity = next_parity;
+    }
+    return root;
+}
+
+/**
+ * @brief Unites the components of an edge's endpoints, giving them different colors
+ */
+static void uf_union(DynamicGraph *dg, int u, int v)
+{
+    int pu, pv;
+    int ru = uf_find(dg, dg->slot[u], &pu);
+    int rv = uf_find(dg, dg->slot[v], &pv);
+    if (ru == rv)
+    {
+        if (pu == pv)
+            dg->bipartite = false; // Odd cycle
+        return;
+    }
+    if (dg->rank[ru] < dg->rank[rv])
+    {
+        int t = ru;
+        ru = rv;
+        rv = t;
+    }
+    dg->parent[rv] = ru;
+    dg->parity[rv] = (unsigned char)(pu ^ pv ^ 1);
+    if (dg->rank[ru] == dg->rank[rv])
+        dg->rank[ru]++;
+    dg->components--;
+}
+
+/**
+ * @brief Rebuilds the union-find from the lists
+ *
+ * @complexity O(V + E α(V))
+ */
+static void uf_rebuild(DynamicGraph *dg)
+{
+    int n = dg->graph.node_count;
+    for (int v = 0; v < n; v++)
+    {
+        dg->slot[v] = v;
+        dg->parent[v] = v;
+        dg->rank[v] = 0;
+        dg->parity[v] = 0;
+    }
+    dg->slot_count = n;
+    dg->components = n;
+    dg->bipartite = !dg->graph.is_directed;
+    for (int u = 0; u < n; u++)
+        for (int i = 0; i < dg->out_len[u]; i++)
+            if (dg->graph.is_directed || dg->out[u][i] > u)
+                uf_union(dg, u, dg->out[u][i]);
+    dg->components_valid = true;
+    dg->bipartite_valid = true;
+}
+
+static void ensure_components(DynamicGraph *dg)
+{
+    if (!dg->components_valid || (!dg->bipartite_valid && !dg->graph.is_directed))
+        uf_rebuild(dg);
+}
+
+/**
+ * @brief Moves a component that was just cut off to fresh union-find nodes
+ *
+ * @param piece Every vertex of the new component
+ * @return false if the node pool is used up (the caller rebuilds instead)
+ *
+ * @complexity O(size + edges inside the piece)
+ */
+static bool uf_split(DynamicGraph *dg, const int *piece, int size)
+{
+    // Past 2V + limit nodes, a rebuild compacts the pool; at least V split
+    // vertices pay for each O(V + E) rebuild
+    if (dg->slot_count + size > 2 * dg->graph.node_count + DYNAMIC_GRAPH_PROBE_LIMIT + 1)
+        return false;
+    for (int i = 0; i < size; i++)
+    {
+        int node = dg->slot_count++;
+        dg->slot[piece[i]] = node;
+        dg->parent[node] = node;
+        dg->rank[node] = 0;
+        dg->parity[node] = 0;
+    }
+    dg->components += size;
+
+    // All edges of the piece lie inside it; uniting along them leaves the
+    // piece one component, so the count goes up by one in total
+    for (int i = 0; i < size; i++)
+    {
+        int x = piece[i];
+        for (int k = 0; k < dg->out_len[x]; k++)
+            uf_union(dg, x, dg->out[x][k]);
+    }
+    return true;
+}
+
+/**
+ * @brief Visits the unvisited (weak) neighbors of x for one side of the probe
+ *
+ * @return PROBE_CONNECTED if the other side's mark was reached, PROBE_UNKNOWN
+ *         if the visit budget ran out, PROBE_SPLIT otherwise (keep going)
+ */
+static ProbeResult probe_expand(DynamicGraph *dg, int x, int own, int other, int *queue, int *tail,
+                                int *visited)
+{
+    for (int pass = 0; pass < (dg->graph.is_directed ? 2 : 1); pass++)
+    {
+        const int *row = pass == 0 ? dg->out[x] : dg->in[x];
+        int len = pass == 0 ? dg->out_len[x] : dg->in_len[x];
+        for (int i = 0; i < len; i++)
+        {
+            int y = row[i];
+            if (dg->probe_mark[y] == other)
+                return PROBE_CONNECTED;
+            if (dg->probe_mark[y] == own)
+                continue;
+            if (++*visited > DYNAMIC_GRAPH_PROBE_LIMIT)
+                return PROBE_UNKNOWN;
+            dg->probe_mark[y] = own;
+            queue[(*tail)++] = y;
+        }
+    }
+    return PROBE_SPLIT;
+}
+
+/**
+ * @brief Checks whether u and v are still (weakly) connected after a deletion
+ *
+ * Two BFS grow from u and v alternately, one vertex expansion at a time,
+ * so the search costs about twice the smaller of the two sides: deleting
+ * a bridge to a small piece, or an edge on a short cycle, ends quickly.
+ *
+ * @param piece_out On PROBE_SPLIT, receives the vertices of the side that
+ *                  ran dry (the whole new component, in the probe queue)
+ * @param piece_size Receives their number
+ */
+static ProbeResult probe_connected(DynamicGraph *dg, int u, int v, const int **piece_out, int *piece_size)
+{
+    if (dg->probe_stamp > INT_MAX - 2)
+    {
+        memset(dg->probe_mark, 0, dg->capacity * sizeof(int));
+        dg->probe_stamp = 0;
+    }
+    int stamp_u = ++dg->probe_stamp;
+    int stamp_v = ++dg->probe_stamp;
+
+    // Each side enqueues at most DYNAMIC_GRAPH_PROBE_LIMIT + 1 vertices
+    int *queue_u = dg->probe_queue;
+    int *queue_v = dg->probe_queue + DYNAMIC_GRAPH_PROBE_LIMIT + 1;
+    int head_u = 0, tail_u = 0, head_v = 0, tail_v = 0, visited = 0;
+    dg->probe_mark[u] = stamp_u;
+    dg->probe_mark[v] = stamp_v;
+    queue_u[tail_u++] = u;
+    queue_v[tail_v++] = v;
+
+    for (;;)
+    {
+        ProbeResult r = probe_expand(dg, queue_u[head_u++], stamp_u, stamp_v, queue_u, &tail_u, &visited);
+        if (r != PROBE_SPLIT)
+            return r;
+        if (head_u == tail_u)
+        {
+            *piece_out = queue_u;
+            *piece_size = tail_u;
+            return PROBE_SPLIT;
+        }
+        r = probe_expand(dg, queue_v[head_v++], stamp_v, stamp_u, queue_v, &tail_v, &visited);
+        if (r != PROBE_SPLIT)
+            return r;
+        if (head_v == tail_v)
+        {
+            *piece_out = queue_v;
+            *piece_size = tail_v;
+            return PROBE_SPLIT;
+        }
+    }
+}
+
+/* ========================================================================
+ * CACHES
+ * ========================================================================*/
+
+static void drop_euler(DynamicGraph *dg)
+{
+    free(dg->euler_path);
+    dg->euler_path = NULL;
+    dg->euler_length = 0;
+    dg->euler_valid = false;
+}
+
+static void drop_clique(DynamicGraph *dg)
+{
+    if (!dg->clique)
+        return;
+    for (int i = 0; i < dg->clique->size; i++)
+        dg->in_clique[dg->clique->vertices[i]] = false;
+    set_destroy(dg->clique);
+    dg->clique = NULL;
+}
+
+static void drop_independent_set(DynamicGraph *dg)
+{
+    if (!dg->independent_set)
+        return;
+    for (int i = 0; i < dg->independent_set->size; i++)
+        dg->in_independent_set[dg->independent_set->vertices[i]] = false;
+    set_destroy(dg->independent_set);
+    dg->independent_set = NULL;
+}
+
+static void drop_kappa(DynamicGraph *dg)
+{
+    free(dg->kappa_cut);
+    dg->kappa_cut = NULL;
+    dg->kappa_valid = false;
+}
+
+/**
+ * @brief Common bookkeeping of every successful update
+ */
+static void mark_changed(DynamicGraph *dg)
+{
+    dg->version++;
+    csr_destroy(dg->graph.csr);
+    dg->graph.csr = NULL;
+    drop_kappa(dg);
+}
+
+/* ========================================================================
+ * CREATION AND GROWTH
+ * ========================================================================*/
+
+/**
+ * @brief Grows every per-vertex array to at least need slots
+ *
+ * Arrays already grown stay grown if a later one fails, so a failure
+ * leaves the graph usable at its old capacity.
+ */
+static bool reserve_vertices(DynamicGraph *dg, int need)
+{
+    if (need <= dg->capacity)
+        return true;
+    int cap = dg->capacity > 0 ? dg->capacity : 16;
+    while (cap < need)
+        cap = cap > INT_MAX / 2 ? need : 2 * cap;
+
+#define GROW(field, type, count)                                         \
+    do                                                                   \
+    {                                                                    \
+        type *grown = realloc(dg->field, (size_t)(count) * sizeof(type)); \
+        if (!grown)                                                      \
+            return false;                                                \
+        dg->field = grown;                                               \
+    } while (0)
+
+    // Union-find nodes: two per vertex plus one split piece (see uf_split())
+    size_t nodes = 2 * (size_t)cap + DYNAMIC_GRAPH_PROBE_LIMIT + 1;
+    GROW(out, int *, cap);
+    GROW(out_len, int, cap);
+    GROW(out_cap, int, cap);
+    if (dg->graph.is_directed)
+    {
+        GROW(in, int *, cap);
+        GROW(in_len, int, cap);
+        GROW(in_cap, int, cap);
+    }
+    GROW(slot, int, cap);
+    GROW(parent, int, nodes);
+    GROW(rank, int, nodes);
+    GROW(parity, unsigned char, nodes);
+    GROW(probe_mark, int, cap);
+    GROW(in_clique, bool, cap);
+    GROW(in_independent_set, bool, cap);
+#undef GROW
+
+    dg->capacity = cap;
+    return true;
+}
+
+/**
+ * @brief Initializes the slots of vertex v as an isolated vertex
+ */
+static void init_vertex(DynamicGraph *dg, int v)
+{
+    dg->out[v] = NULL;
+    dg->out_len[v] = 0;
+    dg->out_cap[v] = 0;
+    if (dg->graph.is_directed)
+    {
+        dg->in[v] = NULL;
+        dg->in_len[v] = 0;
+        dg->in_cap[v] = 0;
+    }
+    int node = dg->slot_count++;
+    dg->slot[v] = node;
+    dg->parent[node] = node;
+    dg->rank[node] = 0;
+    dg->parity[node] = 0;
+    dg->probe_mark[v] = 0;
+    dg->in_clique[v] = false;
+    dg->in_independent_set[v] = false;
+}
+
+DynamicGraph *dynamic_graph_create(int node_count, bool is_directed, bool allow_bidirectional)
+{
+    if (node_count < 0)
+        return NULL;
+    DynamicGraph *dg = calloc(1, sizeof(DynamicGraph));
+    if (!dg)
+        return NULL;
+    dg->graph.is_directed = is_directed;
+    dg->graph.allow_bidirectional = allow_bidirectional;
+    dg->probe_queue = malloc(2 * (DYNAMIC_GRAPH_PROBE_LIMIT + 1) * sizeof(int));
+    if (!dg->probe_queue || !reserve_vertices(dg, node_count))
+    {
+        dynamic_graph_destroy(dg);
+        return NULL;
+    }
+    for (int v = 0; v < node_count; v++)
+        init_vertex(dg, v);
+    dg->graph.node_count = node_count;
+    dg->isolated_vertices = node_count;
+    dg->components = node_count;
+    dg->components_valid = true;
+    dg->bipartite = !is_directed;
+    dg->bipartite_valid = true;
+    return dg;
+}
+
+/**
+ * @brief Appends edge u → v to the lists and counters without any check
+ */
+static bool insert_edge(DynamicGraph *dg, int u, int v)
+{
+    bool directed = dg->graph.is_directed;
+    int **target = directed ? dg->in : dg->out;
+    int *target_len = directed ? dg->in_len : dg->out_len;
+    int *target_cap = directed ? dg->in_cap : dg->out_cap;
+    if (!list_reserve(dg->out, dg->out_len, dg->out_cap, u) || !list_reserve(target, target_len, target_cap, v))
+        return false;
+
+    count_endpoint(dg, u, 1, true);
+    count_endpoint(dg, v, 1, false);
+    dg->out[u][dg->out_len[u]++] = v;
+    target[v][target_len[v]++] = u;
+    dg->edge_count++;
+    if (dg->graph.adjacency)
+    {
+        dg->graph.adjacency[u][v] = 1;
+        if (!directed)
+            dg->graph.adjacency[v][u] = 1;
+    }
+    if (dg->components_valid)
+        uf_union(dg, u, v);
+    return true;
+}
+
+DynamicGraph *dynamic_graph_from_graph(Graph *graph)
+{
+    CSRGraph *csr = graph ? graph_ensure_csr(graph) : NULL;
+    if (!csr)
+        return NULL;
+    DynamicGraph *dg = dynamic_graph_create(csr->node_count, csr->is_directed, graph->allow_bidirectional);
+    if (!dg)
+        return NULL;
+    for (int u = 0; u < csr->node_count; u++)
+    {
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+        {
+            int v = csr->neighbors[k];
+            if (v == u || (!csr->is_directed && v < u))
+                continue;
+            if (!insert_edge(dg, u, v))
+            {
+                dynamic_graph_destroy(dg);
+                return NULL;
+            }
+        }
+    }
+    return dg;
+}
+
+void dynamic_graph_destroy(DynamicGraph *dg)
+{
+    if (!dg)
+        return;
+    for (int v = 0; v < dg->graph.node_count; v++)
+    {
+        free(dg->out[v]);
+        if (dg->graph.is_directed)
+            free(dg->in[v]);
+    }
+    free(dg->out);
+    free(dg->out_len);
+    free(dg->out_cap);
+    free(dg->in);
+    free(dg->in_len);
+    free(dg->in_cap);
+    free(dg->slot);
+    free(dg->parent);
+    free(dg->rank);
+    free(dg->parity);
+    free(dg->probe_mark);
+    free(dg->probe_queue);
+    drop_euler(dg);
+    drop_clique(dg);
+    drop_independent_set(dg);
+    drop_kappa(dg);
+    free(dg->in_clique);
+    free(dg->in_independent_set);
+    graph_free_storage(&dg->graph);
+    free(dg);
+}
+
+/* ========================================================================
+ * UPDATES
+ * ========================================================================*/
+
+static bool valid_vertex(const DynamicGraph *dg, int v)
+{
+    return v >= 0 && v < dg->graph.node_count;
+}
+
+bool dynamic_graph_has_edge(const DynamicGraph *dg, int u, int v)
+{
+    if (!dg || !valid_vertex(dg, u) || !valid_vertex(dg, v))
+        return false;
+    if (dg->graph.adjacency)
+        return dg->graph.adjacency[u][v] != 0;
+    if (dg->graph.is_directed)
+    {
+        if (dg->out_len[u] <= dg->in_len[v])
+            return list_contains(dg->out, dg->out_len, u, v);
+        return list_contains(dg->in, dg->in_len, v, u);
+    }
+    if (dg->out_len[u] <= dg->out_len[v])
+        return list_contains(dg->out, dg->out_len, u, v);
+    return list_contains(dg->out, dg->out_len, v, u);
+}
+
+/**
+ * @brief Number of common neighbors of u and v (undirected), via the probe stamps
+ */
+static int common_neighbors(DynamicGraph *dg, int u, int v)
+{
+    if (dg->probe_stamp > INT_MAX - 1)
+    {
+        memset(dg->probe_mark, 0, dg->capacity * sizeof(int));
+        dg->probe_stamp = 0;
+    }
+    int stamp = ++dg->probe_stamp;
+    for (int i = 0; i < dg->out_len[u]; i++)
+        dg->probe_mark[dg->out[u][i]] = stamp;
+    int common = 0;
+    for (int i = 0; i < dg->out_len[v]; i++)
+        if (dg->probe_mark[dg->out[v][i]] == stamp)
+            common++;
+    return common;
+}
+
+bool dynamic_graph_add_edge(DynamicGraph *dg, int u, int v)
+{
+    if (!dg || !valid_vertex(dg, u) || !valid_vertex(dg, v) || u == v || dg->edge_count == INT_MAX)
+        return false;
+    if (dynamic_graph_has_edge(dg, u, v))
+        return false;
+    if (dg->graph.is_directed && !dg->graph.allow_bidirectional && dynamic_graph_has_edge(dg, v, u))
+        return false;
+    if (!insert_edge(dg, u, v))
+        return false;
+
+    mark_changed(dg);
+    drop_euler(dg);
+    if (dg->clique && common_neighbors(dg, u, v) >= dg->clique->size - 1)
+        drop_clique(dg); // {u, v} plus ω - 1 common neighbors may be a larger clique
+    if (dg->independent_set && dg->in_independent_set[u] && dg->in_independent_set[v])
+        drop_independent_set(dg);
+    return true;
+}
+
+bool dynamic_graph_remove_edge(DynamicGraph *dg, int u, int v)
+{
+    if (!dg || !valid_vertex(dg, u) || !valid_vertex(dg, v) || u == v)
+        return false;
+    if (!dynamic_graph_has_edge(dg, u, v))
+        return false;
+    bool directed = dg->graph.is_directed;
+
+    count_endpoint(dg, u, -1, true);
+    count_endpoint(dg, v, -1, false);
+    list_erase(dg->out, dg->out_len, u, v);
+    if (directed)
+        list_erase(dg->in, dg->in_len, v, u);
+    else
+        list_erase(dg->out, dg->out_len, v, u);
+    dg->edge_count--;
+    if (dg->graph.adjacency)
+    {
+        dg->graph.adjacency[u][v] = 0;
+        if (!directed)
+            dg->graph.adjacency[v][u] = 0;
+    }
+
+    // A bipartite component stays bipartite with the same coloring as long
+    // as it stays connected; an odd cycle may have been broken
+    if (dg->components_valid)
+    {
+        if (!directed && !dg->bipartite)
+            dg->bipartite_valid = false;
+        const int *piece = NULL;
+        int piece_size = 0;
+        ProbeResult r = PROBE_CONNECTED;
+        if (!directed || !list_contains(dg->out, dg->out_len, v, u))
+            r = probe_connected(dg, u, v, &piece, &piece_size);
+        if (r == PROBE_UNKNOWN || (r == PROBE_SPLIT && !uf_split(dg, piece, piece_size)))
+            dg->components_valid = false;
+    }
+
+    mark_changed(dg);
+    drop_euler(dg);
+    drop_independent_set(dg); // Freed endpoints may both join the set
+    if (dg->clique && dg->in_clique[u] && dg->in_clique[v])
+        drop_clique(dg);
+    return true;
+}
+
+/**
+ * @brief Appends a zero row and column to the adjacency matrix
+ *
+ * The matrix is only a mirror of the lists: on failure, or past
+ * GRAPH_IO_MATRIX_MAX_NODES vertices, it is dropped instead.
+ */
+static void grow_matrix(DynamicGraph *dg, int n)
+{
+    int **adjacency = dg->graph.adjacency;
+    bool ok = n + 1 <= GRAPH_IO_MATRIX_MAX_NODES;
+    for (int i = 0; ok && i < n; i++)
+    {
+        int *row = realloc(adjacency[i], (n + 1) * sizeof(int));
+        if (!row)
+            ok = false;
+        else
+        {
+            row[n] = 0;
+            adjacency[i] = row;
+        }
+    }
+    int **rows = ok ? realloc(adjacency, (n + 1) * sizeof(int *)) : NULL;
+    if (rows)
+    {
+        rows[n] = calloc(n + 1, sizeof(int));
+        dg->graph.adjacency = rows;
+        if (rows[n])
+            return;
+        adjacency = rows;
+    }
+    for (int i = 0; i < n; i++)
+        free(adjacency[i]);
+    free(adjacency);
+    dg->graph.adjacency = NULL;
+}
+
+int dynamic_graph_add_vertex(DynamicGraph *dg)
+{
+    if (!dg || dg->graph.node_count == INT_MAX)
+        return -1;
+    int v = dg->graph.node_count;
+    if (!reserve_vertices(dg, v + 1))
+        return -1;
+    init_vertex(dg, v);
+    if (dg->graph.adjacency)
+        grow_matrix(dg, v);
+    dg->graph.node_count++;
+    dg->isolated_vertices++;
+    dg->components++;
+
+    // An isolated vertex changes no edge walk and no clique of size ≥ 1,
+    // and joins every maximum independent set
+    mark_changed(dg);
+    if (v == 0)
+        drop_clique(dg);
+    if (dg->independent_set)
+    {
+        Set *grown = set_create(dg->independent_set->size + 1);
+        if (grown)
+        {
+            memcpy(grown->vertices, dg->independent_set->vertices, dg->independent_set->size * sizeof(int));
+            grown->size = dg->independent_set->size;
+            set_add(grown, v);
+            set_destroy(dg->independent_set);
+            dg->independent_set = grown;
+            dg->in_independent_set[v] = true;
+        }
+        else
+            drop_independent_set(dg);
+    }
+    return v;
+}
+
+/* ========================================================================
+ * QUERIES
+ * ========================================================================*/
+
+int dynamic_graph_degree(const DynamicGraph *dg, int v)
+{
+    return valid_vertex(dg, v) ? dg->out_len[v] : 0;
+}
+
+int dynamic_graph_in_degree(const DynamicGraph *dg, int v)
+{
+    if (!valid_vertex(dg, v))
+        return 0;
+    return dg->graph.is_directed ? dg->in_len[v] : dg->out_len[v];
+}
+
+int dynamic_graph_component_count(DynamicGraph *dg)
+{
+    if (!dg->components_valid)
+        uf_rebuild(dg);
+    return dg->components;
+}
+
+bool dynamic_graph_same_component(DynamicGraph *dg, int u, int v)
+{
+    if (!valid_vertex(dg, u) || !valid_vertex(dg, v))
+        return false;
+    if (!dg->components_valid)
+        uf_rebuild(dg);
+    int pu, pv;
+    return uf_find(dg, dg->slot[u], &pu) == uf_find(dg, dg->slot[v], &pv);
+}
+
+bool dynamic_graph_is_bipartite(DynamicGraph *dg)
+{
+    if (dg->graph.is_directed)
+        return false;
+    ensure_components(dg);
+    return dg->bipartite;
+}
+
+EulerStatus dynamic_graph_euler_status(DynamicGraph *dg)
+{
+    if (dg->euler_valid)
+        return dg->euler_status;
+
+    // Same checks in the same order as euler_path_csr()
+    if (dg->graph.is_directed)
+    {
+        if (dg->skewed_vertices > 0 || dg->surplus_vertices != dg->deficit_vertices || dg->surplus_vertices > 1)
+            return EULER_UNBALANCED;
+    }
+    else if (dg->odd_vertices != 0 && dg->odd_vertices != 2)
+    {
+        return EULER_ODD_DEGREES;
+    }
+    if (dg->edge_count == 0)
+        return EULER_NO_EDGES;
+    if (dynamic_graph_component_count(dg) - dg->isolated_vertices > 1)
+        return EULER_DISCONNECTED;
+    if (dg->graph.is_directed)
+        return dg->surplus_vertices == 0 ? EULER_CYCLE : EULER_PATH;
+    return dg->odd_vertices == 0 ? EULER_CYCLE : EULER_PATH;
+}
+
+Graph *dynamic_graph_view(DynamicGraph *dg)
+{
+    if (dg->graph.csr)
+        return &dg->graph;
+
+    Edge *edges = malloc((dg->edge_count > 0 ? dg->edge_count : 1) * sizeof(Edge));
+    if (!edges)
+        return NULL;
+    int m = 0;
+    for (int u = 0; u < dg->graph.node_count; u++)
+    {
+        for (int i = 0; i < dg->out_len[u]; i++)
+        {
+            int v = dg->out[u][i];
+            if (dg->graph.is_directed || v > u)
+                edges[m++] = (Edge){u, v};
+        }
+    }
+    dg->graph.csr = csr_create_from_edges(dg->graph.node_count, edges, m, dg->graph.is_directed);
+    free(edges);
+    return dg->graph.csr ? &dg->graph : NULL;
+}
+
+EulerStatus dynamic_graph_euler_path(DynamicGraph *dg, const int **path_out, int *length_out)
+{
+    if (!dg->euler_valid)
+    {
+        Graph *view = dynamic_graph_view(dg);
+        if (!view)
+        {
+            *path_out = NULL;
+            *length_out = 0;
+            return EULER_NO_MEMORY;
+        }
+        dg->euler_status = euler_path_csr(view->csr, &dg->euler_path, &dg->euler_length);
+        dg->euler_valid = dg->euler_status != EULER_NO_MEMORY;
+    }
+    *path_out = dg->euler_path;
+    *length_out = dg->euler_length;
+    return dg->euler_status;
+}
+
+const Set *dynamic_graph_maximum_clique(DynamicGraph *dg)
+{
+    if (dg->graph.is_directed)
+        return NULL;
+    if (!dg->clique)
+    {
+        Graph *view = dynamic_graph_view(dg);
+        dg->clique = view ? find_maximum_clique(view) : NULL;
+        if (dg->clique)
+            for (int i = 0; i < dg->clique->size; i++)
+                dg->in_clique[dg->clique->vertices[i]] = true;
+    }
+    return dg->clique;
+}
+
+const Set *dynamic_graph_independent_set(DynamicGraph *dg)
+{
+    if (dg->graph.is_directed)
+        return NULL;
+    if (!dg->independent_set)
+    {
+        Graph *view = dynamic_graph_view(dg);
+        dg->independent_set = view ? find_maximum_independent_set(view) : NULL;
+        if (dg->independent_set)
+            for (int i = 0; i < dg->independent_set->size; i++)
+                dg->in_independent_set[dg->independent_set->vertices[i]] = true;
+    }
+    return dg->independent_set;
+}
+
+int dynamic_graph_connectivity_number(DynamicGraph *dg, const int **cut_out)
+{
+    if (!dg->kappa_valid)
+    {
+        Graph *view = dynamic_graph_view(dg);
+        if (!view)
+        {
+            if (cut_out)
+                *cut_out = NULL;
+            return -1;
+        }
+        dg->kappa = find_min_vertex_cut_maxflow(view, &dg->kappa_cut);
+        dg->kappa_valid = dg->kappa >= 0; // Retry after an allocation failure
+    }
+    if (cut_out)
+        *cut_out = dg->kappa_cut;
+    return dg->kappa;
+}
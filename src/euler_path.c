@@ -3,6 +3,12 @@
  * @brief Eulerian path/cycle detection using Hierholzer's algorithm
  * @author Graph Theory Project Team
  * @date 2024
+ *
+ * The engine works on the CSR view only. Both slots of an undirected edge
+ * carry the same edge id (an arc of a digraph is identified by its out-row
+ * slot), a bitmap marks used edges, and a per-vertex cursor remembers the
+ * first slot that may still be unused, so every slot is inspected a
+ * constant number of times: O(V + E) overall.
  */
 
 #include <stdlib.h>
@@ -11,16 +17,13 @@
 #include <string.h>
 
 #include "euler_path.h"
+#include "csr_graph.h"
+#include "bitset.h"
+#include "bfs.h"
 
-static void dfs_conn(Graph *graph, int u, bool visited[])
-{
-    visited[u] = true;
-    for (int v = 0; v < graph->node_count; v++)
-    {
-        if (graph->adjacency[u][v] && !visited[v])
-            dfs_conn(graph, v, visited);
-    }
-}
+/* ========================================================================
+ * CONNECTIVITY AND DEGREES
+ * ========================================================================*/
 
 bool is_connected_for_euler(Graph *graph, int *degrees)
 {
@@ -36,151 +39,307 @@ bool is_connected_for_euler(Graph *graph, int *degrees)
     if (start_node == -1)
         return true;
 
-    bool *visited = calloc(graph->node_count, sizeof(bool));
-    dfs_conn(graph, start_node, visited);
+    // Weak reachability: arcs of a digraph are followed in both directions
+    CSRGraph *csr = graph_ensure_csr(graph);
+    BFSWorkspace *ws = csr ? bfs_workspace_create(graph->node_count, 0) : NULL;
+    if (!ws)
+        return false;
+    bfs_run(ws, csr, &start_node, 1, BFS_WEAK, NULL);
 
-    for (int i = 0; i < graph->node_count; i++)
+    bool connected = true;
+    for (int i = 0; i < graph->node_count && connected; i++)
     {
-        if (degrees[i] > 0 && !visited[i])
-        {
-            free(visited);
-            return false;
-        }
+        if (degrees[i] > 0 && ws->level[i] < 0)
+            connected = false;
     }
-    free(visited);
-    return true;
+    bfs_workspace_destroy(ws);
+    return connected;
 }
 
 int count_adj(Graph *graph, int u)
 {
-    int c = 0;
-    for (int v = 0; v < graph->node_count; v++)
-        if (graph->adjacency[u][v])
-            c++;
-    return c;
+    CSRGraph *csr = graph_ensure_csr(graph);
+    return csr ? csr_degree(csr, u) : 0;
 }
 
+/* ========================================================================
+ * HIERHOLZER ENGINE
+ * ========================================================================*/
+
 /**
- * @brief Hierholzer's algorithm for finding Eulerian paths/cycles
+ * @brief Labels both CSR slots of every undirected edge with a shared edge id
+ *
+ * Rows are sorted, so the slots of v that point to smaller vertices u come
+ * first and in increasing order of u. Visiting u in increasing order and
+ * filling those slots with a per-row cursor pairs every slot with its twin
+ * without any search.
  */
-void find_euler_path(Graph *original_graph)
+static void label_undirected_edges(const CSRGraph *csr, int *edge_id, int *fill)
 {
-    if (original_graph->is_directed)
-    {
-        printf("\nEuler path finding implemented only for undirected graphs.\n");
-        return;
-    }
+    int n = csr->node_count;
+    for (int v = 0; v < n; v++)
+        fill[v] = csr->offsets[v];
 
-    int n = original_graph->node_count;
-    int *degrees = calloc(n, sizeof(int));
-
-    // Calculate degrees
-    for (int i = 0; i < n; i++)
+    int next_id = 0;
+    for (int u = 0; u < n; u++)
     {
-        for (int j = 0; j < n; j++)
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
         {
-            if (original_graph->adjacency[i][j])
-                degrees[i]++;
+            int v = csr->neighbors[k];
+            if (v > u)
+            {
+                edge_id[k] = next_id;
+                edge_id[fill[v]++] = next_id;
+                next_id++;
+            }
         }
     }
+}
 
-    // Check connectivity of non-zero degree vertices
-    if (!is_connected_for_euler(original_graph, degrees))
-    {
-        printf("\nGraph's non-zero degree vertices are not connected. No Euler Path.\n");
-        free(degrees);
-        return;
-    }
-
-    // Check Eulerian conditions
-    int odd_count = 0, start = -1;
-    for (int i = 0; i < n; i++)
+/**
+ * @brief Picks the start vertex of an undirected walk from the degree parities
+ *
+ * @return EULER_PATH / EULER_CYCLE with *start set, or the failure status
+ */
+static EulerStatus undirected_start(const CSRGraph *csr, int *start)
+{
+    int odd_count = 0, first_used = -1;
+    *start = -1;
+    for (int v = 0; v < csr->node_count; v++)
     {
-        if (degrees[i] % 2 == 1)
+        int deg = csr_degree(csr, v);
+        if (deg % 2 == 1)
         {
             odd_count++;
-            if (start == -1)
-                start = i;
+            if (*start == -1)
+                *start = v;
         }
+        if (deg > 0 && first_used == -1)
+            first_used = v;
     }
-
     if (odd_count != 0 && odd_count != 2)
+        return EULER_ODD_DEGREES;
+    if (first_used == -1)
+        return EULER_NO_EDGES;
+    if (*start == -1)
+        *start = first_used;
+    return odd_count == 0 ? EULER_CYCLE : EULER_PATH;
+}
+
+/**
+ * @brief Picks the start vertex of a directed walk from the in/out balance
+ *
+ * A circuit needs out(v) = in(v) everywhere; a path needs one vertex with
+ * out - in = 1 (the start), one with in - out = 1 (the end) and balance
+ * elsewhere.
+ *
+ * @return EULER_PATH / EULER_CYCLE with *start set, or the failure status
+ */
+static EulerStatus directed_start(const CSRGraph *csr, int *start)
+{
+    int surplus = 0, deficit = 0, first_used = -1;
+    *start = -1;
+    for (int v = 0; v < csr->node_count; v++)
     {
-        printf("\nNot Eulerian: %d vertices with odd degree.\n", odd_count);
-        free(degrees);
-        return;
+        int diff = csr_degree(csr, v) - csr_in_degree(csr, v);
+        if (diff == 1)
+        {
+            surplus++;
+            *start = v;
+        }
+        else if (diff == -1)
+            deficit++;
+        else if (diff != 0)
+            return EULER_UNBALANCED;
+        if (csr_degree(csr, v) > 0 && first_used == -1)
+            first_used = v;
     }
+    if (surplus != deficit || surplus > 1)
+        return EULER_UNBALANCED;
+    if (first_used == -1)
+        return EULER_NO_EDGES;
+    if (*start == -1)
+        *start = first_used;
+    return surplus == 0 ? EULER_CYCLE : EULER_PATH;
+}
+
+/**
+ * @brief Hierholzer walk over CSR slots, shared by both edge models
+ *
+ * @param csr Graph whose rows are walked (out-rows for digraphs)
+ * @param start First vertex of the walk
+ * @param edge_id Edge id of every CSR slot, or NULL when each slot is its own edge
+ * @param edge_count Number of distinct edge ids
+ * @param path Output buffer of edge_count + 1 vertices
+ * @return true if the walk used every edge (edges are (weakly) connected)
+ */
+static bool hierholzer_walk(const CSRGraph *csr, int start, const int *edge_id, int edge_count,
+                            int *cursor, uint64_t *used, int *stack, int *path)
+{
+    for (int v = 0; v < csr->node_count; v++)
+        cursor[v] = csr->offsets[v];
 
-    if (start == -1)
+    // One push per used edge plus the start vertex: stack and path need at
+    // most edge_count + 1 slots
+    int stack_sz = 0;
+    int path_pos = edge_count + 1; // Path is written back to front, so it ends up start-first
+    stack[stack_sz++] = start;
+    while (stack_sz > 0)
     {
-        for (int i = 0; i < n; i++)
-            if (degrees[i] > 0)
-            {
-                start = i;
-                break;
-            }
+        int v = stack[stack_sz - 1];
+        int end = csr->offsets[v + 1];
+        int k = cursor[v];
+        while (k < end && bitset_test(used, edge_id ? edge_id[k] : k))
+            k++;
+
+        if (k < end)
+        {
+            bitset_set(used, edge_id ? edge_id[k] : k);
+            cursor[v] = k + 1;
+            stack[stack_sz++] = csr->neighbors[k];
+        }
+        else
+        {
+            cursor[v] = k;
+            path[--path_pos] = v;
+            stack_sz--;
+        }
     }
 
-    if (start == -1)
+    // Edges outside the start component were never reached
+    return path_pos == 0;
+}
+
+EulerStatus euler_path_csr(const CSRGraph *csr, int **path_out, int *length_out)
+{
+    *path_out = NULL;
+    *length_out = 0;
+
+    int start;
+    EulerStatus status = csr->is_directed ? directed_start(csr, &start) : undirected_start(csr, &start);
+    if (status != EULER_PATH && status != EULER_CYCLE)
+        return status;
+
+    /* Undirected edges occupy two slots and need a shared id; arcs use their slot */
+    int n = csr->node_count;
+    int m = csr->edge_count;
+    int *edge_id = csr->is_directed ? NULL : malloc(2 * m * sizeof(int));
+    int *cursor = malloc(n * sizeof(int));
+    uint64_t *used = calloc(bitset_words(m), sizeof(uint64_t));
+    int *stack = malloc((m + 1) * sizeof(int));
+    int *path = malloc((m + 1) * sizeof(int));
+    if ((!edge_id && !csr->is_directed) || !cursor || !used || !stack || !path)
     {
-        printf("\nTrivial Euler path (no edges).\n");
-        free(degrees);
-        return;
+        free(edge_id);
+        free(cursor);
+        free(used);
+        free(stack);
+        free(path);
+        return EULER_NO_MEMORY;
     }
 
-    // Copy adjacency matrix for modification
-    int **adj = malloc(n * sizeof(int *));
-    for (int i = 0; i < n; i++)
+    if (edge_id)
+        label_undirected_edges(csr, edge_id, cursor);
+    bool complete = hierholzer_walk(csr, start, edge_id, m, cursor, used, stack, path);
+
+    free(edge_id);
+    free(cursor);
+    free(used);
+    free(stack);
+
+    if (!complete)
     {
-        adj[i] = malloc(n * sizeof(int));
-        memcpy(adj[i], original_graph->adjacency[i], n * sizeof(int));
+        free(path);
+        return EULER_DISCONNECTED;
     }
 
-    // Hierholzer's algorithm
-    int *stack = malloc((n * n + 10) * sizeof(int));
-    int stack_sz = 0;
-    int *path = malloc((n * n + 10) * sizeof(int));
-    int path_sz = 0;
+    *path_out = path;
+    *length_out = m + 1;
+    return status;
+}
 
-    stack[stack_sz++] = start;
-    while (stack_sz > 0)
+EulerStatus euler_path_compute(Graph *graph, int **path_out, int *length_out)
+{
+    *path_out = NULL;
+    *length_out = 0;
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return EULER_NO_MEMORY;
+    return euler_path_csr(csr, path_out, length_out);
+}
+
+/* ========================================================================
+ * REPORTING
+ * ========================================================================*/
+
+/**
+ * @brief Prints the Eulerian path/cycle found by euler_path_compute()
+ */
+void find_euler_path(Graph *original_graph)
+{
+    int *path = NULL;
+    int length = 0;
+    EulerStatus status = euler_path_compute(original_graph, &path, &length);
+
+    switch (status)
     {
-        int v = stack[stack_sz - 1];
-        int u = -1;
-        for (int w = 0; w < n; w++)
+    case EULER_DISCONNECTED:
+        if (original_graph->is_directed)
+            printf("\nGraph's non-zero degree vertices are not weakly connected. No Euler Path.\n");
+        else
+            printf("\nGraph's non-zero degree vertices are not connected. No Euler Path.\n");
+        return;
+    case EULER_ODD_DEGREES:
+    case EULER_UNBALANCED:
+    {
+        // Report disconnection first, as a failed walk would
+        CSRGraph *csr = graph_ensure_csr(original_graph);
+        int n = original_graph->node_count;
+        int *degrees = csr ? malloc((n > 0 ? n : 1) * sizeof(int)) : NULL;
+        if (!degrees)
         {
-            if (adj[v][w])
-            {
-                u = w;
-                break;
-            }
+            printf("\nError: Out of memory while searching for an Euler path.\n");
+            return;
         }
-        if (u != -1)
+        int bad_count = 0;
+        for (int i = 0; i < n; i++)
         {
-            adj[v][u] = adj[u][v] = 0;
-            stack[stack_sz++] = u;
+            int out = csr_degree(csr, i), in = csr_in_degree(csr, i);
+            degrees[i] = original_graph->is_directed ? out + in : out;
+            bad_count += original_graph->is_directed ? out != in : out % 2;
         }
+        if (!is_connected_for_euler(original_graph, degrees))
+            printf("\nGraph's non-zero degree vertices are not %sconnected. No Euler Path.\n",
+                   original_graph->is_directed ? "weakly " : "");
+        else if (status == EULER_UNBALANCED)
+            printf("\nNot Eulerian: %d vertices with in-degree != out-degree.\n", bad_count);
         else
-        {
-            path[path_sz++] = v;
-            stack_sz--;
-        }
+            printf("\nNot Eulerian: %d vertices with odd degree.\n", bad_count);
+        free(degrees);
+        return;
+    }
+    case EULER_NO_EDGES:
+        printf("\nTrivial Euler path (no edges).\n");
+        return;
+    case EULER_NO_MEMORY:
+        printf("\nError: Out of memory while searching for an Euler path.\n");
+        return;
+    case EULER_PATH:
+    case EULER_CYCLE:
+        break;
     }
 
     printf("\n=== Euler Path/Cycle ===\n");
+    printf("Type: %s %s\n", original_graph->is_directed ? "directed" : "undirected",
+           status == EULER_CYCLE ? "circuit" : "path");
     printf("Path: ");
-    for (int i = path_sz - 1; i >= 0; i--)
+    for (int i = 0; i < length; i++)
     {
-        if (i != path_sz - 1)
+        if (i != 0)
             printf(" -> ");
         printf("%d", path[i]);
     }
-    printf("\nLength: %d vertices\n", path_sz);
+    printf("\nLength: %d vertices\n", length);
 
-    for (int i = 0; i < n; i++)
-        free(adj[i]);
-    free(adj);
-    free(stack);
     free(path);
-    free(degrees);
-}
\ No newline at end of file
+}
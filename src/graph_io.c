@@ -0,0 +1,535 @@
+/**
+ * @file graph_io.c
+ * @brief Binary graph file and text parser implementation
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Binary files are written with a handful of large fwrite calls and loaded
+ * with a single read-only mmap; the CSRGraph returned by graph_file_map()
+ * only holds pointers into the mapping.
+ *
+ * Text files are mapped as well and scanned line by line with a hand-rolled
+ * integer parser. Edges are collected in a flat list and turned into CSR by
+ * csr_create_from_edges(); duplicates then sit next to each other in the
+ * sorted rows and are squeezed out in one pass.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "graph_io.h"
+#include "csr_graph.h"
+
+_Static_assert(sizeof(int) == 4, "graph files store 32-bit vertex indices");
+
+static const char graph_file_magic[8] = {'G', 'R', 'A', 'P', 'H', 'C', 'S', 'R'};
+
+typedef struct
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    int64_t node_count;
+    int64_t arc_count;
+    int64_t edge_count;
+} GraphFileHeader;
+
+/* ========================================================================
+ * BINARY FORMAT
+ * ========================================================================*/
+
+static bool write_ints(FILE *file, const int *data, size_t count)
+{
+    return count == 0 || fwrite(data, sizeof(int), count, file) == count;
+}
+
+int graph_file_write(const CSRGraph *csr, const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (!file)
+        return -1;
+
+    int n = csr->node_count;
+    int m = csr->offsets[n];
+    GraphFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, graph_file_magic, sizeof(graph_file_magic));
+    header.version = GRAPH_FILE_VERSION;
+    header.flags = csr->is_directed ? GRAPH_FILE_DIRECTED : 0;
+    header.node_count = n;
+    header.arc_count = m;
+    header.edge_count = csr->edge_count;
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              write_ints(file, csr->offsets, (size_t)n + 1) &&
+              write_ints(file, csr->neighbors, m);
+    if (ok && csr->is_directed)
+        ok = write_ints(file, csr->in_offsets, (size_t)n + 1) && write_ints(file, csr->in_neighbors, m);
+    if (fclose(file) != 0)
+        ok = false;
+    return ok ? 0 : -1;
+}
+
+/**
+ * @brief Checks one CSR half: offsets monotone, rows strictly ascending, indices in range
+ */
+static bool valid_rows(const int *offsets, const int *neighbors, int n, int m)
+{
+    if (offsets[0] != 0 || offsets[n] != m)
+        return false;
+    for (int u = 0; u < n; u++)
+    {
+        if (offsets[u + 1] < offsets[u] || offsets[u + 1] > m)
+            return false;
+        for (int k = offsets[u]; k < offsets[u + 1]; k++)
+        {
+            int v = neighbors[k];
+            if (v < 0 || v >= n || (k > offsets[u] && v <= neighbors[k - 1]))
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Binary search for v in the sorted row of u
+ */
+static bool row_contains(const int *offsets, const int *neighbors, int u, int v)
+{
+    int lo = offsets[u], hi = offsets[u + 1];
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (neighbors[mid] < v)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < offsets[u + 1] && neighbors[lo] == v;
+}
+
+/**
+ * @brief Checks that the second CSR half is the transpose of the first
+ *
+ * Both halves hold the same number of distinct arcs (valid_rows()), so it is
+ * enough that every arc u → v of the first has v → u in the second. Passing
+ * the same half twice checks that an undirected graph is symmetric. Self-loops
+ * are rejected, as csr_graph.h graphs never have them.
+ *
+ * @complexity O(V + E log Δ)
+ */
+static bool valid_transpose(const int *offsets, const int *neighbors, const int *t_offsets,
+                            const int *t_neighbors, int n)
+{
+    for (int u = 0; u < n; u++)
+    {
+        for (int k = offsets[u]; k < offsets[u + 1]; k++)
+        {
+            int v = neighbors[k];
+            if (v == u || !row_contains(t_offsets, t_neighbors, v, u))
+                return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Interprets a mapped file as a CSR graph, or returns NULL if it is not one
+ */
+static CSRGraph *csr_from_mapping(void *base, size_t size)
+{
+    const GraphFileHeader *header = base;
+    if (memcmp(header->magic, graph_file_magic, sizeof(graph_file_magic)) != 0 ||
+        header->version != GRAPH_FILE_VERSION || (header->flags & ~GRAPH_FILE_DIRECTED) != 0)
+        return NULL;
+
+    bool directed = (header->flags & GRAPH_FILE_DIRECTED) != 0;
+    int64_t n = header->node_count;
+    int64_t m = header->arc_count;
+    if (n < 0 || n >= INT_MAX || m < 0 || m > INT_MAX)
+        return NULL;
+    if (directed ? header->edge_count != m : (m % 2 != 0 || header->edge_count != m / 2))
+        return NULL;
+    int64_t ints = (n + 1 + m) * (directed ? 2 : 1);
+    if ((uint64_t)size != sizeof(GraphFileHeader) + (uint64_t)ints * sizeof(int))
+        return NULL;
+
+    int *data = (int *)((char *)base + sizeof(GraphFileHeader));
+    int *offsets = data;
+    int *neighbors = offsets + n + 1;
+    int *in_offsets = directed ? neighbors + m : NULL;
+    int *in_neighbors = directed ? in_offsets + n + 1 : NULL;
+    if (!valid_rows(offsets, neighbors, (int)n, (int)m) ||
+        (directed && !valid_rows(in_offsets, in_neighbors, (int)n, (int)m)))
+        return NULL;
+    // Undirected rows must be symmetric, reverse rows the transpose of the forward ones
+    if (directed ? !valid_transpose(offsets, neighbors, in_offsets, in_neighbors, (int)n)
+                 : !valid_transpose(offsets, neighbors, offsets, neighbors, (int)n))
+        return NULL;
+
+    CSRGraph *csr = calloc(1, sizeof(CSRGraph));
+    if (!csr)
+        return NULL;
+    csr->node_count = (int)n;
+    csr->edge_count = (int)header->edge_count;
+    csr->offsets = offsets;
+    csr->neighbors = neighbors;
+    csr->in_offsets = in_offsets;
+    csr->in_neighbors = in_neighbors;
+    csr->is_directed = directed;
+    csr->mapping = base;
+    csr->mapping_size = size;
+    return csr;
+}
+
+CSRGraph *graph_file_map(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(GraphFileHeader))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = (size_t)st.st_size;
+    void *base = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file referenced
+    if (base == MAP_FAILED)
+        return NULL;
+
+    CSRGraph *csr = csr_from_mapping(base, size);
+    if (!csr)
+        munmap(base, size);
+    return csr;
+}
+
+/* ========================================================================
+ * TEXT SCANNING
+ * ========================================================================*/
+
+typedef struct
+{
+    const char *data;
+    size_t size;
+} TextFile;
+
+static bool text_file_open(const char *path, TextFile *text)
+{
+    text->data = NULL;
+    text->size = 0;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return false;
+    }
+    if (st.st_size > 0)
+    {
+        void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED)
+        {
+            close(fd);
+            return false;
+        }
+        text->data = base;
+        text->size = (size_t)st.st_size;
+    }
+    close(fd);
+    return true;
+}
+
+static void text_file_close(TextFile *text)
+{
+    if (text->data)
+        munmap((void *)text->data, text->size);
+}
+
+static bool is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == ',';
+}
+
+static const char *skip_blanks(const char *p, const char *end)
+{
+    while (p < end && is_blank(*p))
+        p++;
+    return p;
+}
+
+/**
+ * @brief End of the line starting at p (the '\n' or end)
+ */
+static const char *line_end(const char *p, const char *end)
+{
+    const char *nl = memchr(p, '\n', end - p);
+    return nl ? nl : end;
+}
+
+/**
+ * @brief Parses the next non-negative integer of a line
+ *
+ * @param p In: scan position; out: just past the number
+ * @param end End of the line
+ * @param limit Largest accepted value
+ * @param out Receives the value
+ * @return false if there is no number, it exceeds limit or is glued to other text
+ */
+static bool parse_int(const char **p, const char *end, long long limit, long long *out)
+{
+    const char *q = skip_blanks(*p, end);
+    if (q == end || *q < '0' || *q > '9')
+        return false;
+    long long value = 0;
+    while (q < end && *q >= '0' && *q <= '9')
+    {
+        int digit = *q++ - '0';
+        // Bounded before multiplying, so value * 10 + digit cannot overflow
+        if (value > (limit - digit) / 10 || value * 10 + digit > limit)
+            return false;
+        value = value * 10 + digit;
+    }
+    if (q < end && !is_blank(*q))
+        return false;
+    *p = q;
+    *out = value;
+    return true;
+}
+
+/* ========================================================================
+ * EDGE COLLECTION
+ * ========================================================================*/
+
+typedef struct
+{
+    Edge *edges;
+    int count;
+    int capacity;
+    int max_edges;          // Keeps the CSR arc count within int
+    int node_count;         // 1 + largest endpoint seen
+} EdgeList;
+
+static void edge_list_init(EdgeList *list, bool is_directed)
+{
+    list->edges = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    list->max_edges = is_directed ? INT_MAX : INT_MAX / 2;
+    list->node_count = 0;
+}
+
+/**
+ * @brief Appends edge (u, v), normalised to u < v unless directed; self-loops are dropped
+ */
+static bool edge_list_push(EdgeList *list, int u, int v, bool is_directed)
+{
+    if (u == v)
+        return true;
+    if (!is_directed && u > v)
+    {
+        int t = u;
+        u = v;
+        v = t;
+    }
+    if (list->count == list->max_edges)
+        return false;
+    if (list->count == list->capacity)
+    {
+        long long grown = list->capacity > 0 ? 2LL * list->capacity : 1024;
+        int capacity = grown < list->max_edges ? (int)grown : list->max_edges;
+        Edge *edges = realloc(list->edges, (size_t)capacity * sizeof(Edge));
+        if (!edges)
+            return false;
+        list->edges = edges;
+        list->capacity = capacity;
+    }
+    list->edges[list->count++] = (Edge){u, v};
+    int top = u > v ? u : v;
+    if (top >= list->node_count)
+        list->node_count = top + 1;
+    return true;
+}
+
+/**
+ * @brief Removes repeated neighbors from sorted CSR rows in place
+ *
+ * @return New number of arcs
+ */
+static int squeeze_duplicates(int n, int *offsets, int *neighbors)
+{
+    int write = 0;
+    int start = 0;
+    for (int u = 0; u < n; u++)
+    {
+        int stop = offsets[u + 1];
+        offsets[u] = write;
+        for (int k = start; k < stop; k++)
+        {
+            if (k == start || neighbors[k] != neighbors[k - 1])
+                neighbors[write++] = neighbors[k];
+        }
+        start = stop;
+    }
+    offsets[n] = write;
+    return write;
+}
+
+/**
+ * @brief Builds the CSR graph of a collected edge list and frees the list
+ */
+static CSRGraph *edge_list_to_csr(EdgeList *list, int node_count, bool is_directed)
+{
+    CSRGraph *csr = csr_create_from_edges(node_count, list->edges, list->count, is_directed);
+    free(list->edges);
+    list->edges = NULL;
+    if (!csr)
+        return NULL;
+
+    int arcs = squeeze_duplicates(node_count, csr->offsets, csr->neighbors);
+    if (is_directed)
+        squeeze_duplicates(node_count, csr->in_offsets, csr->in_neighbors);
+    csr->edge_count = is_directed ? arcs : arcs / 2;
+    return csr;
+}
+
+/* ========================================================================
+ * TEXT FORMATS
+ * ========================================================================*/
+
+CSRGraph *graph_parse_edge_list(const char *path, bool is_directed)
+{
+    TextFile text;
+    if (!text_file_open(path, &text))
+        return NULL;
+
+    EdgeList list;
+    edge_list_init(&list, is_directed);
+    const char *end = text.data + text.size;
+    bool ok = true;
+    for (const char *p = text.data; ok && p < end;)
+    {
+        const char *eol = line_end(p, end);
+        const char *q = skip_blanks(p, eol);
+        if (q < eol && *q != '#' && *q != '%')
+        {
+            // Ids up to INT_MAX - 2 keep node_count + 1 (CSR offsets) within int
+            long long u, v;
+            ok = parse_int(&q, eol, INT_MAX - 2, &u) && parse_int(&q, eol, INT_MAX - 2, &v) &&
+                 edge_list_push(&list, (int)u, (int)v, is_directed);
+        }
+        p = eol < end ? eol + 1 : end;
+    }
+    text_file_close(&text);
+
+    if (!ok)
+    {
+        free(list.edges);
+        return NULL;
+    }
+    return edge_list_to_csr(&list, list.node_count, is_directed);
+}
+
+/**
+ * @brief Advances to the next line that is not a '%' comment
+ *
+ * @return false at the end of the file
+ */
+static bool next_metis_line(const char **p, const char *end, const char **line, const char **eol)
+{
+    while (*p < end)
+    {
+        *line = *p;
+        *eol = line_end(*p, end);
+        *p = *eol < end ? *eol + 1 : end;
+        if (**line != '%')
+            return true;
+    }
+    return false;
+}
+
+CSRGraph *graph_parse_metis(const char *path)
+{
+    TextFile text;
+    if (!text_file_open(path, &text))
+        return NULL;
+
+    const char *p = text.data;
+    const char *end = text.data + text.size;
+    const char *line = NULL, *eol = NULL;
+
+    // Header: n m [fmt [ncon]]; blank lines before it are skipped
+    bool found = false;
+    while (!found && next_metis_line(&p, end, &line, &eol))
+        found = skip_blanks(line, eol) < eol;
+    long long n = 0, m = 0, fmt = 0, ncon = 1;
+    bool ok = found && parse_int(&line, eol, INT_MAX - 1, &n) && parse_int(&line, eol, LLONG_MAX / 10, &m);
+    if (ok && skip_blanks(line, eol) < eol)
+        ok = parse_int(&line, eol, 111, &fmt) && (skip_blanks(line, eol) == eol || parse_int(&line, eol, INT_MAX, &ncon));
+    ok = ok && skip_blanks(line, eol) == eol;
+
+    // fmt digits: vertex sizes, vertex weights, edge weights
+    bool has_size = fmt / 100 == 1;
+    bool has_vertex_weights = fmt / 10 % 10 == 1;
+    bool has_edge_weights = fmt % 10 == 1;
+    ok = ok && fmt / 100 <= 1 && fmt / 10 % 10 <= 1 && fmt % 10 <= 1;
+    long long skip = (has_size ? 1 : 0) + (has_vertex_weights ? ncon : 0);
+
+    // The edge count m in the header is informational; rows are taken as they are
+    EdgeList list;
+    edge_list_init(&list, false);
+    for (int u = 0; ok && u < n && next_metis_line(&p, end, &line, &eol); u++)
+    {
+        long long value;
+        for (long long s = 0; ok && s < skip; s++)
+            ok = parse_int(&line, eol, LLONG_MAX / 10, &value);
+        while (ok && skip_blanks(line, eol) < eol)
+        {
+            ok = parse_int(&line, eol, n, &value) && value >= 1 && edge_list_push(&list, u, (int)value - 1, false);
+            long long weight;
+            if (ok && has_edge_weights)
+                ok = parse_int(&line, eol, LLONG_MAX / 10, &weight);
+        }
+    }
+
+    // Vertices without a line are isolated; anything beyond n lines is an error
+    while (ok && next_metis_line(&p, end, &line, &eol))
+        ok = skip_blanks(line, eol) == eol;
+    text_file_close(&text);
+
+    if (!ok)
+    {
+        free(list.edges);
+        return NULL;
+    }
+    return edge_list_to_csr(&list, (int)n, false);
+}
+
+/* ========================================================================
+ * GRAPH WRAPPING
+ * ========================================================================*/
+
+bool graph_adopt_csr(Graph *graph, CSRGraph *csr)
+{
+    graph->node_count = csr->node_count;
+    graph->is_directed = csr->is_directed;
+    graph->allow_bidirectional = csr->is_directed; // Loaded digraphs may contain 2-cycles
+    graph->csr = csr;
+    graph->adjacency = NULL;
+    if (csr->node_count > GRAPH_IO_MATRIX_MAX_NODES || graph_ensure_adjacency(graph))
+        return true;
+    graph_free_storage(graph);
+    return false;
+}
@@ -0,0 +1,258 @@
+/**
+ * @file graph_stats.c
+ * @brief Counters, phase timers and allocation wrappers behind GRAPH_STATS
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Counters and heap figures are relaxed atomics; only their totals matter,
+ * so no ordering is needed. The phase table is touched once per phase and
+ * takes a mutex. The allocation wrappers are the __wrap_* symbols GNU ld
+ * binds to when linking with -Wl,--wrap=malloc,...; live bytes are counted
+ * with malloc_usable_size(), so free() needs no size header.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <string.h>
+
+#include "graph_stats.h"
+
+static const char *const counter_names[GRAPH_STAT_COUNT] = {
+    [GRAPH_STAT_BACKTRACK_CALLS] = "backtrack_calls",
+    [GRAPH_STAT_BK_CALLS] = "bk_calls",
+    [GRAPH_STAT_BK_BRANCHES] = "bk_branches",
+    [GRAPH_STAT_BK_PIVOT_SKIPS] = "bk_pivot_skips",
+    [GRAPH_STAT_MAX_CLIQUE_NODES] = "max_clique_nodes",
+    [GRAPH_STAT_MAX_CLIQUE_PRUNES] = "max_clique_prunes",
+    [GRAPH_STAT_CUT_SUBSETS] = "cut_subsets",
+    [GRAPH_STAT_CUT_FLOWS] = "cut_flows",
+    [GRAPH_STAT_MIS_BRANCHES] = "mis_branches",
+    [GRAPH_STAT_SET_CREATES] = "set_creates",
+    [GRAPH_STAT_SET_BYTES] = "set_bytes",
+    [GRAPH_STAT_ALLOCS] = "allocs",
+    [GRAPH_STAT_ALLOC_BYTES] = "alloc_bytes",
+    [GRAPH_STAT_FREES] = "frees",
+};
+
+const char *graph_stats_counter_name(GraphStatCounter counter)
+{
+    return counter >= 0 && counter < GRAPH_STAT_COUNT ? counter_names[counter] : "unknown";
+}
+
+double graph_stats_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+#ifdef GRAPH_STATS
+
+#include <stdlib.h>
+#include <malloc.h>
+#include <pthread.h>
+
+_Atomic long long graph_stat_counters[GRAPH_STAT_COUNT];
+
+static _Atomic long long live_bytes;
+static _Atomic long long peak_bytes;
+
+/* ========================================================================
+ * PHASE TIMERS
+ * ========================================================================*/
+
+typedef struct
+{
+    const char *name;
+    long long calls;
+    double seconds;
+} Phase;
+
+static pthread_mutex_t phase_lock = PTHREAD_MUTEX_INITIALIZER;
+static Phase phases[GRAPH_STATS_MAX_PHASES];
+static int phase_count;
+
+void graph_stats_phase_add(const char *phase, double seconds)
+{
+    pthread_mutex_lock(&phase_lock);
+    int i = 0;
+    while (i < phase_count && strcmp(phases[i].name, phase) != 0)
+        i++;
+    if (i == phase_count && phase_count < GRAPH_STATS_MAX_PHASES)
+        phases[phase_count++] = (Phase){phase, 0, 0.0};
+    if (i < phase_count)
+    {
+        phases[i].calls++;
+        phases[i].seconds += seconds;
+    }
+    pthread_mutex_unlock(&phase_lock);
+}
+
+/* ========================================================================
+ * SNAPSHOTS AND REPORT
+ * ========================================================================*/
+
+void graph_stats_reset(void)
+{
+    for (int c = 0; c < GRAPH_STAT_COUNT; c++)
+        atomic_store_explicit(&graph_stat_counters[c], 0, memory_order_relaxed);
+    graph_stats_reset_peak();
+
+    pthread_mutex_lock(&phase_lock);
+    phase_count = 0;
+    pthread_mutex_unlock(&phase_lock);
+}
+
+void graph_stats_reset_peak(void)
+{
+    atomic_store_explicit(&peak_bytes, atomic_load_explicit(&live_bytes, memory_order_relaxed),
+                          memory_order_relaxed);
+}
+
+void graph_stats_snapshot(GraphStatsSnapshot *out)
+{
+    for (int c = 0; c < GRAPH_STAT_COUNT; c++)
+        out->counters[c] = atomic_load_explicit(&graph_stat_counters[c], memory_order_relaxed);
+    out->live_bytes = atomic_load_explicit(&live_bytes, memory_order_relaxed);
+    out->peak_bytes = atomic_load_explicit(&peak_bytes, memory_order_relaxed);
+}
+
+void graph_stats_print(FILE *out)
+{
+    GraphStatsSnapshot snap;
+    graph_stats_snapshot(&snap);
+
+    fprintf(out, "\n=== Statistics ===\n");
+    pthread_mutex_lock(&phase_lock);
+    if (phase_count > 0)
+    {
+        fprintf(out, "%-20s %8s %12s\n", "Phase", "Calls", "Time (ms)");
+        for (int i = 0; i < phase_count; i++)
+            fprintf(out, "%-20s %8lld %12.3f\n", phases[i].name, phases[i].calls, phases[i].seconds * 1e3);
+    }
+    pthread_mutex_unlock(&phase_lock);
+
+    bool any = false;
+    for (int c = 0; c < GRAPH_STAT_ALLOCS; c++)
+    {
+        if (snap.counters[c] == 0)
+            continue;
+        if (!any)
+            fprintf(out, "%-20s %21s\n", "Counter", "Value");
+        any = true;
+        fprintf(out, "%-20s %21lld\n", counter_names[c], snap.counters[c]);
+    }
+
+    long long skips = snap.counters[GRAPH_STAT_BK_PIVOT_SKIPS];
+    long long branches = snap.counters[GRAPH_STAT_BK_BRANCHES];
+    if (skips + branches > 0)
+        fprintf(out, "Pivot rule: skipped %.1f%% of the candidates\n", 100.0 * skips / (skips + branches));
+
+    fprintf(out, "Heap: %lld allocations (%lld bytes requested), %lld frees, peak %lld bytes live\n",
+            snap.counters[GRAPH_STAT_ALLOCS], snap.counters[GRAPH_STAT_ALLOC_BYTES],
+            snap.counters[GRAPH_STAT_FREES], snap.peak_bytes);
+}
+
+/* ========================================================================
+ * ALLOCATION WRAPPERS (linked with -Wl,--wrap=...)
+ * ========================================================================*/
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+void *__real_aligned_alloc(size_t alignment, size_t size);
+void __real_free(void *ptr);
+
+void *__wrap_malloc(size_t size);
+void *__wrap_calloc(size_t count, size_t size);
+void *__wrap_realloc(void *ptr, size_t size);
+void *__wrap_aligned_alloc(size_t alignment, size_t size);
+void __wrap_free(void *ptr);
+
+static void track_live(long long delta)
+{
+    long long live = atomic_fetch_add_explicit(&live_bytes, delta, memory_order_relaxed) + delta;
+    long long peak = atomic_load_explicit(&peak_bytes, memory_order_relaxed);
+    while (live > peak &&
+           !atomic_compare_exchange_weak_explicit(&peak_bytes, &peak, live, memory_order_relaxed,
+                                                  memory_order_relaxed))
+        ;
+}
+
+static void *track_alloc(void *ptr, size_t requested)
+{
+    if (ptr)
+    {
+        GRAPH_STAT_INC(GRAPH_STAT_ALLOCS);
+        GRAPH_STAT_ADD(GRAPH_STAT_ALLOC_BYTES, requested);
+        track_live((long long)malloc_usable_size(ptr));
+    }
+    return ptr;
+}
+
+void *__wrap_malloc(size_t size)
+{
+    return track_alloc(__real_malloc(size), size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    return track_alloc(__real_calloc(count, size), count * size);
+}
+
+void *__wrap_aligned_alloc(size_t alignment, size_t size)
+{
+    return track_alloc(__real_aligned_alloc(alignment, size), size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+    size_t old = ptr ? malloc_usable_size(ptr) : 0;
+    void *grown = __real_realloc(ptr, size);
+    track_live(-(long long)old);
+    if (!grown)
+    {
+        if (size != 0)
+            track_live((long long)old);  // Failed: ptr is still allocated
+        return NULL;                     // glibc frees ptr for size 0
+    }
+    return track_alloc(grown, size);
+}
+
+void __wrap_free(void *ptr)
+{
+    if (!ptr)
+        return;
+    GRAPH_STAT_INC(GRAPH_STAT_FREES);
+    track_live(-(long long)malloc_usable_size(ptr));
+    __real_free(ptr);
+}
+
+#else
+
+void graph_stats_phase_add(const char *phase, double seconds)
+{
+    (void)phase;
+    (void)seconds;
+}
+
+void graph_stats_reset(void)
+{
+}
+
+void graph_stats_reset_peak(void)
+{
+}
+
+void graph_stats_snapshot(GraphStatsSnapshot *out)
+{
+    memset(out, 0, sizeof(*out));
+}
+
+void graph_stats_print(FILE *out)
+{
+    (void)out;
+}
+
+#endif
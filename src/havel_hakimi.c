@@ -1,4 +1,9 @@
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
 #include "havel_hakimi.h"
+#include "csr_graph.h"
 
 /**
  * @file havel_hakimi.c
@@ -15,9 +20,1043 @@
  * - Directed: Must satisfy sum(out-degrees) = sum(in-degrees)
  * - Greedy approach: Always connect highest-degree vertices first
  *
- * The implementation also generates DOT files for immediate visualization.
+ * Construction engines (no adjacency matrix, edge list output):
+ * - Undirected: Havel-Hakimi over degree buckets. Vertices are kept in one
+ *   array ordered by decreasing residual degree; bound[k] marks the end of
+ *   the block of degree k, so decrementing a vertex is one swap with the
+ *   last vertex of its block. Realization costs O(n + E) in total.
+ * - Directed: Kleitman-Wang with an indexed binary heap keyed by residual
+ *   (in-degree, out-degree). Each vertex sends all its arcs at once to the
+ *   vertices of largest residual in-degree, which decides digraphicality
+ *   exactly in O((n + E) log n). Without 2-cycles the heap pass is a
+ *   heuristic; oriented_search() backtracks exactly when it fails.
+ *
+ * The Graph-building wrappers run an engine, then fill the matrix and build
+ * the CSR view (graph->csr) from the edge list in O(V + E), so traversal
+ * modules never have to rescan the matrix. DOT output is left to
+ * dot_write_graph() once the graph is complete.
  */
 
+/* ========================================================================
+ * GRAPHICALITY TESTS: Erdős-Gallai and Fulkerson-Chen-Anstee
+ * ========================================================================*/
+
+/**
+ * @brief Checks a degree sequence for range and returns its sum (-1 if invalid)
+ */
+static long long degree_sum(const int *degrees, int n)
+{
+    long long sum = 0;
+    for (int v = 0; v < n; v++)
+    {
+        if (degrees[v] < 0 || degrees[v] > n - 1)
+            return -1; // No simple graph has such a vertex
+        sum += degrees[v];
+    }
+    return sum;
+}
+
+/**
+ * @brief Stable counting sort of indices by decreasing key (keys in [0, n))
+ *
+ * @param key key[v] for every v
+ * @param in Indices to sort (NULL for 0 .. n-1)
+ * @param out Receives the sorted indices
+ * @param count Scratch array of n ints
+ */
+static void sort_by_key_desc(const int *key, const int *in, int *out, int *count, int n)
+{
+    memset(count, 0, n * sizeof(int));
+    for (int v = 0; v < n; v++)
+        count[key[v]]++;
+    for (int k = n - 1, acc = 0; k >= 0; k--)
+    {
+        int c = count[k];
+        count[k] = acc;
+        acc += c;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        int v = in ? in[i] : i;
+        out[count[key[v]]++] = v;
+    }
+}
+
+bool is_graphical_sequence(const int *degrees, int n)
+{
+    long long total = degree_sum(degrees, n);
+    if (total < 0 || total % 2 != 0)
+        return false;
+    if (n == 0)
+        return true;
+
+    int *order = malloc(n * sizeof(int));
+    int *count = malloc(n * sizeof(int));
+    long long *prefix = malloc((n + 1) * sizeof(long long));
+    if (!order || !count || !prefix)
+    {
+        free(order);
+        free(count);
+        free(prefix);
+        return true; // Undecided; construction will tell
+    }
+    sort_by_key_desc(degrees, NULL, order, count, n);
+    prefix[0] = 0;
+    for (int i = 0; i < n; i++)
+        prefix[i + 1] = prefix[i] + degrees[order[i]];
+
+    // For every k: Σ_{i≤k} d_i ≤ k(k-1) + Σ_{i>k} min(d_i, k), with d sorted descending
+    bool graphical = true;
+    int j = n; // j = number of degrees ≥ k, non-increasing in k
+    for (int k = 1; k <= n && graphical; k++)
+    {
+        while (j > 0 && degrees[order[j - 1]] < k)
+            j--;
+        long long rhs = (long long)k * (k - 1);
+        if (j > k)
+            rhs += (long long)k * (j - k) + (total - prefix[j]);
+        else
+            rhs += total - prefix[k];
+        graphical = prefix[k] <= rhs;
+    }
+
+    free(order);
+    free(count);
+    free(prefix);
+    return graphical;
+}
+
+bool is_digraphical_sequence(const int *out_degrees, const int *in_degrees, int n)
+{
+    long long out_sum = degree_sum(out_degrees, n);
+    long long in_sum = degree_sum(in_degrees, n);
+    if (out_sum < 0 || out_sum != in_sum)
+        return false;
+    if (n == 0)
+        return true;
+
+    int *by_in = malloc(n * sizeof(int));
+    int *order = malloc(n * sizeof(int));
+    int *count = malloc(n * sizeof(int));
+    int *seen = calloc(n, sizeof(int)); // seen[b] = in-degrees equal to b among the first k pairs
+    if (!by_in || !order || !count || !seen)
+    {
+        free(by_in);
+        free(order);
+        free(count);
+        free(seen);
+        return true; // Undecided; construction will tell
+    }
+
+    // Pairs in lexicographically decreasing (out, in) order: two stable counting sorts
+    sort_by_key_desc(in_degrees, NULL, by_in, count, n);
+    sort_by_key_desc(out_degrees, by_in, order, count, n);
+
+    // count[k] = number of in-degrees ≥ k
+    memset(count, 0, n * sizeof(int));
+    for (int v = 0; v < n; v++)
+        count[in_degrees[v]]++;
+    for (int k = n - 2; k >= 0; k--)
+        count[k] += count[k + 1];
+
+    /* For every k: Σ_{i≤k} a_i ≤ Σ_{i≤k} min(b_i, k-1) + Σ_{i>k} min(b_i, k).
+       The right side equals Σ_i min(b_i, k) - #{i ≤ k : b_i ≥ k}; both terms
+       are updated in O(1) per k. */
+    bool digraphical = true;
+    long long lhs = 0, min_sum = 0;
+    int head_ge = 0; // #{i ≤ k : b_i ≥ k}
+    for (int k = 1; k <= n && digraphical; k++)
+    {
+        int v = order[k - 1];
+        lhs += out_degrees[v];
+        min_sum += k < n ? count[k] : 0;
+        head_ge -= seen[k - 1]; // Pairs with b_i = k - 1 no longer reach the threshold
+        seen[in_degrees[v]]++;
+        if (in_degrees[v] >= k)
+            head_ge++;
+        digraphical = lhs <= min_sum - head_ge;
+    }
+
+    free(by_in);
+    free(order);
+    free(count);
+    free(seen);
+    return digraphical;
+}
+
+/* ========================================================================
+ * UNDIRECTED ENGINE: Havel-Hakimi over degree buckets
+ * ========================================================================*/
+
+bool havel_hakimi_realize(const int *degrees, int n, Edge **edges_out, int *edge_count_out)
+{
+    *edges_out = NULL;
+    *edge_count_out = 0;
+
+    long long sum = degree_sum(degrees, n);
+    if (sum < 0 || sum % 2 != 0 || sum / 2 > INT_MAX)
+        return false;
+    if (n <= 0)
+        return n == 0;
+
+    int m = (int)(sum / 2);
+    int *deg = malloc(n * sizeof(int));
+    int *order = malloc(n * sizeof(int));    // Vertices by decreasing residual degree
+    int *pos = malloc(n * sizeof(int));      // pos[v] = index of v in order
+    int *bound = calloc(n + 1, sizeof(int)); // bound[k] = index past the last vertex of degree ≥ k
+    int *targets = malloc(n * sizeof(int));
+    Edge *edges = malloc((m > 0 ? m : 1) * sizeof(Edge));
+    if (!deg || !order || !pos || !bound || !targets || !edges)
+    {
+        free(deg);
+        free(order);
+        free(pos);
+        free(bound);
+        free(targets);
+        free(edges);
+        return false;
+    }
+
+    // Counting sort by degree, descending; ties keep ascending vertex order
+    memcpy(deg, degrees, n * sizeof(int));
+    for (int v = 0; v < n; v++)
+        bound[deg[v]]++;
+    for (int k = n - 1; k > 0; k--)
+        bound[k - 1] += bound[k]; // bound[k] = number of vertices of degree ≥ k
+    int *fill = targets;          // Borrowed as the per-degree insertion cursor
+    for (int k = 0; k < n; k++)
+        fill[k] = bound[k + 1];
+    for (int v = 0; v < n; v++)
+    {
+        pos[v] = fill[deg[v]]++;
+        order[pos[v]] = v;
+    }
+
+    int head = 0; // order[0 .. head) are finished vertices
+    int count = 0;
+    bool ok = true;
+    while (head < n && deg[order[head]] > 0)
+    {
+        // The first active vertex has the largest residual degree d; retire it
+        int u = order[head++];
+        int d = deg[u];
+        deg[u] = 0;
+
+        // Its neighbors are the next d vertices, which must all still need edges
+        if (head + d > n || deg[order[head + d - 1]] == 0)
+        {
+            ok = false;
+            break;
+        }
+        memcpy(targets, order + head, d * sizeof(int));
+
+        for (int i = 0; i < d; i++)
+        {
+            int v = targets[i];
+            edges[count].u = u;
+            edges[count].v = v;
+            count++;
+
+            // Move v to the end of its block, then shrink the block by one
+            int k = deg[v];
+            int last = bound[k] - 1;
+            int w = order[last];
+            order[last] = v;
+            order[pos[v]] = w;
+            pos[w] = pos[v];
+            pos[v] = last;
+            bound[k]--;
+            deg[v]--;
+        }
+    }
+
+    free(deg);
+    free(order);
+    free(pos);
+    free(bound);
+    free(targets);
+    if (!ok)
+    {
+        free(edges);
+        return false;
+    }
+    *edges_out = edges;
+    *edge_count_out = count;
+    return true;
+}
+
+/* ========================================================================
+ * DIRECTED ENGINE: Kleitman-Wang with an indexed heap
+ * ========================================================================*/
+
+/**
+ * @brief Max-heap of vertices ordered by residual (in-degree, out-degree)
+ */
+typedef struct
+{
+    int *items;
+    int *slot;      // slot[v] = index of v in items, -1 when absent
+    int size;
+    const int *in;  // Residual in-degrees
+    const int *out; // Residual out-degrees
+} DegreeHeap;
+
+static bool heap_before(const DegreeHeap *h, int a, int b)
+{
+    if (h->in[a] != h->in[b])
+        return h->in[a] > h->in[b];
+    if (h->out[a] != h->out[b])
+        return h->out[a] > h->out[b]; // Kleitman-Wang tie-break
+    return a < b;
+}
+
+static void heap_place(DegreeHeap *h, int i, int v)
+{
+    h->items[i] = v;
+    h->slot[v] = i;
+}
+
+static void heap_sift_up(DegreeHeap *h, int i)
+{
+    int v = h->items[i];
+    while (i > 0 && heap_before(h, v, h->items[(i - 1) / 2]))
+    {
+        heap_place(h, i, h->items[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+    heap_place(h, i, v);
+}
+
+static void heap_sift_down(DegreeHeap *h, int i)
+{
+    int v = h->items[i];
+    for (;;)
+    {
+        int c = 2 * i + 1;
+        if (c >= h->size)
+            break;
+        if (c + 1 < h->size && heap_before(h, h->items[c + 1], h->items[c]))
+            c++;
+        if (!heap_before(h, h->items[c], v))
+            break;
+        heap_place(h, i, h->items[c]);
+        i = c;
+    }
+    heap_place(h, i, v);
+}
+
+static void heap_push(DegreeHeap *h, int v)
+{
+    heap_place(h, h->size++, v);
+    heap_sift_up(h, h->size - 1);
+}
+
+static void heap_remove(DegreeHeap *h, int v)
+{
+    int i = h->slot[v];
+    h->slot[v] = -1;
+    int last = h->items[--h->size];
+    if (i == h->size)
+        return;
+    heap_place(h, i, last);
+    heap_sift_up(h, i);
+    heap_sift_down(h, h->slot[last]);
+}
+
+static int heap_pop(DegreeHeap *h)
+{
+    int v = h->items[0];
+    heap_remove(h, v);
+    return v;
+}
+
+/* ========================================================================
+ * ORIENTED FALLBACK: exhaustive search without 2-cycles
+ * ========================================================================*/
+
+/**
+ * @brief Residual multiset that has no oriented realization: arena[at, at + len)
+ */
+typedef struct
+{
+    uint64_t hash;
+    long long at;
+    int len; // -1 for a free slot
+} FailedState;
+
+/**
+ * @brief Backtracking state of oriented_search()
+ *
+ * A level settles all pairs of one vertex u: u gets its a out-arcs and b
+ * in-arcs at once and leaves the graph, so what remains is again an oriented
+ * realization problem on the other vertices, and the digraph and simple graph
+ * tests stay valid necessary conditions for it. Candidates with the same
+ * residual (in, out) are interchangeable and form one class; a choice is
+ * the number of targets x[c] and sources y[c] taken from every class.
+ */
+typedef struct
+{
+    int n;
+    int *out, *in;  // Residual degrees
+    int *alive;     // alive[0, alive_count) = vertices not settled yet
+    int *where;     // where[v] = index of v in alive
+    int alive_count;
+    Node *cand;     // Candidates of the current level, grouped by class
+    int *class_end; // Class c is cand[class_end[c - 1], class_end[c])
+    int *x, *y;     // Current choice
+    int *suffix;    // suffix[3c..3c+2] = slots of classes ≥ c taking only arcs in, only out, both
+    int classes;
+    int *label;     // label[v] = 1 if u → v, 2 if v → u (decoding a level's arcs)
+    int *pack_out, *pack_in, *pack_sum; // Residual sequences of the non-settled vertices
+    int *order_a, *order_sum, *count;   // Scratch of oriented_bound_holds()
+    bool strict;                        // Set at the first dead end: also test the oriented bound
+    long long *state;                   // Sorted (out, in) codes of the current residual
+    int state_len;
+    FailedState *failed;                // Residual multisets known to fail (open addressing)
+    int failed_slots, failed_count;
+    long long *arena;
+    long long arena_len, arena_cap;
+} OrientedSearch;
+
+/** Failed residuals kept by oriented_search() (codes in the arena); more are just not remembered */
+#define ORIENTED_MEMO_CODES (1 << 22)
+
+static int compare_residual(const void *a, const void *b)
+{
+    const Node *p = a, *q = b;
+    if (p->in_degree != q->in_degree)
+        return q->in_degree - p->in_degree;
+    if (p->degree != q->degree)
+        return q->degree - p->degree;
+    return p->original_index - q->original_index;
+}
+
+/**
+ * @brief Oriented bound: Σ_{v∈S} a_v ≤ C(|S|, 2) + Σ_{v∉S} min(b_v, |S|) for every S
+ *
+ * Arcs leaving S stay inside it (one per pair at most) or end outside, at
+ * most min(b_v, |S|) of them at v. For |S| = k the worst S holds the k
+ * largest a_v + min(b_v, k): vertices with b_v ≥ k in order of a, merged
+ * with the rest in order of a + b. Sizes with C(k, 2) ≥ Σ a cannot fail.
+ *
+ * @complexity O(n √E)
+ */
+static bool oriented_bound_holds(OrientedSearch *os, const int *a, const int *b, const int *sum, int n)
+{
+    long long a_sum = 0;
+    for (int v = 0; v < n; v++)
+        a_sum += a[v];
+    sort_by_key_desc(a, NULL, os->order_a, os->count, n);
+    sort_by_key_desc(sum, NULL, os->order_sum, os->count, n);
+    for (int k = 1; k <= n && (long long)k * (k - 1) / 2 < a_sum; k++)
+    {
+        long long slack = (long long)k * (k - 1) / 2;
+        for (int v = 0; v < n; v++)
+            slack += b[v] < k ? b[v] : k;
+        for (int taken = 0, i = 0, j = 0; taken < k; taken++)
+        {
+            while (i < n && b[os->order_a[i]] < k)
+                i++;
+            while (j < n && b[os->order_sum[j]] >= k)
+                j++;
+            int by_a = i < n ? a[os->order_a[i]] + k : -1;
+            int by_sum = j < n ? sum[os->order_sum[j]] : -1;
+            slack -= by_a >= by_sum ? by_a : by_sum;
+            if (by_a >= by_sum)
+                i++;
+            else
+                j++;
+        }
+        if (slack < 0)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Necessary conditions on the residual sequence: digraphical, graphical
+ *        underlying degrees, and (once strict) the oriented bound both ways
+ */
+static bool residual_feasible(OrientedSearch *os)
+{
+    int k = 0;
+    for (int i = 0; i < os->alive_count; i++)
+    {
+        int v = os->alive[i];
+        if (os->out[v] + os->in[v] == 0)
+            continue;
+        os->pack_out[k] = os->out[v];
+        os->pack_in[k] = os->in[v];
+        os->pack_sum[k] = os->out[v] + os->in[v];
+        k++;
+    }
+    for (int i = 0; i < k; i++)
+    {
+        if (os->pack_sum[i] > k - 1)
+            return false;
+    }
+    return is_digraphical_sequence(os->pack_out, os->pack_in, k) && is_graphical_sequence(os->pack_sum, k) &&
+           (!os->strict || (oriented_bound_holds(os, os->pack_out, os->pack_in, os->pack_sum, k) &&
+                            oriented_bound_holds(os, os->pack_in, os->pack_out, os->pack_sum, k)));
+}
+
+static int compare_codes(const void *a, const void *b)
+{
+    long long x = *(const long long *)a, y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Loads the residual multiset into os->state and returns its hash
+ *
+ * Feasibility depends on the multiset of residual (out, in) pairs only,
+ * since all pairs among unsettled vertices are still open.
+ */
+static uint64_t load_state(OrientedSearch *os)
+{
+    int k = 0;
+    for (int i = 0; i < os->alive_count; i++)
+    {
+        int v = os->alive[i];
+        if (os->out[v] + os->in[v] > 0)
+            os->state[k++] = (long long)os->out[v] * os->n + os->in[v];
+    }
+    qsort(os->state, k, sizeof(long long), compare_codes);
+    os->state_len = k;
+
+    uint64_t hash = 14695981039346656037ull; // FNV-1a over the codes
+    for (int i = 0; i < k; i++)
+        hash = (hash ^ (uint64_t)os->state[i]) * 1099511628211ull;
+    return hash;
+}
+
+/**
+ * @brief Slot of the loaded state in the failed set, or of the free slot it would take
+ */
+static int failed_slot(const OrientedSearch *os, uint64_t hash)
+{
+    int mask = os->failed_slots - 1;
+    for (int i = (int)(hash & mask);; i = (i + 1) & mask)
+    {
+        if (os->failed[i].len < 0)
+            return i;
+        if (os->failed[i].hash == hash && os->failed[i].len == os->state_len &&
+            memcmp(&os->arena[os->failed[i].at], os->state, os->state_len * sizeof(long long)) == 0)
+            return i;
+    }
+}
+
+static bool state_failed(const OrientedSearch *os, uint64_t hash)
+{
+    return os->failed && os->failed[failed_slot(os, hash)].len >= 0;
+}
+
+/**
+ * @brief Remembers the loaded state as failed (skipped once the memo is full)
+ */
+static void remember_failed(OrientedSearch *os, uint64_t hash)
+{
+    if (os->arena_len + os->state_len > ORIENTED_MEMO_CODES)
+        return;
+    if (os->arena_len + os->state_len > os->arena_cap)
+    {
+        long long cap = os->arena_cap ? 2 * os->arena_cap : 4096;
+        while (cap < os->arena_len + os->state_len)
+            cap *= 2;
+        long long *arena = realloc(os->arena, cap * sizeof(long long));
+        if (!arena)
+            return;
+        os->arena = arena;
+        os->arena_cap = cap;
+    }
+    if (2 * (os->failed_count + 1) > os->failed_slots)
+    {
+        int slots = os->failed_slots ? 2 * os->failed_slots : 1024;
+        FailedState *old = os->failed;
+        FailedState *grown = malloc(slots * sizeof(FailedState));
+        if (!grown)
+            return;
+        for (int i = 0; i < slots; i++)
+            grown[i].len = -1;
+        for (int i = 0; i < os->failed_slots; i++)
+        {
+            if (old[i].len < 0)
+                continue;
+            int j = (int)(old[i].hash & (slots - 1));
+            while (grown[j].len >= 0)
+                j = (j + 1) & (slots - 1);
+            grown[j] = old[i];
+        }
+        free(old);
+        os->failed = grown;
+        os->failed_slots = slots;
+    }
+
+    int slot = failed_slot(os, hash);
+    if (os->failed[slot].len >= 0)
+        return;
+    memcpy(&os->arena[os->arena_len], os->state, os->state_len * sizeof(long long));
+    os->failed[slot] = (FailedState){hash, os->arena_len, os->state_len};
+    os->arena_len += os->state_len;
+    os->failed_count++;
+}
+
+/**
+ * @brief Groups the candidates of u into classes and counts their free slots
+ */
+static void build_classes(OrientedSearch *os, int u)
+{
+    int r = 0;
+    for (int i = 0; i < os->alive_count; i++)
+    {
+        int v = os->alive[i];
+        if (v != u && os->out[v] + os->in[v] > 0)
+            os->cand[r++] = (Node){v, os->out[v], os->in[v]};
+    }
+    qsort(os->cand, r, sizeof(Node), compare_residual);
+
+    int c = 0;
+    for (int i = 0; i < r; i++)
+    {
+        if (i + 1 == r || os->cand[i].in_degree != os->cand[i + 1].in_degree ||
+            os->cand[i].degree != os->cand[i + 1].degree)
+            os->class_end[c++] = i + 1;
+    }
+    os->classes = c;
+    os->suffix[3 * c] = os->suffix[3 * c + 1] = os->suffix[3 * c + 2] = 0;
+    for (c = os->classes - 1; c >= 0; c--)
+    {
+        int begin = c > 0 ? os->class_end[c - 1] : 0;
+        int size = os->class_end[c] - begin;
+        const Node *first = &os->cand[begin];
+        for (int t = 0; t < 3; t++)
+            os->suffix[3 * c + t] = os->suffix[3 * c + 3 + t];
+        if (first->in_degree > 0 && first->degree > 0)
+            os->suffix[3 * c + 2] += size;
+        else if (first->in_degree > 0)
+            os->suffix[3 * c] += size;
+        else
+            os->suffix[3 * c + 1] += size;
+    }
+}
+
+/**
+ * @brief Can classes ≥ c still take a targets and b sources (Hall's condition)?
+ */
+static bool classes_can_take(const OrientedSearch *os, int c, int a, int b)
+{
+    const int *s = &os->suffix[3 * c];
+    return a >= 0 && b >= 0 && a <= s[0] + s[2] && b <= s[1] + s[2] && a + b <= s[0] + s[1] + s[2];
+}
+
+/**
+ * @brief Moves class c to its next option, options ordered by x then y decreasing
+ *
+ * With fresh set, starts from the first option instead.
+ * a and b are the targets and sources still missing before class c.
+ */
+static bool next_option(OrientedSearch *os, int c, int a, int b, bool fresh)
+{
+    int begin = c > 0 ? os->class_end[c - 1] : 0;
+    int size = os->class_end[c] - begin;
+    int max_x = os->cand[begin].in_degree > 0 ? (size < a ? size : a) : 0;
+    int x = fresh ? max_x : os->x[c];
+    int y = fresh ? INT_MAX : os->y[c] - 1;
+    for (; x >= 0; x--, y = INT_MAX)
+    {
+        int max_y = os->cand[begin].degree > 0 ? size - x : 0;
+        max_y = max_y < b ? max_y : b;
+        for (y = y < max_y ? y : max_y; y >= 0; y--)
+        {
+            if (classes_can_take(os, c + 1, a - x, b - y))
+            {
+                os->x[c] = x;
+                os->y[c] = y;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Advances the choice of the whole level (fresh: its first choice)
+ */
+static bool next_choice(OrientedSearch *os, int a, int b, bool fresh)
+{
+    int c = os->classes - 1;
+    if (fresh)
+    {
+        if (!classes_can_take(os, 0, a, b))
+            return false;
+        c = -1;
+    }
+    else
+    {
+        // Rightmost class that can still move
+        int ra = a, rb = b;
+        for (int i = 0; i < os->classes; i++)
+        {
+            ra -= os->x[i];
+            rb -= os->y[i];
+        }
+        for (; c >= 0; c--)
+        {
+            ra += os->x[c];
+            rb += os->y[c];
+            if (next_option(os, c, ra, rb, false))
+                break;
+        }
+        if (c < 0)
+            return false;
+    }
+
+    int ra = a, rb = b;
+    for (int i = 0; i <= c; i++)
+    {
+        ra -= os->x[i];
+        rb -= os->y[i];
+    }
+    for (int i = c + 1; i < os->classes; i++)
+    {
+        next_option(os, i, ra, rb, true); // Always succeeds: class i - 1 checked the rest
+        ra -= os->x[i];
+        rb -= os->y[i];
+    }
+    return true;
+}
+
+/**
+ * @brief Decides an oriented (no 2-cycle) sequence exactly by backtracking
+ *
+ * Levels settle the vertex of largest residual degree first. Choices prefer
+ * targets of large in-degree, so the first branch is a Havel-Hakimi style
+ * greedy. A level is entered only if its residual multiset passes
+ * residual_feasible() and has not failed before. Exponential in the worst
+ * case: used only when the heap greedy fails.
+ */
+static bool oriented_search(const int *out_degrees, const int *in_degrees, int n, int m,
+                            Edge **edges_out, int *edge_count_out)
+{
+    OrientedSearch os = {0};
+    os.n = n;
+    os.out = malloc(n * sizeof(int));
+    os.in = malloc(n * sizeof(int));
+    os.alive = malloc(n * sizeof(int));
+    os.where = malloc(n * sizeof(int));
+    os.cand = malloc(n * sizeof(Node));
+    os.class_end = malloc(n * sizeof(int));
+    os.x = malloc(n * sizeof(int));
+    os.y = malloc(n * sizeof(int));
+    os.suffix = malloc(3 * (n + 1) * sizeof(int));
+    os.label = calloc(n, sizeof(int));
+    os.pack_out = malloc(n * sizeof(int));
+    os.pack_in = malloc(n * sizeof(int));
+    os.pack_sum = malloc(n * sizeof(int));
+    os.order_a = malloc(n * sizeof(int));
+    os.order_sum = malloc(n * sizeof(int));
+    os.count = malloc(n * sizeof(int));
+    os.state = malloc(n * sizeof(long long));
+    int *level_u = malloc(n * sizeof(int));
+    int *level_start = malloc(n * sizeof(int));
+    Edge *edges = malloc((m > 0 ? m : 1) * sizeof(Edge));
+    bool found = false;
+    if (os.out && os.in && os.alive && os.where && os.cand && os.class_end && os.x && os.y && os.suffix &&
+        os.label && os.pack_out && os.pack_in && os.pack_sum && os.order_a && os.order_sum && os.count && os.state &&
+        level_u && level_start && edges)
+    {
+        memcpy(os.out, out_degrees, n * sizeof(int));
+        memcpy(os.in, in_degrees, n * sizeof(int));
+        for (int v = 0; v < n; v++)
+            os.alive[v] = os.where[v] = v;
+        os.alive_count = n;
+
+        int depth = 0, count = 0;
+        bool descend = true;
+        for (;;)
+        {
+            int u = -1;
+            bool placed = false;
+            if (descend)
+            {
+                if (count == m)
+                {
+                    found = true;
+                    break;
+                }
+                if (!state_failed(&os, load_state(&os)) && residual_feasible(&os))
+                {
+                    for (int i = 0; i < os.alive_count; i++)
+                    {
+                        int v = os.alive[i];
+                        int dv = os.out[v] + os.in[v], du = u < 0 ? -1 : os.out[u] + os.in[u];
+                        if (dv > du || (dv == du && (os.out[v] > os.out[u] || (os.out[v] == os.out[u] && v < u))))
+                            u = v;
+                    }
+                    level_u[depth] = u;
+                    level_start[depth] = count;
+                    build_classes(&os, u);
+                    placed = next_choice(&os, os.out[u], os.in[u], true);
+                }
+            }
+            else
+            {
+                if (depth == 0)
+                    break;
+                depth--;
+                u = level_u[depth];
+                os.alive_count++; // u is still parked right after the alive vertices
+
+                // Undo the level, reading its choice back from its arcs
+                for (int e = level_start[depth]; e < count; e++)
+                {
+                    if (edges[e].u == u)
+                    {
+                        os.label[edges[e].v] = 1;
+                        os.in[edges[e].v]++;
+                        os.out[u]++;
+                    }
+                    else
+                    {
+                        os.label[edges[e].u] = 2;
+                        os.out[edges[e].u]++;
+                        os.in[u]++;
+                    }
+                }
+                count = level_start[depth];
+                build_classes(&os, u);
+                for (int c = 0; c < os.classes; c++)
+                {
+                    os.x[c] = os.y[c] = 0;
+                    for (int i = c > 0 ? os.class_end[c - 1] : 0; i < os.class_end[c]; i++)
+                    {
+                        int v = os.cand[i].original_index;
+                        os.x[c] += os.label[v] == 1;
+                        os.y[c] += os.label[v] == 2;
+                        os.label[v] = 0;
+                    }
+                }
+                placed = next_choice(&os, os.out[u], os.in[u], false);
+            }
+
+            descend = placed;
+            if (!placed)
+            {
+                os.strict = true; // The cheap tests let a dead end through: prune harder from now on
+                remember_failed(&os, load_state(&os));
+                continue;
+            }
+
+            // Apply the choice: per class, the first x[c] become targets, the next y[c] sources
+            for (int c = 0; c < os.classes; c++)
+            {
+                int i = c > 0 ? os.class_end[c - 1] : 0;
+                for (int k = 0; k < os.x[c]; k++, i++)
+                {
+                    int v = os.cand[i].original_index;
+                    edges[count++] = (Edge){u, v};
+                    os.in[v]--;
+                }
+                for (int k = 0; k < os.y[c]; k++, i++)
+                {
+                    int v = os.cand[i].original_index;
+                    edges[count++] = (Edge){v, u};
+                    os.out[v]--;
+                }
+            }
+            os.out[u] = os.in[u] = 0;
+
+            // Park u after the alive vertices
+            int last = os.alive[--os.alive_count];
+            int slot = os.where[u];
+            os.alive[slot] = last;
+            os.where[last] = slot;
+            os.alive[os.alive_count] = u;
+            os.where[u] = os.alive_count;
+            depth++;
+        }
+    }
+
+    free(os.out);
+    free(os.in);
+    free(os.alive);
+    free(os.where);
+    free(os.cand);
+    free(os.class_end);
+    free(os.x);
+    free(os.y);
+    free(os.suffix);
+    free(os.label);
+    free(os.pack_out);
+    free(os.pack_in);
+    free(os.pack_sum);
+    free(os.order_a);
+    free(os.order_sum);
+    free(os.count);
+    free(os.state);
+    free(os.failed);
+    free(os.arena);
+    free(level_u);
+    free(level_start);
+    if (!found || m == 0)
+    {
+        free(edges);
+        edges = NULL;
+    }
+    *edges_out = edges;
+    *edge_count_out = found ? m : 0;
+    return found;
+}
+
+bool kleitman_wang_realize(const int *out_degrees, const int *in_degrees, int n, bool allow_bidirectional,
+                           Edge **edges_out, int *edge_count_out)
+{
+    *edges_out = NULL;
+    *edge_count_out = 0;
+
+    long long out_sum = degree_sum(out_degrees, n);
+    long long in_sum = degree_sum(in_degrees, n);
+    if (out_sum < 0 || out_sum != in_sum || out_sum > INT_MAX)
+        return false;
+    if (n <= 0)
+        return n == 0;
+
+    int m = (int)out_sum;
+    int *out = malloc(n * sizeof(int));
+    int *in = malloc(n * sizeof(int));
+    int *items = malloc(n * sizeof(int));
+    int *slot = malloc(n * sizeof(int));
+    int *picked = malloc(n * sizeof(int));
+    int *held = malloc(n * sizeof(int));
+    int *sources = malloc(n * sizeof(int));
+    Edge *edges = malloc((m > 0 ? m : 1) * sizeof(Edge));
+    // Arcs into each vertex so far, to refuse reverse arcs when they are not allowed
+    int *in_head = allow_bidirectional ? NULL : malloc(n * sizeof(int));
+    int *in_next = allow_bidirectional ? NULL : malloc((m > 0 ? m : 1) * sizeof(int));
+    int *stamp = allow_bidirectional ? NULL : calloc(n, sizeof(int));
+    if (!out || !in || !items || !slot || !picked || !held || !sources || !edges ||
+        (!allow_bidirectional && (!in_head || !in_next || !stamp)))
+    {
+        free(out);
+        free(in);
+        free(items);
+        free(slot);
+        free(picked);
+        free(held);
+        free(sources);
+        free(edges);
+        free(in_head);
+        free(in_next);
+        free(stamp);
+        return false;
+    }
+
+    memcpy(out, out_degrees, n * sizeof(int));
+    memcpy(in, in_degrees, n * sizeof(int));
+    DegreeHeap heap = {items, slot, 0, in, out};
+    for (int v = 0; v < n; v++)
+    {
+        slot[v] = -1;
+        if (in_head)
+            in_head[v] = -1;
+    }
+    for (int v = 0; v < n; v++)
+    {
+        if (in[v] > 0)
+            heap_push(&heap, v);
+    }
+
+    // Sources by decreasing out-degree (any order is exact; this one suits the 2-cycle rule best)
+    int *source_rank = held; // Free until the main loop starts
+    memset(source_rank, 0, n * sizeof(int));
+    for (int v = 0; v < n; v++)
+        source_rank[out[v]]++;
+    for (int k = n - 1, acc = 0; k >= 0; k--)
+    {
+        int c = source_rank[k];
+        source_rank[k] = acc;
+        acc += c;
+    }
+    for (int v = 0; v < n; v++)
+        sources[source_rank[out[v]]++] = v;
+
+    int count = 0;
+    bool ok = true;
+    for (int s = 0; s < n && ok; s++)
+    {
+        int u = sources[s];
+        int a = out[u];
+        if (a == 0)
+            break;
+
+        // u is not its own target, and its key changes once its arcs are placed
+        if (slot[u] != -1)
+            heap_remove(&heap, u);
+        out[u] = 0;
+        if (stamp)
+        {
+            for (int e = in_head[u]; e != -1; e = in_next[e])
+                stamp[edges[e].u] = u + 1;
+        }
+
+        // Targets: the a vertices of largest residual in-degree (minus refused ones)
+        int picked_count = 0, held_count = 0;
+        while (picked_count < a && heap.size > 0)
+        {
+            int v = heap_pop(&heap);
+            if (stamp && stamp[v] == u + 1)
+                held[held_count++] = v;
+            else
+                picked[picked_count++] = v;
+        }
+        if (picked_count < a)
+            ok = false;
+
+        for (int i = 0; i < picked_count && ok; i++)
+        {
+            int v = picked[i];
+            edges[count].u = u;
+            edges[count].v = v;
+            if (in_next)
+            {
+                in_next[count] = in_head[v];
+                in_head[v] = count;
+            }
+            count++;
+            in[v]--;
+        }
+        for (int i = 0; i < picked_count; i++)
+        {
+            if (in[picked[i]] > 0)
+                heap_push(&heap, picked[i]);
+        }
+        for (int i = 0; i < held_count; i++)
+            heap_push(&heap, held[i]);
+        if (in[u] > 0)
+            heap_push(&heap, u);
+    }
+
+    free(out);
+    free(in);
+    free(items);
+    free(slot);
+    free(picked);
+    free(held);
+    free(sources);
+    free(in_head);
+    free(in_next);
+    free(stamp);
+    if (!ok)
+    {
+        free(edges);
+        // Skipping reverse targets is only a heuristic: settle the rest exactly
+        return !allow_bidirectional && oriented_search(out_degrees, in_degrees, n, m, edges_out, edge_count_out);
+    }
+    *edges_out = edges;
+    *edge_count_out = count;
+    return true;
+}
+
 /**
  * @brief Comparison function for sorting nodes by degree in descending order
  *
@@ -76,294 +1115,159 @@ int compare_nodes_in_degree(const void *a, const void *b)
     return node_a->original_index - node_b->original_index;
 }
 
+/* ========================================================================
+ * GRAPH BUILDERS: Engine output → matrix and CSR view
+ * ========================================================================*/
+
+/**
+ * @brief Sets up the graph header without storage (safe for graph_free_storage())
+ */
+static void graph_init_empty(Graph *graph, int n, bool is_directed, bool allow_bidirectional)
+{
+    graph->node_count = n;
+    graph->is_directed = is_directed;
+    graph->allow_bidirectional = allow_bidirectional;
+    graph->csr = NULL;
+    graph->adjacency = NULL;
+}
+
+/**
+ * @brief Allocates an empty n × n adjacency matrix for the graph
+ */
+static void graph_init_matrix(Graph *graph, int n, bool is_directed, bool allow_bidirectional)
+{
+    graph_init_empty(graph, n, is_directed, allow_bidirectional);
+    graph->adjacency = malloc(n * sizeof(int *));
+    for (int i = 0; i < n; i++)
+    {
+        graph->adjacency[i] = calloc(n, sizeof(int));
+    }
+}
+
+/**
+ * @brief Copies a realized edge list into the graph, then frees it
+ */
+static void graph_adopt_edges(Graph *graph, Edge *edges, int edge_count)
+{
+    for (int i = 0; i < edge_count; i++)
+    {
+        int u = edges[i].u, v = edges[i].v;
+        graph->adjacency[u][v] = 1;
+        if (!graph->is_directed)
+            graph->adjacency[v][u] = 1;
+    }
+
+    // Build CSR view from the realized edges
+    graph->csr = csr_create_from_edges(graph->node_count, edges, edge_count, graph->is_directed);
+    free(edges);
+}
+
 /**
  * @brief Constructs undirected graph using classical Havel-Hakimi algorithm
  *
  * Implements the classical Havel-Hakimi algorithm for undirected graphs:
  *
  * Algorithm Steps:
- * 1. Sort vertices by degree in descending order
+ * 1. Order vertices by degree in descending order (degree buckets)
  * 2. Take vertex v with highest degree d
  * 3. Connect v to the next d vertices with highest degrees
- * 4. Reduce the degrees of connected vertices by 1
+ * 4. Reduce the degrees of connected vertices by 1 (one swap each)
  * 5. Set v's degree to 0 and repeat until all degrees are 0
  *
  * The algorithm simultaneously:
  * - Validates that the degree sequence is graphical
  * - Constructs the actual graph structure
- * - Generates DOT file for visualization
  *
- * @param nodes Array of Node structures with degree information (modified during execution)
+ * @param nodes Array of Node structures with degree information (degrees are zero on success)
  * @param n Number of vertices in the graph
- * @param dot_file Open file pointer for DOT format output
  * @param graph Graph structure to populate with adjacency matrix
  * @return true if degree sequence is graphical and graph constructed successfully
  */
-bool havel_hakimi_undirected(Node *nodes, int n, FILE *dot_file, Graph *graph)
+bool havel_hakimi_undirected(Node *nodes, int n, Graph *graph)
 {
-    /* ========================================================================
-     * INITIALIZATION: Set up graph structure and DOT file
-     * ========================================================================*/
+    int *degrees = malloc((n > 0 ? n : 1) * sizeof(int));
+    for (int i = 0; i < n && degrees; i++)
+        degrees[nodes[i].original_index] = nodes[i].degree;
 
-    // Write DOT file header for undirected graph
-    fprintf(dot_file, "graph G {\n");
-
-    // Initialize graph structure
-    graph->node_count = n;
-    graph->is_directed = false;
-    graph->allow_bidirectional = false;
-
-    // Allocate and initialize adjacency matrix (all zeros initially)
-    graph->adjacency = malloc(n * sizeof(int *));
-    for (int i = 0; i < n; i++)
+    // Reject non-graphical sequences before the O(n²) matrix
+    if (!degrees || !is_graphical_sequence(degrees, n))
     {
-        graph->adjacency[i] = calloc(n, sizeof(int));
+        free(degrees);
+        graph_init_empty(graph, n, false, false);
+        return false;
     }
 
-    /* ========================================================================
-     * MAIN ALGORITHM LOOP: Iterative degree reduction
-     * ========================================================================*/
+    graph_init_matrix(graph, n, false, false);
 
-    while (true)
+    Edge *edges = NULL;
+    int edge_count = 0;
+    bool ok = havel_hakimi_realize(degrees, n, &edges, &edge_count);
+    free(degrees);
+    if (ok)
     {
-        // Sort vertices by current degree (descending order)
-        qsort(nodes, n, sizeof(Node), compare_nodes);
-
-        // Find first vertex with non-zero degree
-        int idx = 0;
-        while (idx < n && nodes[idx].degree == 0)
-        {
-            idx++;
-        }
-
-        // If all degrees are zero, construction is complete
-        if (idx == n)
-        {
-            break;
-        }
-
-        // Get vertex with highest degree
-        Node u = nodes[idx];
-        int d = u.degree;
-
-        // Validity check: degree cannot exceed remaining vertices
-        if (d > n - 1 - idx)
-        {
-            fprintf(dot_file, "}\n"); // Close DOT file properly
-            return false;             // Invalid degree sequence
-        }
-
-        /* ====================================================================
-         * EDGE CREATION: Connect current vertex to next d highest-degree vertices
-         * ====================================================================*/
-
-        int edges_added = 0;
-        for (int i = idx + 1; i < n && edges_added < d; i++)
-        {
-            Node v = nodes[i];
-
-            // Check if edge can be added (no self-loops, no duplicate edges, positive degree)
-            if (v.degree > 0 &&
-                u.original_index != v.original_index &&
-                graph->adjacency[u.original_index][v.original_index] == 0)
-            {
-
-                // Add edge to adjacency matrix (undirected: both directions)
-                graph->adjacency[u.original_index][v.original_index] = 1;
-                graph->adjacency[v.original_index][u.original_index] = 1;
-
-                // Write edge to DOT file
-                fprintf(dot_file, "  %d -- %d;\n", u.original_index, v.original_index);
-
-                // Reduce degree of target vertex
-                nodes[i].degree--;
-                edges_added++;
-            }
-        }
-
-        // Validity check: ensure we could add all required edges
-        if (edges_added < d)
-        {
-            fprintf(dot_file, "}\n"); // Close DOT file properly
-            return false;             // Could not realize the degree sequence
-        }
-
-        // Set current vertex degree to zero (processed)
-        nodes[idx].degree = 0;
+        graph_adopt_edges(graph, edges, edge_count);
+        for (int i = 0; i < n; i++)
+            nodes[i].degree = 0; // Every degree has been realized
     }
-
-    // Close DOT file
-    fprintf(dot_file, "}\n");
-    return true; // Successful construction
+    return ok;
 }
 
 /**
- * @brief Constructs directed graph using modified Havel-Hakimi algorithm
+ * @brief Constructs directed graph using the Kleitman-Wang algorithm
  *
- * Implements a modified Havel-Hakimi algorithm for directed graphs that handles
- * both out-degree and in-degree sequences simultaneously.
+ * Kleitman-Wang generalizes Havel-Hakimi to (out-degree, in-degree) pairs.
  *
  * Algorithm Steps:
- * 1. Maintain separate out-degree and in-degree for each vertex
- * 2. Find vertex with highest out-degree
- * 3. Find vertex with highest in-degree (among valid targets)
- * 4. Create directed edge between them
- * 5. Reduce respective degrees and repeat
+ * 1. Keep all vertices with remaining in-degree in a heap ordered by
+ *    residual in-degree, ties by residual out-degree
+ * 2. Take the next vertex u with out-degree a > 0
+ * 3. Connect u to the a heap vertices of largest in-degree (u excluded)
+ * 4. Reduce their in-degrees, set u's out-degree to 0 and repeat
  *
  * The algorithm ensures:
- * - No self-loops (unless specifically allowed)
- * - No duplicate edges (unless bidirectional edges are allowed)
- * - Proper degree sequence realization
+ * - No self-loops
+ * - No duplicate edges
+ * - With allow_bidirectional = false, no pair of opposite arcs: targets that
+ *   already point at u are skipped, and if that greedy rule gets stuck an
+ *   exact search decides the sequence (see kleitman_wang_realize())
  *
  * @param nodes Array of Node structures with out-degree and in-degree information
  * @param n Number of vertices in the graph
- * @param dot_file Open file pointer for DOT format output (digraph)
  * @param graph Graph structure to populate with adjacency matrix
  * @param allow_bidirectional If true, allows bidirectional edges in directed graph
  * @return true if both degree sequences are graphical and graph constructed successfully
  */
-bool havel_hakimi_directed(Node *nodes, int n, FILE *dot_file, Graph *graph, bool allow_bidirectional)
+bool havel_hakimi_directed(Node *nodes, int n, Graph *graph, bool allow_bidirectional)
 {
-    /* ========================================================================
-     * INITIALIZATION: Set up directed graph structure
-     * ========================================================================*/
-
-    // Write DOT file header for directed graph
-    fprintf(dot_file, "digraph G {\n");
-
-    // Initialize graph structure for directed graph
-    graph->node_count = n;
-    graph->is_directed = true;
-    graph->allow_bidirectional = allow_bidirectional;
-
-    // Allocate and initialize adjacency matrix
-    graph->adjacency = malloc(n * sizeof(int *));
-    for (int i = 0; i < n; i++)
+    int *out_degrees = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *in_degrees = malloc((n > 0 ? n : 1) * sizeof(int));
+    for (int i = 0; i < n && out_degrees && in_degrees; i++)
     {
-        graph->adjacency[i] = calloc(n, sizeof(int));
+        out_degrees[nodes[i].original_index] = nodes[i].degree;
+        in_degrees[nodes[i].original_index] = nodes[i].in_degree;
     }
 
-    /* ========================================================================
-     * MAIN ALGORITHM LOOP: Directed edge creation
-     * ========================================================================*/
-
-    while (true)
+    // Reject non-digraphical sequences before the O(n²) matrix
+    if (!out_degrees || !in_degrees || !is_digraphical_sequence(out_degrees, in_degrees, n))
     {
-        /* ====================================================================
-         * ACTIVE VERTEX IDENTIFICATION: Find vertices with remaining degrees
-         * ====================================================================*/
-
-        // Collect vertices with positive out-degrees (edge sources)
-        Node *active_out = malloc(n * sizeof(Node));
-        Node *active_in = malloc(n * sizeof(Node));
-        int out_count = 0, in_count = 0;
-
-        for (int i = 0; i < n; i++)
-        {
-            if (nodes[i].degree > 0)
-            { // Out-degree > 0
-                active_out[out_count++] = nodes[i];
-            }
-            if (nodes[i].in_degree > 0)
-            { // In-degree > 0
-                active_in[in_count++] = nodes[i];
-            }
-        }
-
-        // If no active vertices remain, construction is complete
-        if (out_count == 0 || in_count == 0)
-        {
-            free(active_out);
-            free(active_in);
-            break;
-        }
-
-        /* ====================================================================
-         * VERTEX SELECTION: Choose source and target for next edge
-         * ====================================================================*/
-
-        // Sort by out-degree (descending) to get highest out-degree vertex
-        qsort(active_out, out_count, sizeof(Node), compare_nodes);
-        Node u = active_out[0]; // Vertex with highest out-degree
-
-        // Sort by in-degree (descending) to prioritize high in-degree targets
-        qsort(active_in, in_count, sizeof(Node), compare_nodes_in_degree);
-
-        /* ====================================================================
-         * EDGE CREATION: Add directed edge with constraint checking
-         * ====================================================================*/
-
-        bool edge_added = false;
-        for (int i = 0; i < in_count; i++)
-        {
-            Node v = active_in[i];
-
-            // Check edge validity constraints
-            bool can_add_edge = (u.original_index != v.original_index) &&                                           // No self-loops
-                                (graph->adjacency[u.original_index][v.original_index] == 0) &&                      // No duplicate edges
-                                (allow_bidirectional || graph->adjacency[v.original_index][u.original_index] == 0); // Bidirectional policy
-
-            if (can_add_edge)
-            {
-                // Add directed edge u → v
-                graph->adjacency[u.original_index][v.original_index] = 1;
-
-                // Write edge to DOT file
-                fprintf(dot_file, "  %d -> %d;\n", u.original_index, v.original_index);
-
-                // Reduce in-degree of target vertex v
-                for (int j = 0; j < n; j++)
-                {
-                    if (nodes[j].original_index == v.original_index)
-                    {
-                        nodes[j].in_degree--;
-                        break;
-                    }
-                }
-
-                edge_added = true;
-                break;
-            }
-        }
-
-        // If no edge could be added, degree sequence is not graphical
-        if (!edge_added)
-        {
-            free(active_out);
-            free(active_in);
-            fprintf(dot_file, "}\n");
-            return false;
-        }
-
-        // Reduce out-degree of source vertex u
-        for (int j = 0; j < n; j++)
-        {
-            if (nodes[j].original_index == u.original_index)
-            {
-                nodes[j].degree--;
-                break;
-            }
-        }
-
-        free(active_out);
-        free(active_in);
+        free(out_degrees);
+        free(in_degrees);
+        graph_init_empty(graph, n, true, allow_bidirectional);
+        return false;
     }
 
-    /* ========================================================================
-     * FINAL VALIDATION: Ensure all degrees are zero
-     * ========================================================================*/
+    graph_init_matrix(graph, n, true, allow_bidirectional);
 
-    // Verify that all degrees have been reduced to zero
-    for (int i = 0; i < n; i++)
+    Edge *edges = NULL;
+    int edge_count = 0;
+    bool ok = kleitman_wang_realize(out_degrees, in_degrees, n, allow_bidirectional, &edges, &edge_count);
+    free(out_degrees);
+    free(in_degrees);
+    if (ok)
     {
-        if (nodes[i].degree != 0 || nodes[i].in_degree != 0)
-        {
-            fprintf(dot_file, "}\n");
-            return false; // Degree sequence could not be fully realized
-        }
+        graph_adopt_edges(graph, edges, edge_count);
+        for (int i = 0; i < n; i++)
+            nodes[i].degree = nodes[i].in_degree = 0;
     }
-
-    // Close DOT file
-    fprintf(dot_file, "}\n");
-    return true; // Successful construction
-}
\ No newline at end of file
+    return ok;
+}
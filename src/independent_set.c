@@ -5,6 +5,8 @@
 #include "independent_set.h"
 #include "clique.h"
 #include "set_utils.h"
+#include "csr_graph.h"
+#include "mis_solver.h"
 
 /**
  * @file independent_set.c
@@ -30,6 +32,7 @@ Graph *create_complement_graph(Graph *original) {
     complement->node_count = original->node_count;
     complement->is_directed = false;
     complement->allow_bidirectional = false;
+    complement->csr = NULL;
 
     // Allocate adjacency matrix for complement
     complement->adjacency = malloc(complement->node_count * sizeof(int *));
@@ -49,24 +52,22 @@ Graph *create_complement_graph(Graph *original) {
  * @brief Finds maximum independent set using complement graph and maximum clique
  * 
  * Uses the theoretical equivalence: Maximum Independent Set in G = Maximum Clique in complement(G)
- * This allows reusing efficient clique detection algorithms.
+ * This allows reusing efficient clique detection algorithms. The complement
+ * is never materialized (see find_maximum_clique_complement()). Sparse
+ * graphs, whose complements are dense, go to the kernelizing
+ * branch-and-reduce solver of mis_solver.h instead.
  */
 Set *find_maximum_independent_set(Graph *graph) {
     if (!graph || graph->is_directed) return NULL;
 
-    // Create complement graph
-    Graph *comp = create_complement_graph(graph);
-    if (!comp) return NULL;
+    // Sparse graphs kernelize well and have dense complements: solve natively
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (csr && 2LL * csr->edge_count < (long long)MIS_SOLVER_CLIQUE_MIN_DEGREE * graph->node_count)
+        return mis_branch_reduce(graph, NULL);
 
-    // Find maximum clique in complement = maximum independent set in original
-    Set *max_clique = find_maximum_clique(comp);
-    
-    // Cleanup complement graph
-    for (int i = 0; i < comp->node_count; i++) free(comp->adjacency[i]);
-    free(comp->adjacency);
-    free(comp);
-
-    return max_clique;
+    // Maximum clique in complement = maximum independent set in original,
+    // searched on a complemented view of graph's own bit matrix
+    return find_maximum_clique_complement(graph);
 }
 
 /**
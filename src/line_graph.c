@@ -3,178 +3,371 @@
  * @brief Line graph generation implementation
  * @author Graph Theory Project Team
  * @date 2024
+ *
+ * Every row of L(G) is known before it is written: row (u, v) is the merge
+ * of the incident-edge lists of u and v without (u, v) itself. Row lengths
+ * are therefore counted up front, turned into offsets with one prefix sum,
+ * and the rows are filled independently into a single neighbor array.
  */
 
+#include <limits.h>
+#include <pthread.h>
+
 #include "line_graph.h"
+#include "csr_graph.h"
+#include "dot_writer.h"
+#include "task_pool.h"
+
+/* ========================================================================
+ * EDGE NUMBERING
+ * ========================================================================*/
 
-int extract_edges_from_adjacency(Graph *graph, Edge **edges)
+int extract_graph_edges(Graph *graph, Edge **edges)
 {
-    int edge_count = 0;
-    for (int i = 0; i < graph->node_count; i++)
+    *edges = NULL;
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return -1;
+
+    *edges = malloc((csr->edge_count > 0 ? csr->edge_count : 1) * sizeof(Edge));
+    if (!*edges)
+        return -1;
+
+    int edge_index = 0;
+    for (int u = 0; u < csr->node_count; u++)
     {
-        for (int j = (graph->is_directed ? 0 : i + 1); j < graph->node_count; j++)
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
         {
-            if (graph->adjacency[i][j] == 1)
-                edge_count++;
+            int v = csr->neighbors[k];
+            // Undirected rows list every edge twice; the u < v copy suffices
+            if (csr->is_directed || u < v)
+                (*edges)[edge_index++] = (Edge){u, v};
         }
     }
+    return edge_index;
+}
 
-    *edges = malloc(edge_count * sizeof(Edge));
-    if (!*edges)
-        return 0;
+/**
+ * @brief Lists the incident edges of every vertex, sorted by edge number
+ *
+ * @param n Number of vertices of the original graph
+ * @param edges Edge list from extract_graph_edges()
+ * @param edge_count Number of edges
+ * @param offsets_out Receives offsets[n + 1] into the incidence array
+ * @param incident_out Receives the incidence array (2 * edge_count entries)
+ * @return true on success, false on allocation failure
+ *
+ * @complexity O(V + E)
+ */
+static bool build_incidence(int n, const Edge *edges, int edge_count, int **offsets_out, int **incident_out)
+{
+    int *offsets = calloc(n + 1, sizeof(int));
+    int *incident = malloc((edge_count > 0 ? 2 * (size_t)edge_count : 1) * sizeof(int));
+    int *cursor = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (!offsets || !incident || !cursor)
+    {
+        free(offsets);
+        free(incident);
+        free(cursor);
+        return false;
+    }
 
-    int edge_index = 0;
-    for (int i = 0; i < graph->node_count; i++)
+    for (int i = 0; i < edge_count; i++)
+    {
+        offsets[edges[i].u + 1]++;
+        offsets[edges[i].v + 1]++;
+    }
+    for (int v = 0; v < n; v++)
+        offsets[v + 1] += offsets[v];
+
+    // Edges are appended in increasing number, so every list comes out sorted
+    memcpy(cursor, offsets, n * sizeof(int));
+    for (int i = 0; i < edge_count; i++)
     {
-        for (int j = (graph->is_directed ? 0 : i + 1); j < graph->node_count; j++)
+        incident[cursor[edges[i].u]++] = i;
+        incident[cursor[edges[i].v]++] = i;
+    }
+
+    free(cursor);
+    *offsets_out = offsets;
+    *incident_out = incident;
+    return true;
+}
+
+/* ========================================================================
+ * PARALLEL ROW FILL
+ * ========================================================================*/
+
+typedef struct
+{
+    const Edge *edges;
+    const int *inc_offsets;    // Incidence lists of the original graph
+    const int *incident;
+    const int *offsets;        // Line graph rows
+    int *neighbors;
+    int begin;                 // Row range [begin, end)
+    int end;
+} LineSlice;
+
+/**
+ * @brief Writes rows [begin, end) as merges of two sorted incidence lists
+ *
+ * The edge itself is in both lists and skipped; any other edge in both
+ * lists (the reverse arc of a digraph 2-cycle) is written once.
+ */
+static void fill_slice(const LineSlice *slice)
+{
+    const int *incident = slice->incident;
+    for (int e = slice->begin; e < slice->end; e++)
+    {
+        int u = slice->edges[e].u, v = slice->edges[e].v;
+        int a = slice->inc_offsets[u], a_end = slice->inc_offsets[u + 1];
+        int b = slice->inc_offsets[v], b_end = slice->inc_offsets[v + 1];
+        int *out = slice->neighbors + slice->offsets[e];
+
+        while (a < a_end || b < b_end)
         {
-            if (graph->adjacency[i][j] == 1)
+            int next;
+            if (b == b_end || (a < a_end && incident[a] < incident[b]))
+                next = incident[a++];
+            else if (a == a_end || incident[b] < incident[a])
+                next = incident[b++];
+            else
             {
-                (*edges)[edge_index].u = i;
-                (*edges)[edge_index].v = j;
-                edge_index++;
+                next = incident[a++];
+                b++;
             }
+            if (next != e)
+                *out++ = next;
         }
     }
-    return edge_count;
 }
 
-void build_node_edges_mapping(Edge *edges, int edge_count, int node_count, int ***node_edges, int **node_edges_count)
+static void *fill_main(void *arg)
 {
-    *node_edges = malloc(node_count * sizeof(int *));
-    *node_edges_count = calloc(node_count, sizeof(int));
+    fill_slice(arg);
+    return NULL;
+}
 
-    // Count incident edges for each node
-    for (int i = 0; i < edge_count; i++)
+/**
+ * @brief First row whose arcs start at or after the given arc index
+ */
+static int row_at_arc(const int *offsets, int rows, int arc)
+{
+    int lo = 0, hi = rows;
+    while (lo < hi)
     {
-        (*node_edges_count)[edges[i].u]++;
-        (*node_edges_count)[edges[i].v]++;
+        int mid = lo + (hi - lo) / 2;
+        if (offsets[mid] < arc)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
+    return lo;
+}
 
-    // Allocate arrays for incident edges
-    for (int i = 0; i < node_count; i++)
+static void fill_rows(const LineSlice *whole, int arcs, int num_threads)
+{
+    int rows = whole->end;
+    int threads = arcs >= LINE_GRAPH_PARALLEL_MIN_ARCS
+                      ? (num_threads > 0 ? num_threads : task_pool_default_threads())
+                      : 1;
+
+    LineSlice local[1];
+    LineSlice *slices = threads > 1 ? malloc(threads * sizeof(LineSlice)) : local;
+    pthread_t *handles = threads > 1 ? malloc(threads * sizeof(pthread_t)) : NULL;
+    bool *started = threads > 1 ? calloc(threads, sizeof(bool)) : NULL;
+    if (!slices || (threads > 1 && (!handles || !started)))
     {
-        if ((*node_edges_count)[i] > 0)
-        {
-            (*node_edges)[i] = malloc((*node_edges_count)[i] * sizeof(int));
-        }
+        if (slices != local)
+            free(slices);
+        free(handles);
+        free(started);
+        slices = local;
+        handles = NULL;
+        started = NULL;
+        threads = 1;
     }
 
-    // Fill incident edge arrays
-    int *current_counts = calloc(node_count, sizeof(int));
-    for (int i = 0; i < edge_count; i++)
+    // Balance slices by arcs, not rows: edges at hubs have the longest rows
+    for (int t = 0; t < threads; t++)
+    {
+        slices[t] = *whole;
+        slices[t].begin = t == 0 ? 0 : row_at_arc(whole->offsets, rows, (int)((long long)arcs * t / threads));
+        slices[t].end = t == threads - 1 ? rows
+                                         : row_at_arc(whole->offsets, rows, (int)((long long)arcs * (t + 1) / threads));
+    }
+
+    // Thread t > 0 fills slice t; the caller fills slice 0 and any slice whose thread failed to start
+    for (int t = 1; t < threads; t++)
+        started[t] = pthread_create(&handles[t], NULL, fill_main, &slices[t]) == 0;
+    fill_slice(&slices[0]);
+    for (int t = 1; t < threads; t++)
     {
-        int u = edges[i].u, v = edges[i].v;
-        (*node_edges)[u][current_counts[u]++] = i;
-        (*node_edges)[v][current_counts[v]++] = i;
+        if (started[t])
+            pthread_join(handles[t], NULL);
+        else
+            fill_slice(&slices[t]);
     }
-    free(current_counts);
+
+    if (slices != local)
+        free(slices);
+    free(handles);
+    free(started);
 }
 
-void build_line_graph(Edge *edges, int edge_count, int **node_edges, int *node_edges_count, int node_count, AdjList **line_graph_adj)
+/* ========================================================================
+ * LINE GRAPH CONSTRUCTION
+ * ========================================================================*/
+
+bool line_graph_build(Graph *graph, int num_threads, Graph *line_graph, Edge **edges_out)
 {
-    *line_graph_adj = malloc(edge_count * sizeof(AdjList));
-    for (int i = 0; i < edge_count; i++)
+    memset(line_graph, 0, sizeof(Graph));
+    if (edges_out)
+        *edges_out = NULL;
+
+    Edge *edges;
+    int edge_count = extract_graph_edges(graph, &edges);
+    if (edge_count < 0)
+        return false;
+    const CSRGraph *csr = graph->csr;
+
+    int *inc_offsets = NULL, *incident = NULL;
+    CSRGraph *line = calloc(1, sizeof(CSRGraph));
+    int *offsets = malloc(((size_t)edge_count + 1) * sizeof(int));
+    bool ok = line && offsets && build_incidence(csr->node_count, edges, edge_count, &inc_offsets, &incident);
+
+    /* Exact row lengths, then one prefix sum */
+    long long arcs = 0;
+    for (int e = 0; ok && e < edge_count; e++)
     {
-        (*line_graph_adj)[i].adjacent = NULL;
-        (*line_graph_adj)[i].count = 0;
-        (*line_graph_adj)[i].capacity = 0;
+        int u = edges[e].u, v = edges[e].v;
+        int length = (inc_offsets[u + 1] - inc_offsets[u]) + (inc_offsets[v + 1] - inc_offsets[v]) - 2;
+        if (csr->is_directed && csr_has_edge(csr, v, u))
+            length--; // v → u is incident to both endpoints but adjacent once
+        offsets[e] = (int)arcs;
+        arcs += length;
+        ok = arcs <= INT_MAX;
     }
 
-    // For each node, connect all pairs of incident edges
-    for (int node = 0; node < node_count; node++)
+    int *neighbors = NULL;
+    if (ok)
     {
-        int count = node_edges_count[node];
-        int *incident_edges = node_edges[node];
+        offsets[edge_count] = (int)arcs;
+        neighbors = malloc((arcs > 0 ? (size_t)arcs : 1) * sizeof(int));
+        ok = neighbors != NULL;
+    }
+    if (ok)
+    {
+        LineSlice whole = {edges, inc_offsets, incident, offsets, neighbors, 0, edge_count};
+        fill_rows(&whole, (int)arcs, num_threads);
+    }
 
-        for (int i = 0; i < count; i++)
-        {
-            for (int j = i + 1; j < count; j++)
-            {
-                int e1 = incident_edges[i], e2 = incident_edges[j];
-
-                // Add e2 to e1's adjacency list
-                if ((*line_graph_adj)[e1].count >= (*line_graph_adj)[e1].capacity)
-                {
-                    (*line_graph_adj)[e1].capacity = (*line_graph_adj)[e1].capacity == 0 ? 1 : (*line_graph_adj)[e1].capacity * 2;
-                    (*line_graph_adj)[e1].adjacent = realloc((*line_graph_adj)[e1].adjacent, (*line_graph_adj)[e1].capacity * sizeof(int));
-                }
-                (*line_graph_adj)[e1].adjacent[(*line_graph_adj)[e1].count++] = e2;
-
-                // Add e1 to e2's adjacency list
-                if ((*line_graph_adj)[e2].count >= (*line_graph_adj)[e2].capacity)
-                {
-                    (*line_graph_adj)[e2].capacity = (*line_graph_adj)[e2].capacity == 0 ? 1 : (*line_graph_adj)[e2].capacity * 2;
-                    (*line_graph_adj)[e2].adjacent = realloc((*line_graph_adj)[e2].adjacent, (*line_graph_adj)[e2].capacity * sizeof(int));
-                }
-                (*line_graph_adj)[e2].adjacent[(*line_graph_adj)[e2].count++] = e1;
-            }
-        }
+    free(inc_offsets);
+    free(incident);
+    if (!ok)
+    {
+        free(line);
+        free(offsets);
+        free(neighbors);
+        free(edges);
+        return false;
     }
+
+    line->node_count = edge_count;
+    line->edge_count = (int)(arcs / 2);
+    line->offsets = offsets;
+    line->neighbors = neighbors;
+    line->is_directed = false;
+
+    line_graph->node_count = edge_count;
+    line_graph->is_directed = false;
+    line_graph->allow_bidirectional = false;
+    line_graph->adjacency = NULL;
+    line_graph->csr = line;
+
+    if (edges_out)
+        *edges_out = edges;
+    else
+        free(edges);
+    return true;
 }
 
-void generate_line_graph_dot(Edge *edges, int edge_count, AdjList *line_graph_adj, const char *filename)
+/* ========================================================================
+ * OUTPUT
+ * ========================================================================*/
+
+bool generate_line_graph_dot(const Edge *edges, const CSRGraph *line_csr, const char *filename)
 {
-    FILE *file = fopen(filename, "w");
-    if (!file)
-        return;
+    int edge_count = line_csr->node_count;
+    DotWriter *w = dot_writer_open(filename, line_csr->edge_count >= DOT_WRITER_BACKGROUND_MIN_EDGES);
+    if (!w)
+        return false;
 
-    fprintf(file, "graph LineGraph {\n  node [shape=circle];\n");
+    dot_writer_text(w, "graph LineGraph {\n  node [shape=circle];\n");
 
     // Generate vertex labels
     for (int i = 0; i < edge_count; i++)
     {
-        fprintf(file, "  E%d [label=\"E%d\\n(%d-%d)\"];\n", i, i, edges[i].u, edges[i].v);
+        dot_writer_text(w, "  E");
+        dot_writer_int(w, i);
+        dot_writer_text(w, " [label=\"E");
+        dot_writer_int(w, i);
+        dot_writer_text(w, "\\n(");
+        dot_writer_int(w, edges[i].u);
+        dot_writer_text(w, "-");
+        dot_writer_int(w, edges[i].v);
+        dot_writer_text(w, ")\"];\n");
     }
 
     // Generate edges
     for (int i = 0; i < edge_count; i++)
     {
-        for (int j = 0; j < line_graph_adj[i].count; j++)
+        for (int k = line_csr->offsets[i]; k < line_csr->offsets[i + 1]; k++)
         {
-            int neighbor = line_graph_adj[i].adjacent[j];
+            int neighbor = line_csr->neighbors[k];
             if (i < neighbor)
             {
-                fprintf(file, "  E%d -- E%d;\n", i, neighbor);
+                dot_writer_edge(w, "E", i, "--", neighbor);
             }
         }
     }
 
-    fprintf(file, "}\n");
-    fclose(file);
+    dot_writer_text(w, "}\n");
+    return dot_writer_close(w);
 }
 
-void generate_line_graph(Graph *graph)
+void generate_line_graph(Graph *graph, const char *dot_path)
 {
     printf("\n=== Line Graph Generation ===\n");
 
-    Edge *edges;
-    int edge_count = extract_edges_from_adjacency(graph, &edges);
-    if (edge_count == 0)
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (csr && csr->edge_count == 0)
     {
         printf("No edges found. Cannot create line graph.\n");
         return;
     }
 
-    printf("Extracted %d edges from original graph.\n", edge_count);
-
-    int **node_edges;
-    int *node_edges_count;
-    build_node_edges_mapping(edges, edge_count, graph->node_count, &node_edges, &node_edges_count);
+    Graph line_graph;
+    Edge *edges;
+    if (!csr || !line_graph_build(graph, 0, &line_graph, &edges))
+    {
+        printf("Error: Cannot build the line graph (out of memory or too many edges)\n");
+        return;
+    }
 
-    AdjList *line_graph_adj;
-    build_line_graph(edges, edge_count, node_edges, node_edges_count, graph->node_count, &line_graph_adj);
+    printf("Extracted %d edges from original graph.\n", line_graph.node_count);
+    printf("Line graph has %d vertices and %d edges.\n", line_graph.node_count, line_graph.csr->edge_count);
 
-    generate_line_graph_dot(edges, edge_count, line_graph_adj, "build/dot_files/line_graph.dot");
-    printf("Line graph DOT file: build/dot_files/line_graph.dot\n");
+    if (dot_path)
+    {
+        if (generate_line_graph_dot(edges, line_graph.csr, dot_path))
+            printf("Line graph DOT file: %s\n", dot_path);
+        else
+            printf("Warning: Cannot write line graph DOT file %s\n", dot_path);
+    }
 
     // Cleanup
     free(edges);
-    for (int i = 0; i < graph->node_count; i++)
-        free(node_edges[i]);
-    free(node_edges);
-    free(node_edges_count);
-    for (int i = 0; i < edge_count; i++)
-        free(line_graph_adj[i].adjacent);
-    free(line_graph_adj);
-}
\ No newline at end of file
+    graph_free_storage(&line_graph);
+}
@@ -14,6 +14,12 @@
 #include "line_graph.h"
 #include "vertex_cover.h"
 #include "connectivity_number.h"
+#include "csr_graph.h"
+#include "dot_writer.h"
+#include "graph_io.h"
+#include "batch.h"
+#include "reorder.h"
+#include "graph_stats.h"
 
 /**
  * @file main.c
@@ -42,6 +48,145 @@
  * and memory management automatically.
  */
 
+/**
+ * @brief Reads a degree sequence from stdin and builds the graph from it
+ *
+ * Collects the vertex count and the degree (or out-/in-degree) sequence,
+ * validates it (degree sums, then Erdős-Gallai / Fulkerson-Chen-Anstee) and
+ * runs Havel-Hakimi or Kleitman-Wang.
+ *
+ * @param graph Graph to construct
+ * @param is_directed Whether to read and build a directed graph
+ * @param allow_bidirectional For directed graphs: allow opposite arc pairs
+ * @param exit_code Receives the program exit status when construction fails
+ * @return true if the graph was built
+ */
+static bool build_graph_from_input(Graph *graph, bool is_directed, bool allow_bidirectional, int *exit_code)
+{
+    /* ========================================================================
+     * DEGREE SEQUENCE INPUT: Collect and validate vertex degrees
+     * ========================================================================*/
+
+    printf("\nEnter the number of nodes: ");
+    int n;
+    if (scanf("%d", &n) != 1)
+    {
+        *exit_code = 1;
+        return false;
+    }
+
+    // Allocate memory for node structures and degree arrays
+    int *degrees = malloc(n * sizeof(int));
+    int *in_degrees = is_directed ? malloc(n * sizeof(int)) : NULL;
+
+    if (is_directed)
+    {
+        // For directed graphs: collect both out-degrees and in-degrees
+        printf("\nEnter the out-degree sequence separated by spaces:\n");
+        for (int i = 0; i < n; i++)
+            scanf("%d", &degrees[i]);
+
+        printf("\nEnter the in-degree sequence separated by spaces:\n");
+        for (int i = 0; i < n; i++)
+            scanf("%d", &in_degrees[i]);
+
+        // Validate: sum of out-degrees must equal sum of in-degrees
+        int out_sum = 0, in_sum = 0;
+        for (int i = 0; i < n; i++)
+        {
+            out_sum += degrees[i];
+            in_sum += in_degrees[i];
+        }
+        if (out_sum != in_sum)
+        {
+            printf("Error: sum(out-degrees) != sum(in-degrees). Invalid sequence.\n");
+            free(degrees);
+            free(in_degrees);
+            *exit_code = 1;
+            return false;
+        }
+    }
+    else
+    {
+        // For undirected graphs: collect degree sequence
+        printf("Enter the degree sequence separated by spaces:\n");
+        for (int i = 0; i < n; i++)
+            scanf("%d", &degrees[i]);
+
+        // Validate: sum of degrees must be even (handshaking lemma)
+        int sum = 0;
+        for (int i = 0; i < n; i++)
+            sum += degrees[i];
+        if (sum % 2 != 0)
+        {
+            printf("Error: Sum of degrees must be even (handshaking lemma).\n");
+            free(degrees);
+            *exit_code = 1;
+            return false;
+        }
+    }
+
+    /* ========================================================================
+     * GRAPHICALITY PRE-CHECK: Reject sequences before any graph is built
+     * ========================================================================*/
+
+    // Erdős-Gallai / Fulkerson-Chen-Anstee in O(n): no matrix, no DOT file
+    bool graphical = is_directed ? is_digraphical_sequence(degrees, in_degrees, n)
+                                 : is_graphical_sequence(degrees, n);
+    if (!graphical)
+    {
+        printf("Error: Not a valid graphical sequence (%s condition fails).\n",
+               is_directed ? "Fulkerson-Chen-Anstee" : "Erdős-Gallai");
+        free(degrees);
+        if (is_directed)
+            free(in_degrees);
+        *exit_code = 0;
+        return false;
+    }
+
+    /* ========================================================================
+     * NODE INITIALIZATION: Prepare data for Havel-Hakimi algorithm
+     * ========================================================================*/
+
+    // Initialize Node structures with degree information and original indices
+    Node *nodes = malloc(n * sizeof(Node));
+    for (int i = 0; i < n; i++)
+    {
+        nodes[i].original_index = i;                          // Preserve original vertex numbering
+        nodes[i].degree = degrees[i];                         // Out-degree for directed, degree for undirected
+        nodes[i].in_degree = is_directed ? in_degrees[i] : 0; // In-degree only for directed
+    }
+
+    /* ========================================================================
+     * GRAPH CONSTRUCTION: Havel-Hakimi algorithm execution
+     * ========================================================================*/
+
+    // Execute appropriate Havel-Hakimi algorithm based on graph type
+    bool result;
+    if (is_directed)
+        result = havel_hakimi_directed(nodes, n, graph, allow_bidirectional);
+    else
+        result = havel_hakimi_undirected(nodes, n, graph);
+
+    // Check if degree sequence was graphical (realizable)
+    if (!result)
+    {
+        printf("Error: Not a valid graphical sequence.\n");
+        free(nodes);
+        free(degrees);
+        if (is_directed)
+            free(in_degrees);
+        *exit_code = 0;
+        return false;
+    }
+
+    free(nodes);
+    free(degrees);
+    if (is_directed)
+        free(in_degrees);
+    return true;
+}
+
 /**
  * @brief Main function - Interactive graph theory analysis program
  *
@@ -54,13 +199,14 @@
  *    - Prompts user for graph type and analysis preferences
  *
  * 2. Input Phase:
+ *    - Loads a graph file if one was given (skipping the remaining input steps)
  *    - Accepts degree sequences from user
  *    - Validates sequences (sum must be even for undirected, sum(out) = sum(in) for directed)
  *    - Creates Node structures for Havel-Hakimi algorithm
  *
  * 3. Graph Construction:
  *    - Uses Havel-Hakimi algorithm to construct graph from degree sequence
- *    - Generates DOT file for visualization
+ *    - Streams the finished graph to a DOT file (skipped with --no-dot)
  *    - Creates PNG image using Graphviz (if available)
  *
  * 4. Analysis Phase:
@@ -72,6 +218,21 @@
  *    - Frees all allocated memory
  *    - Closes files and releases resources
  *
+ * Command line:
+ *    --no-dot             Skip all DOT/PNG output (graph and line graph)
+ *    --save FILE          Write the graph as a binary CSR file (see graph_io.h)
+ *    --load FILE          Map a binary graph file instead of reading a degree sequence
+ *    --edges FILE         Parse a SNAP-style edge list (add --directed for arcs)
+ *    --metis FILE         Parse a METIS graph file
+ *    --batch JOBFILE      Run the jobs of a job file non-interactively (see batch.h)
+ *    --run ANALYSES       Run analyses on the input file non-interactively
+ *    --format json|csv    Result format of --batch and --run (default json)
+ *    --time-limit SECONDS Wall-clock budget of each clique search of --batch / --run
+ *    --node-limit NODES   Search-node budget of each clique search of --batch / --run
+ *    --order none|degree|rcm Relabel each graph of --batch / --run for locality first
+ *
+ * @param argc Argument count
+ * @param argv Argument vector
  * @return 0 on successful completion, 1 on error
  *
  * @complexity Varies by chosen algorithms, from O(V+E) to O(3^(n/3))
@@ -81,8 +242,115 @@
  * @note All user input is validated before processing
  * @note Memory management is handled automatically
  */
-int main()
+int main(int argc, char *argv[])
 {
+    bool write_dot = true;        // Visualization output (DOT and PNG files)
+    const char *input_path = NULL; // Graph file replacing the degree sequence prompts
+    const char *input_format = NULL;
+    bool input_directed = false;   // Edge lists: arcs instead of edges
+    const char *save_path = NULL;  // Binary graph file to write after construction
+    const char *batch_path = NULL; // Job file for batch mode ("-" for stdin)
+    const char *run_list = NULL;   // Analyses to run non-interactively on the input graph
+    BatchFormat format = BATCH_FORMAT_JSON;
+    double time_limit = 0;         // Budget of the batch clique searches (0 = none)
+    long long node_limit = 0;
+    VertexOrder order = VERTEX_ORDER_NONE;
+    bool usage_error = false;
+    for (int i = 1; i < argc && !usage_error; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--no-dot") == 0)
+            write_dot = false;
+        else if (has_value && strcmp(argv[i], "--batch") == 0)
+            batch_path = argv[++i];
+        else if (has_value && strcmp(argv[i], "--run") == 0)
+            run_list = argv[++i];
+        else if (has_value && strcmp(argv[i], "--time-limit") == 0)
+        {
+            char *end;
+            time_limit = strtod(argv[++i], &end);
+            usage_error = *end != '\0' || time_limit <= 0;
+        }
+        else if (has_value && strcmp(argv[i], "--node-limit") == 0)
+        {
+            char *end;
+            node_limit = strtoll(argv[++i], &end, 10);
+            usage_error = *end != '\0' || node_limit <= 0;
+        }
+        else if (has_value && strcmp(argv[i], "--order") == 0)
+        {
+            usage_error = !vertex_order_parse(argv[++i], &order);
+        }
+        else if (has_value && strcmp(argv[i], "--format") == 0)
+        {
+            const char *name = argv[++i];
+            format = strcmp(name, "csv") == 0 ? BATCH_FORMAT_CSV : BATCH_FORMAT_JSON;
+            usage_error = strcmp(name, "csv") != 0 && strcmp(name, "json") != 0;
+        }
+        else if (strcmp(argv[i], "--directed") == 0)
+            input_directed = true;
+        else if (has_value && strcmp(argv[i], "--save") == 0)
+            save_path = argv[++i];
+        else if (has_value && (strcmp(argv[i], "--load") == 0 || strcmp(argv[i], "--edges") == 0 ||
+                               strcmp(argv[i], "--metis") == 0))
+        {
+            input_format = argv[i];
+            input_path = argv[++i];
+        }
+        else
+            usage_error = true;
+    }
+    unsigned run_mask = 0;
+    if (usage_error || (run_list && (!input_path || !batch_parse_analyses(run_list, &run_mask))))
+    {
+        fprintf(stderr,
+                "Usage: %s [--no-dot] [--save FILE] [--load FILE | --edges FILE [--directed] | --metis FILE]\n"
+                "       %s --batch JOBFILE [--format json|csv] [--time-limit SECONDS] [--node-limit NODES]\n"
+                "                 [--order none|degree|rcm]\n"
+                "       %s --load FILE | --edges FILE [--directed] | --metis FILE --run ANALYSES "
+                "[--format json|csv] [--time-limit SECONDS] [--node-limit NODES]\n"
+                "                 [--order none|degree|rcm]\n",
+                argv[0], argv[0], argv[0]);
+        return 1;
+    }
+
+    /* ========================================================================
+     * BATCH MODE: No prompts, no DOT/PNG files, machine-readable results
+     * ========================================================================*/
+
+    batch_set_search_limits(time_limit, node_limit);
+    batch_set_vertex_order(order);
+
+    if (batch_path)
+    {
+        FILE *jobs = strcmp(batch_path, "-") == 0 ? stdin : fopen(batch_path, "r");
+        if (!jobs)
+        {
+            perror("Error: Cannot open job file");
+            return 1;
+        }
+        batch_run_jobs(jobs, format, stdout);
+        if (jobs != stdin)
+            fclose(jobs);
+        return 0;
+    }
+    if (run_list)
+    {
+        CSRGraph *csr = strcmp(input_format, "--load") == 0    ? graph_file_map(input_path)
+                        : strcmp(input_format, "--metis") == 0 ? graph_parse_metis(input_path)
+                                                               : graph_parse_edge_list(input_path, input_directed);
+        Graph graph;
+        if (!csr || !graph_adopt_csr(&graph, csr))
+        {
+            fprintf(stderr, "Error: Cannot load graph from %s\n", input_path);
+            return 1;
+        }
+        batch_write_header(stdout, format);
+        batch_run_graph(&graph, 1, input_path, run_mask, format, stdout);
+        graph_free_storage(&graph);
+        return 0;
+    }
+
     /* ========================================================================
      * SETUP PHASE: Directory creation and file cleanup
      * ========================================================================*/
@@ -109,10 +377,9 @@ int main()
      * VARIABLE DECLARATIONS: User preferences and graph data
      * ========================================================================*/
 
-    int n;                                  // Number of vertices
     char graph_type[16];                    // "directed" or "undirected"
     bool allow_bidirectional = false;       // For directed graphs
-    int clique_algorithm_choice = 0;        // 1=backtracking, 2=branch&bound
+    int clique_algorithm_choice = 0;        // 1=backtracking, 2=branch&bound, 3=degeneracy-ordered, 4=parallel
     char line_graph_choice[8] = "no";       // Generate line graph?
     char max_indep_choice[8] = "no";        // Find maximum independent set?
     char euler_choice[8] = "no";            // Find Euler path?
@@ -123,11 +390,33 @@ int main()
      * USER INPUT PHASE: Graph type and analysis preferences
      * ========================================================================*/
 
-    // Determine graph type (directed vs undirected)
-    printf("Is the graph directed or undirected? (Enter 'directed' or 'undirected'): ");
-    if (scanf("%15s", graph_type) != 1)
-        return 1;
-    bool is_directed = strcmp(graph_type, "directed") == 0;
+    Graph graph;
+    bool is_directed;
+    if (input_path)
+    {
+        // Graph comes from a file: its type is known, so the type prompt is skipped
+        GRAPH_STATS_TIMER_START(load_timer);
+        CSRGraph *csr = strcmp(input_format, "--load") == 0    ? graph_file_map(input_path)
+                        : strcmp(input_format, "--metis") == 0 ? graph_parse_metis(input_path)
+                                                               : graph_parse_edge_list(input_path, input_directed);
+        if (!csr || !graph_adopt_csr(&graph, csr))
+        {
+            printf("Error: Cannot load graph from %s\n", input_path);
+            return 1;
+        }
+        GRAPH_STATS_TIMER_STOP(load_timer, "construction");
+        is_directed = graph.is_directed;
+        printf("Loaded %s graph from %s: %d vertices, %d edges\n", is_directed ? "directed" : "undirected",
+               input_path, graph.node_count, csr->edge_count);
+    }
+    else
+    {
+        // Determine graph type (directed vs undirected)
+        printf("Is the graph directed or undirected? (Enter 'directed' or 'undirected'): ");
+        if (scanf("%15s", graph_type) != 1)
+            return 1;
+        is_directed = strcmp(graph_type, "directed") == 0;
+    }
 
     // For undirected graphs: collect analysis preferences
     if (!is_directed)
@@ -136,9 +425,15 @@ int main()
         printf("\nFor clique analysis, choose an algorithm:\n");
         printf("1. Backtracking (all cliques)\n");
         printf("2. Branch & Bound (maximal cliques)\n");
-        printf("Enter your choice (1 or 2): ");
+        printf("3. Degeneracy-ordered Bron-Kerbosch (maximal cliques, large sparse graphs)\n");
+        printf("4. Parallel Bron-Kerbosch (maximal cliques, all cores)\n");
+        printf("Enter your choice (1-4): ");
         if (scanf("%d", &clique_algorithm_choice) != 1)
+        {
+            if (input_path)
+                graph_free_storage(&graph);
             return 1;
+        }
 
         // Collect preferences for other analyses
         printf("\nGenerate line graph? (yes/no): ");
@@ -156,7 +451,7 @@ int main()
         printf("\nCalculate connectivity number (vertex connectivity)? (yes/no): ");
         scanf("%7s", connectivity_num_choice);
     }
-    else
+    else if (!input_path)
     {
         // For directed graphs: ask about bidirectional edges
         char bidir[8];
@@ -165,131 +460,56 @@ int main()
         allow_bidirectional = strcmp(bidir, "yes") == 0;
     }
 
-    /* ========================================================================
-     * DEGREE SEQUENCE INPUT: Collect and validate vertex degrees
-     * ========================================================================*/
-
-    printf("\nEnter the number of nodes: ");
-    if (scanf("%d", &n) != 1)
-        return 1;
-
-    // Allocate memory for node structures and degree arrays
-    Node *nodes = malloc(n * sizeof(Node));
-    int *degrees = malloc(n * sizeof(int));
-    int *in_degrees = is_directed ? malloc(n * sizeof(int)) : NULL;
-
-    if (is_directed)
+    if (!input_path)
     {
-        // For directed graphs: collect both out-degrees and in-degrees
-        printf("\nEnter the out-degree sequence separated by spaces:\n");
-        for (int i = 0; i < n; i++)
-            scanf("%d", &degrees[i]);
-
-        printf("\nEnter the in-degree sequence separated by spaces:\n");
-        for (int i = 0; i < n; i++)
-            scanf("%d", &in_degrees[i]);
-
-        // Validate: sum of out-degrees must equal sum of in-degrees
-        int out_sum = 0, in_sum = 0;
-        for (int i = 0; i < n; i++)
-        {
-            out_sum += degrees[i];
-            in_sum += in_degrees[i];
-        }
-        if (out_sum != in_sum)
-        {
-            printf("Error: sum(out-degrees) != sum(in-degrees). Invalid sequence.\n");
-            free(nodes);
-            free(degrees);
-            free(in_degrees);
-            return 1;
-        }
-    }
-    else
-    {
-        // For undirected graphs: collect degree sequence
-        printf("Enter the degree sequence separated by spaces:\n");
-        for (int i = 0; i < n; i++)
-            scanf("%d", &degrees[i]);
-
-        // Validate: sum of degrees must be even (handshaking lemma)
-        int sum = 0;
-        for (int i = 0; i < n; i++)
-            sum += degrees[i];
-        if (sum % 2 != 0)
-        {
-            printf("Error: Sum of degrees must be even (handshaking lemma).\n");
-            free(nodes);
-            free(degrees);
-            return 1;
-        }
+        int exit_code;
+        GRAPH_STATS_TIMER_START(build_timer);
+        if (!build_graph_from_input(&graph, is_directed, allow_bidirectional, &exit_code))
+            return exit_code;
+        GRAPH_STATS_TIMER_STOP(build_timer, "construction");
+        printf("Graph generated successfully!\n");
     }
 
     /* ========================================================================
-     * NODE INITIALIZATION: Prepare data for Havel-Hakimi algorithm
+     * VISUALIZATION GENERATION: Create DOT and PNG files
      * ========================================================================*/
 
-    // Initialize Node structures with degree information and original indices
-    for (int i = 0; i < n; i++)
+    // Save the CSR view for later runs (--load)
+    if (save_path)
     {
-        nodes[i].original_index = i;                          // Preserve original vertex numbering
-        nodes[i].degree = degrees[i];                         // Out-degree for directed, degree for undirected
-        nodes[i].in_degree = is_directed ? in_degrees[i] : 0; // In-degree only for directed
+        CSRGraph *csr = graph_ensure_csr(&graph);
+        if (csr && graph_file_write(csr, save_path) == 0)
+            printf("Binary graph file: %s\n", save_path);
+        else
+            printf("Warning: Cannot write binary graph file %s\n", save_path);
     }
 
-    /* ========================================================================
-     * GRAPH CONSTRUCTION: Havel-Hakimi algorithm execution
-     * ========================================================================*/
-
-    // Open DOT file for graph visualization output
-    FILE *dot_file = fopen("build/dot_files/graph.dot", "w");
-    if (!dot_file)
+    // Stream the finished graph to DOT, then render it with Graphviz (if available)
+    if (write_dot)
     {
-        perror("Error: Cannot create DOT file");
-        free(nodes);
-        free(degrees);
-        if (is_directed)
-            free(in_degrees);
-        return 1;
-    }
-
-    // Execute appropriate Havel-Hakimi algorithm based on graph type
-    Graph graph;
-    bool result;
-    if (is_directed)
-        result = havel_hakimi_directed(nodes, n, dot_file, &graph, allow_bidirectional);
-    else
-        result = havel_hakimi_undirected(nodes, n, dot_file, &graph);
-    fclose(dot_file);
-
-    // Check if degree sequence was graphical (realizable)
-    if (!result)
-    {
-        printf("Error: Not a valid graphical sequence.\n");
-        free(nodes);
-        free(degrees);
-        if (is_directed)
-            free(in_degrees);
-        return 0;
+        GRAPH_STATS_TIMER_START(dot_timer);
+        bool dot_written = dot_write_graph(&graph, "build/dot_files/graph.dot");
+        GRAPH_STATS_TIMER_STOP(dot_timer, "dot_write");
+        if (dot_written)
+        {
+            printf("DOT file: build/dot_files/graph.dot\n");
+            system("dot -Tpng build/dot_files/graph.dot -o build/images/graph.png 2> /dev/null");
+            printf("PNG visualization: build/images/graph.png\n");
+        }
+        else
+        {
+            printf("Warning: Cannot write DOT file build/dot_files/graph.dot\n");
+        }
     }
 
-    /* ========================================================================
-     * VISUALIZATION GENERATION: Create DOT and PNG files
-     * ========================================================================*/
-
-    printf("Graph generated successfully!\n");
-    printf("DOT file: build/dot_files/graph.dot\n");
-
-    // Generate PNG image using Graphviz (if available)
-    system("dot -Tpng build/dot_files/graph.dot -o build/images/graph.png 2> /dev/null");
-    printf("PNG visualization: build/images/graph.png\n");
-
     /* ========================================================================
      * CONNECTIVITY ANALYSIS: Basic graph connectivity properties
      * ========================================================================*/
 
     // Analyze connectivity properties for both directed and undirected graphs
+    GRAPH_STATS_TIMER_START(connectivity_timer);
     Connectivity conn = check_connectivity(&graph);
+    GRAPH_STATS_TIMER_STOP(connectivity_timer, "connectivity");
 
     if (graph.is_directed)
     {
@@ -298,42 +518,65 @@ int main()
         printf("Strong connectivity: %s\n", conn.is_strong ? "Yes" : "No");
         printf("Weak connectivity: %s\n", conn.is_weak ? "Yes" : "No");
         printf("One-sided connectivity: %s\n", conn.is_one_sided ? "Yes" : "No");
+        printf("Strongly connected components: %d\n", conn.scc_count);
+        printf("Weakly connected components: %d (largest: %d vertices)\n", conn.component_count,
+               conn.largest_component);
     }
     else
     {
         // For undirected graphs: report basic connectivity
         printf("\n=== Connectivity Analysis ===\n");
         printf("Graph connectivity: %s\n", conn.is_connected ? "Connected" : "Disconnected");
+        printf("Connected components: %d (largest: %d vertices)\n", conn.component_count,
+               conn.largest_component);
 
         /* ====================================================================
          * UNDIRECTED GRAPH ANALYSES: Various graph theory algorithms
          * ====================================================================*/
 
+        // Large loaded graphs have no adjacency matrix; only CSR-based analyses run on them
+        bool has_matrix = graph.adjacency != NULL;
+        if (!has_matrix)
+            printf("\nNote: more than %d vertices, skipping the matrix-based analyses "
+                   "(cliques, line graph, independent set, vertex cover).\n",
+                   GRAPH_IO_MATRIX_MAX_NODES);
+
         // Clique Analysis: Find cliques using chosen algorithm
-        if (clique_algorithm_choice == 1 || clique_algorithm_choice == 2)
+        if (has_matrix && clique_algorithm_choice >= 1 && clique_algorithm_choice <= 4)
         {
+            GRAPH_STATS_TIMER_START(clique_timer);
             analyze_cliques(&graph, clique_algorithm_choice);
+            GRAPH_STATS_TIMER_STOP(clique_timer, "cliques");
         }
 
         // Line Graph Generation: Create line graph if requested
-        if (strcmp(line_graph_choice, "yes") == 0)
+        if (has_matrix && strcmp(line_graph_choice, "yes") == 0)
         {
-            generate_line_graph(&graph);
+            GRAPH_STATS_TIMER_START(line_graph_timer);
+            generate_line_graph(&graph, write_dot ? "build/dot_files/line_graph.dot" : NULL);
+            GRAPH_STATS_TIMER_STOP(line_graph_timer, "line_graph");
             // Generate PNG for line graph
-            system("dot -Tpng build/dot_files/line_graph.dot -o build/images/line_graph.png 2> /dev/null");
-            printf("Line graph files: build/dot_files/line_graph.dot and build/images/line_graph.png\n");
+            if (write_dot && access("build/dot_files/line_graph.dot", F_OK) == 0)
+            {
+                system("dot -Tpng build/dot_files/line_graph.dot -o build/images/line_graph.png 2> /dev/null");
+                printf("Line graph files: build/dot_files/line_graph.dot and build/images/line_graph.png\n");
+            }
         }
 
         // Eulerian Path Analysis: Find Euler paths/cycles if requested
         if (strcmp(euler_choice, "yes") == 0)
         {
+            GRAPH_STATS_TIMER_START(euler_timer);
             find_euler_path(&graph);
+            GRAPH_STATS_TIMER_STOP(euler_timer, "euler");
         }
 
         // Maximum Independent Set: Find largest independent set
-        if (strcmp(max_indep_choice, "yes") == 0)
+        if (has_matrix && strcmp(max_indep_choice, "yes") == 0)
         {
+            GRAPH_STATS_TIMER_START(mis_timer);
             Set *mis = find_maximum_independent_set(&graph);
+            GRAPH_STATS_TIMER_STOP(mis_timer, "independent_set");
             if (mis)
             {
                 printf("\n=== Maximum Independent Set Analysis ===\n");
@@ -350,7 +593,7 @@ int main()
         }
 
         // Vertex Cover Analysis: Find minimum vertex cover using chosen method
-        if (strcmp(vertex_cover_choice, "yes") == 0)
+        if (has_matrix && strcmp(vertex_cover_choice, "yes") == 0)
         {
             printf("\n=== Vertex Cover Analysis ===\n");
             printf("Choose vertex cover algorithm:\n");
@@ -364,6 +607,7 @@ int main()
                 vc_choice = 3;
 
             // Execute chosen vertex cover algorithm
+            GRAPH_STATS_TIMER_START(cover_timer);
             Set *vc = NULL;
             if (vc_choice == 1)
                 vc = vertex_cover_exact_via_mis(&graph);
@@ -371,6 +615,7 @@ int main()
                 vc = vertex_cover_bipartite_konig(&graph);
             else
                 vc = vertex_cover_approx(&graph);
+            GRAPH_STATS_TIMER_STOP(cover_timer, "vertex_cover");
 
             // Display results
             if (vc)
@@ -391,7 +636,9 @@ int main()
         // Connectivity Number Analysis: Calculate vertex connectivity
         if (strcmp(connectivity_num_choice, "yes") == 0)
         {
+            GRAPH_STATS_TIMER_START(kappa_timer);
             analyze_connectivity_number(&graph);
+            GRAPH_STATS_TIMER_STOP(kappa_timer, "connectivity_number");
         }
     }
 
@@ -399,18 +646,11 @@ int main()
      * CLEANUP PHASE: Free all allocated memory and resources
      * ========================================================================*/
 
-    // Free adjacency matrix
-    for (int i = 0; i < graph.node_count; i++)
-    {
-        free(graph.adjacency[i]);
-    }
-    free(graph.adjacency);
+    // Free adjacency matrix and CSR view
+    graph_free_storage(&graph);
 
-    // Free input data structures
-    free(nodes);
-    free(degrees);
-    if (is_directed)
-        free(in_degrees);
+    // Counters, phase times and heap figures (make STATS=1 only)
+    graph_stats_print(stdout);
 
     printf("\n=== Analysis Complete ===\n");
     printf("All output files are saved in the build/ directory.\n");
@@ -0,0 +1,613 @@
+/**
+ * @file matching.c
+ * @brief Hopcroft-Karp maximum bipartite matching implementation
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Seeding, phases and the König reachability all run on the caller's left
+ * rows plus scratch carved from the workspace block.
+ */
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "matching.h"
+#include "csr_graph.h"
+#include "task_pool.h"
+#include "vertex_cover.h" /* for is_bipartite_partition */
+
+/* ========================================================================
+ * WORKSPACE
+ * ========================================================================*/
+
+MatchingWorkspace *matching_workspace_create(void)
+{
+    return calloc(1, sizeof(MatchingWorkspace));
+}
+
+void matching_workspace_destroy(MatchingWorkspace *ws)
+{
+    if (!ws)
+        return;
+    free(ws->block);
+    free(ws);
+}
+
+/**
+ * @brief Makes room for one run and points the arrays into the block
+ *
+ * @param arcs Arcs of the transpose (0 unless Karp-Sipser seeding is used)
+ * @return false on allocation failure (the old block is kept)
+ */
+static bool workspace_reserve(MatchingWorkspace *ws, int left_n, int right_n, int arcs)
+{
+    size_t ints = 4 * (size_t)left_n      // pair_left, dist, next, stack
+                  + (size_t)right_n        // pair_right
+                  + 2 * ((size_t)left_n + right_n) // queue, degree
+                  + (arcs > 0 ? (size_t)right_n + 1 + arcs : 0);
+    size_t bytes = (ints > 0 ? ints : 1) * sizeof(int);
+    if (bytes > ws->block_bytes)
+    {
+        void *block = malloc(bytes);
+        if (!block)
+            return false;
+        free(ws->block);
+        ws->block = block;
+        ws->block_bytes = bytes;
+    }
+
+    int *p = ws->block;
+    ws->pair_left = p;
+    p += left_n;
+    ws->pair_right = p;
+    p += right_n;
+    ws->dist = p;
+    p += left_n;
+    ws->next = p;
+    p += left_n;
+    ws->stack = p;
+    p += left_n;
+    ws->queue = p;
+    p += left_n + right_n;
+    ws->degree = p;
+    p += left_n + right_n;
+    ws->t_offsets = arcs > 0 ? p : NULL;
+    ws->t_neighbors = arcs > 0 ? p + right_n + 1 : NULL;
+
+    ws->left_count = left_n;
+    ws->right_count = right_n;
+    return true;
+}
+
+/* ========================================================================
+ * INITIAL MATCHING
+ * ========================================================================*/
+
+static int greedy_init(MatchingWorkspace *ws, const int *offsets, const int *neighbors)
+{
+    int size = 0;
+    for (int i = 0; i < ws->left_count; i++)
+    {
+        for (int e = offsets[i]; e < offsets[i + 1]; e++)
+        {
+            int j = neighbors[e];
+            if (ws->pair_right[j] < 0)
+            {
+                ws->pair_left[i] = j;
+                ws->pair_right[j] = i;
+                size++;
+                break;
+            }
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Matches left i to right j and updates the free degrees of their neighbors
+ *
+ * queue[*tail] receives every vertex whose free degree drops to 1 (left
+ * vertices as i, right vertices as left_count + j).
+ */
+static void karp_sipser_match(MatchingWorkspace *ws, const int *offsets, const int *neighbors, int i, int j,
+                              int *tail)
+{
+    int left_n = ws->left_count;
+    ws->pair_left[i] = j;
+    ws->pair_right[j] = i;
+    for (int e = offsets[i]; e < offsets[i + 1]; e++)
+    {
+        int r = neighbors[e];
+        if (ws->pair_right[r] < 0 && --ws->degree[left_n + r] == 1)
+            ws->queue[(*tail)++] = left_n + r;
+    }
+    for (int e = ws->t_offsets[j]; e < ws->t_offsets[j + 1]; e++)
+    {
+        int l = ws->t_neighbors[e];
+        if (ws->pair_left[l] < 0 && --ws->degree[l] == 1)
+            ws->queue[(*tail)++] = l;
+    }
+}
+
+/**
+ * @brief Karp-Sipser: match a degree-1 vertex to its only free neighbor
+ *        while there is one, otherwise the next free left vertex greedily
+ *
+ * The degree-1 step never loses optimality; on sparse inputs it leaves very
+ * little for the augmenting phases.
+ */
+static int karp_sipser_init(MatchingWorkspace *ws, const int *offsets, const int *neighbors)
+{
+    int left_n = ws->left_count, right_n = ws->right_count;
+    int arcs = offsets[left_n];
+
+    /* Transpose: right rows, filled in left order */
+    memset(ws->t_offsets, 0, (right_n + 1) * sizeof(int));
+    for (int e = 0; e < arcs; e++)
+        ws->t_offsets[neighbors[e] + 1]++;
+    for (int j = 0; j < right_n; j++)
+        ws->t_offsets[j + 1] += ws->t_offsets[j];
+    for (int i = 0; i < left_n; i++)
+    {
+        for (int e = offsets[i]; e < offsets[i + 1]; e++)
+            ws->t_neighbors[ws->t_offsets[neighbors[e]]++] = i;
+    }
+    for (int j = right_n; j > 0; j--)
+        ws->t_offsets[j] = ws->t_offsets[j - 1];
+    ws->t_offsets[0] = 0;
+
+    int head = 0, tail = 0;
+    for (int i = 0; i < left_n; i++)
+    {
+        ws->degree[i] = offsets[i + 1] - offsets[i];
+        if (ws->degree[i] == 1)
+            ws->queue[tail++] = i;
+    }
+    for (int j = 0; j < right_n; j++)
+    {
+        ws->degree[left_n + j] = ws->t_offsets[j + 1] - ws->t_offsets[j];
+        if (ws->degree[left_n + j] == 1)
+            ws->queue[tail++] = left_n + j;
+    }
+
+    int size = 0, scan = 0;
+    for (;;)
+    {
+        int i = -1, j = -1;
+        while (head < tail && i < 0)
+        {
+            int x = ws->queue[head++];
+            if (x < left_n && ws->pair_left[x] < 0)
+            {
+                for (int e = offsets[x]; e < offsets[x + 1] && j < 0; e++)
+                    if (ws->pair_right[neighbors[e]] < 0)
+                        j = neighbors[e];
+                i = j >= 0 ? x : -1;
+            }
+            else if (x >= left_n && ws->pair_right[x - left_n] < 0)
+            {
+                j = x - left_n;
+                for (int e = ws->t_offsets[j]; e < ws->t_offsets[j + 1] && i < 0; e++)
+                    if (ws->pair_left[ws->t_neighbors[e]] < 0)
+                        i = ws->t_neighbors[e];
+                j = i >= 0 ? j : -1;
+            }
+        }
+        while (i < 0 && scan < left_n)
+        {
+            if (ws->pair_left[scan] < 0)
+            {
+                for (int e = offsets[scan]; e < offsets[scan + 1] && j < 0; e++)
+                    if (ws->pair_right[neighbors[e]] < 0)
+                        j = neighbors[e];
+                i = j >= 0 ? scan : -1;
+            }
+            scan++;
+        }
+        if (i < 0)
+            break;
+        karp_sipser_match(ws, offsets, neighbors, i, j, &tail);
+        size++;
+    }
+    return size;
+}
+
+/* ========================================================================
+ * HOPCROFT-KARP
+ * ========================================================================*/
+
+/**
+ * @brief BFS layers from the free left vertices
+ *
+ * @return true if some free right vertex is reachable (an augmenting path exists)
+ */
+static bool layer_phase(MatchingWorkspace *ws, const int *offsets, const int *neighbors)
+{
+    int head = 0, tail = 0;
+    for (int i = 0; i < ws->left_count; i++)
+    {
+        ws->dist[i] = ws->pair_left[i] < 0 ? 0 : INT_MAX;
+        if (ws->pair_left[i] < 0)
+            ws->queue[tail++] = i;
+    }
+    bool found = false;
+    while (head < tail)
+    {
+        int i = ws->queue[head++];
+        for (int e = offsets[i]; e < offsets[i + 1]; e++)
+        {
+            int owner = ws->pair_right[neighbors[e]];
+            if (owner < 0)
+                found = true;
+            else if (ws->dist[owner] == INT_MAX)
+            {
+                ws->dist[owner] = ws->dist[i] + 1;
+                ws->queue[tail++] = owner;
+            }
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Iterative DFS along the layers, one augmenting path per free vertex
+ *
+ * @return Number of augmenting paths applied
+ */
+static int augment_phase(MatchingWorkspace *ws, const int *offsets, const int *neighbors)
+{
+    int *stack = ws->stack, *next = ws->next;
+    int augmented = 0;
+    memcpy(next, offsets, ws->left_count * sizeof(int));
+    for (int root = 0; root < ws->left_count; root++)
+    {
+        if (ws->pair_left[root] >= 0)
+            continue;
+        int top = 0;
+        stack[0] = root;
+        while (top >= 0)
+        {
+            int i = stack[top];
+            if (next[i] == offsets[i + 1])
+            {
+                ws->dist[i] = INT_MAX; // Dead end for this phase
+                top--;
+                continue;
+            }
+            int owner = ws->pair_right[neighbors[next[i]]];
+            if (owner < 0)
+            {
+                // Flip the path: every stacked vertex takes the edge it descended through
+                for (int t = top; t >= 0; t--)
+                {
+                    int left = stack[t];
+                    int right = neighbors[next[left]];
+                    ws->pair_left[left] = right;
+                    ws->pair_right[right] = left;
+                }
+                augmented++;
+                break;
+            }
+            if (ws->dist[owner] == ws->dist[i] + 1)
+                stack[++top] = owner;
+            else
+                next[i]++;
+        }
+    }
+    return augmented;
+}
+
+int matching_maximum(MatchingWorkspace *ws, int left_n, int right_n, const int *offsets, const int *neighbors,
+                     MatchingInit init)
+{
+    int arcs = init == MATCHING_INIT_KARP_SIPSER ? offsets[left_n] : 0;
+    if (!workspace_reserve(ws, left_n, right_n, arcs))
+        return -1;
+
+    for (int i = 0; i < left_n; i++)
+        ws->pair_left[i] = -1;
+    for (int j = 0; j < right_n; j++)
+        ws->pair_right[j] = -1;
+
+    switch (init)
+    {
+    case MATCHING_INIT_GREEDY:
+        ws->initial_size = greedy_init(ws, offsets, neighbors);
+        break;
+    case MATCHING_INIT_KARP_SIPSER:
+        ws->initial_size = arcs > 0 ? karp_sipser_init(ws, offsets, neighbors) : 0;
+        break;
+    default:
+        ws->initial_size = 0;
+        break;
+    }
+
+    ws->size = ws->initial_size;
+    ws->phases = 0;
+    while (layer_phase(ws, offsets, neighbors))
+    {
+        ws->size += augment_phase(ws, offsets, neighbors);
+        ws->phases++;
+    }
+    return ws->size;
+}
+
+void matching_konig_cover(MatchingWorkspace *ws, const int *offsets, const int *neighbors, bool *cover_left,
+                          bool *cover_right)
+{
+    /* cover_left doubles as "not reached", cover_right as "reached" */
+    int head = 0, tail = 0;
+    for (int i = 0; i < ws->left_count; i++)
+    {
+        cover_left[i] = ws->pair_left[i] >= 0;
+        if (!cover_left[i])
+            ws->queue[tail++] = i;
+    }
+    memset(cover_right, 0, ws->right_count * sizeof(bool));
+
+    while (head < tail)
+    {
+        int i = ws->queue[head++];
+        for (int e = offsets[i]; e < offsets[i + 1]; e++)
+        {
+            int j = neighbors[e];
+            if (cover_right[j])
+                continue;
+            cover_right[j] = true;
+            int owner = ws->pair_right[j];
+            if (owner >= 0 && cover_left[owner])
+            {
+                cover_left[owner] = false;
+                ws->queue[tail++] = owner;
+            }
+        }
+    }
+}
+
+/* ========================================================================
+ * GRAPH-LEVEL MATCHING
+ * ========================================================================*/
+
+int graph_maximum_matching(Graph *graph, MatchingInit init, int **mate_out)
+{
+    if (mate_out)
+        *mate_out = NULL;
+    char *left_mask = NULL, *right_mask = NULL;
+    if (!graph || graph->is_directed || !is_bipartite_partition(graph, &left_mask, &right_mask))
+        return -1;
+    free(right_mask);
+
+    const CSRGraph *csr = graph->csr;
+    int n = csr->node_count;
+    int *index = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *vertex = malloc((n > 0 ? n : 1) * sizeof(int)); // Left vertices, then right vertices
+    int *offsets = malloc(((size_t)n + 1) * sizeof(int));
+    int *neighbors = calloc(csr->edge_count > 0 ? csr->edge_count : 1, sizeof(int));
+    int *mate = mate_out ? malloc((n > 0 ? n : 1) * sizeof(int)) : NULL;
+    MatchingWorkspace *ws = matching_workspace_create();
+    int size = -1;
+
+    if (index && vertex && offsets && neighbors && ws && (mate || !mate_out))
+    {
+        int left_n = 0, right_n = 0;
+        for (int v = 0; v < n; v++)
+            index[v] = left_mask[v] ? left_n++ : right_n++;
+        for (int v = 0; v < n; v++)
+            vertex[left_mask[v] ? index[v] : left_n + index[v]] = v;
+
+        // Left rows in local numbering; every edge has exactly one left endpoint
+        offsets[0] = 0;
+        for (int i = 0; i < left_n; i++)
+        {
+            int u = vertex[i];
+            offsets[i + 1] = offsets[i];
+            for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+                neighbors[offsets[i + 1]++] = index[csr->neighbors[k]];
+        }
+
+        size = matching_maximum(ws, left_n, right_n, offsets, neighbors, init);
+        if (size >= 0 && mate)
+        {
+            for (int i = 0; i < left_n; i++)
+            {
+                int j = ws->pair_left[i];
+                mate[vertex[i]] = j >= 0 ? vertex[left_n + j] : -1;
+            }
+            for (int j = 0; j < right_n; j++)
+            {
+                int i = ws->pair_right[j];
+                mate[vertex[left_n + j]] = i >= 0 ? vertex[i] : -1;
+            }
+        }
+    }
+
+    free(left_mask);
+    free(index);
+    free(vertex);
+    free(offsets);
+    free(neighbors);
+    matching_workspace_destroy(ws);
+    if (size >= 0 && mate_out)
+        *mate_out = mate;
+    else
+        free(mate);
+    return size;
+}
+
+/* ========================================================================
+ * PARALLEL MAXIMAL MATCHING
+ * ========================================================================*/
+
+/** Active vertices handed out per chunk */
+#define MAXIMAL_CHUNK 1024
+
+typedef struct
+{
+    const CSRGraph *csr;
+    unsigned long long seed;
+    int *mate;
+    int *target;           // Proposal of every active vertex, -1 if it has no free neighbor
+    int *active;           // Active vertices; chunk c is active[c * MAXIMAL_CHUNK ...]
+    int active_count;
+    int *kept;             // Commit phase: vertices kept per chunk (compacted to the chunk start)
+    int chunk_count;
+    atomic_int next_chunk;
+    bool commit;           // Phase: false = propose, true = commit
+} MaximalRound;
+
+/**
+ * @brief Priority of edge {u, v}; splitmix64 is a bijection, so distinct edges never tie
+ */
+static inline unsigned long long edge_priority(unsigned long long seed, int u, int v)
+{
+    unsigned long long a = (unsigned)(u < v ? u : v), b = (unsigned)(u < v ? v : u);
+    unsigned long long z = ((a << 32) | b) ^ seed;
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void propose_chunk(MaximalRound *r, int begin, int end)
+{
+    const CSRGraph *csr = r->csr;
+    for (int i = begin; i < end; i++)
+    {
+        int u = r->active[i], best = -1;
+        // The best free neighbor stays best while it is free: neighbors only ever drop out
+        if (r->target[u] >= 0 && r->mate[r->target[u]] < 0)
+            continue;
+        unsigned long long best_priority = 0;
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+        {
+            int v = csr->neighbors[k];
+            if (v == u || r->mate[v] >= 0)
+                continue;
+            unsigned long long priority = edge_priority(r->seed, u, v);
+            if (best < 0 || priority > best_priority)
+            {
+                best = v;
+                best_priority = priority;
+            }
+        }
+        r->target[u] = best;
+    }
+}
+
+/**
+ * @brief Matches mutual proposals and compacts the chunk's surviving vertices
+ */
+static void commit_chunk(MaximalRound *r, int chunk, int begin, int end)
+{
+    int kept = 0;
+    for (int i = begin; i < end; i++)
+    {
+        int u = r->active[i], v = r->target[u];
+        if (v < 0)
+            continue; // No free neighbor now, none later
+        if (r->target[v] == u)
+            r->mate[u] = v; // v's own commit writes mate[v]
+        else
+            r->active[begin + kept++] = u;
+    }
+    r->kept[chunk] = kept;
+}
+
+static void *maximal_main(void *arg)
+{
+    MaximalRound *r = arg;
+    for (;;)
+    {
+        int chunk = atomic_fetch_add_explicit(&r->next_chunk, 1, memory_order_relaxed);
+        if (chunk >= r->chunk_count)
+            break;
+        int begin = chunk * MAXIMAL_CHUNK;
+        int end = begin + MAXIMAL_CHUNK < r->active_count ? begin + MAXIMAL_CHUNK : r->active_count;
+        if (r->commit)
+            commit_chunk(r, chunk, begin, end);
+        else
+            propose_chunk(r, begin, end);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs one phase over all chunks; the caller works alongside the threads
+ */
+static void maximal_phase(MaximalRound *r, bool commit, int threads, pthread_t *handles, bool *started)
+{
+    r->commit = commit;
+    atomic_store(&r->next_chunk, 0);
+    if (threads > r->chunk_count)
+        threads = r->chunk_count;
+    for (int t = 1; t < threads; t++)
+        started[t] = pthread_create(&handles[t], NULL, maximal_main, r) == 0;
+    maximal_main(r);
+    for (int t = 1; t < threads; t++)
+    {
+        if (started[t])
+            pthread_join(handles[t], NULL);
+    }
+}
+
+int matching_maximal_parallel(const CSRGraph *csr, int num_threads, unsigned long long seed, int *mate)
+{
+    int n = csr->node_count;
+    int threads = csr->offsets[n] >= MATCHING_PARALLEL_MIN_ARCS
+                      ? (num_threads > 0 ? num_threads : task_pool_default_threads())
+                      : 1;
+
+    MaximalRound r = {csr, seed, mate, NULL, NULL, 0, NULL, 0, 0, false};
+    r.target = malloc((n > 0 ? n : 1) * sizeof(int));
+    r.active = malloc((n > 0 ? n : 1) * sizeof(int));
+    r.kept = malloc(((size_t)n / MAXIMAL_CHUNK + 1) * sizeof(int));
+    pthread_t *handles = threads > 1 ? malloc(threads * sizeof(pthread_t)) : NULL;
+    bool *started = threads > 1 ? calloc(threads, sizeof(bool)) : NULL;
+    if (!r.target || !r.active || !r.kept)
+    {
+        free(r.target);
+        free(r.active);
+        free(r.kept);
+        free(handles);
+        free(started);
+        return -1;
+    }
+    if (threads > 1 && (!handles || !started))
+        threads = 1;
+
+    for (int v = 0; v < n; v++)
+    {
+        mate[v] = -1;
+        r.target[v] = -1;
+        if (csr_degree(csr, v) > 0)
+            r.active[r.active_count++] = v;
+    }
+
+    while (r.active_count > 0)
+    {
+        r.chunk_count = (r.active_count + MAXIMAL_CHUNK - 1) / MAXIMAL_CHUNK;
+        maximal_phase(&r, false, threads, handles, started);
+        maximal_phase(&r, true, threads, handles, started);
+
+        // Concatenate the compacted chunks in order, so the next round is deterministic too
+        int count = 0;
+        for (int c = 0; c < r.chunk_count; c++)
+        {
+            memmove(r.active + count, r.active + (size_t)c * MAXIMAL_CHUNK, r.kept[c] * sizeof(int));
+            count += r.kept[c];
+        }
+        r.active_count = count;
+    }
+
+    int size = 0;
+    for (int v = 0; v < n; v++)
+        size += mate[v] > v;
+
+    free(r.target);
+    free(r.active);
+    free(r.kept);
+    free(handles);
+    free(started);
+    return size;
+}
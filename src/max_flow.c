@@ -0,0 +1,301 @@
+/**
+ * @file max_flow.c
+ * @brief Dinic maximum flow implementation
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Each phase builds a BFS level graph from the source and then pushes a
+ * blocking flow with an iterative, current-arc DFS (no recursion, so long
+ * augmenting paths cannot overflow the stack). Nodes found to be dead ends
+ * are dropped from the level graph for the rest of the phase.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "max_flow.h"
+
+/* ========================================================================
+ * CONSTRUCTION
+ * ========================================================================*/
+
+FlowNetwork *flow_network_create(int node_count, int arc_hint)
+{
+    FlowNetwork *net = calloc(1, sizeof(FlowNetwork));
+    if (!net)
+        return NULL;
+
+    int slots = node_count > 0 ? node_count : 1;
+    net->node_count = node_count;
+    net->arc_capacity = 2 * (arc_hint > 0 ? arc_hint : 1);
+    net->head = malloc(slots * sizeof(int));
+    net->level = malloc(slots * sizeof(int));
+    net->stamp = calloc(slots, sizeof(int));
+    net->cur = malloc(slots * sizeof(int));
+    net->queue = malloc(slots * sizeof(int));
+    net->path = malloc(slots * sizeof(int));
+    net->next = malloc(net->arc_capacity * sizeof(int));
+    net->to = malloc(net->arc_capacity * sizeof(int));
+    net->cap = malloc(net->arc_capacity * sizeof(int));
+    net->orig_cap = malloc(net->arc_capacity * sizeof(int));
+    net->dirty = malloc((net->arc_capacity / 2) * sizeof(int));
+    net->dirty_mark = calloc(net->arc_capacity / 2, sizeof(bool));
+
+    if (!net->head || !net->level || !net->stamp || !net->cur || !net->queue || !net->path ||
+        !net->next || !net->to || !net->cap || !net->orig_cap || !net->dirty || !net->dirty_mark)
+    {
+        flow_network_destroy(net);
+        return NULL;
+    }
+    for (int v = 0; v < node_count; v++)
+        net->head[v] = -1;
+    return net;
+}
+
+static bool grow_arcs(FlowNetwork *net)
+{
+    int capacity = 2 * net->arc_capacity;
+    int *next = realloc(net->next, capacity * sizeof(int));
+    if (next)
+        net->next = next;
+    int *to = realloc(net->to, capacity * sizeof(int));
+    if (to)
+        net->to = to;
+    int *cap = realloc(net->cap, capacity * sizeof(int));
+    if (cap)
+        net->cap = cap;
+    int *orig_cap = realloc(net->orig_cap, capacity * sizeof(int));
+    if (orig_cap)
+        net->orig_cap = orig_cap;
+    int *dirty = realloc(net->dirty, (capacity / 2) * sizeof(int));
+    if (dirty)
+        net->dirty = dirty;
+    bool *dirty_mark = realloc(net->dirty_mark, (capacity / 2) * sizeof(bool));
+    if (dirty_mark)
+        net->dirty_mark = dirty_mark;
+    if (!next || !to || !cap || !orig_cap || !dirty || !dirty_mark)
+        return false;
+
+    memset(net->dirty_mark + net->arc_capacity / 2, 0, (capacity - net->arc_capacity) / 2 * sizeof(bool));
+    net->arc_capacity = capacity;
+    return true;
+}
+
+static void push_arc(FlowNetwork *net, int u, int v, int capacity)
+{
+    int a = net->arc_count++;
+    net->to[a] = v;
+    net->cap[a] = capacity;
+    net->orig_cap[a] = capacity;
+    net->next[a] = net->head[u];
+    net->head[u] = a;
+}
+
+int flow_network_add_arc(FlowNetwork *net, int u, int v, int capacity)
+{
+    if (net->arc_count + 2 > net->arc_capacity && !grow_arcs(net))
+        return -1;
+    int a = net->arc_count;
+    push_arc(net, u, v, capacity);
+    push_arc(net, v, u, 0);
+    return a;
+}
+
+/* ========================================================================
+ * DINIC PHASES
+ * ========================================================================*/
+
+static void next_generation(FlowNetwork *net)
+{
+    if (net->generation == INT_MAX)
+    {
+        memset(net->stamp, 0, (net->node_count > 0 ? net->node_count : 1) * sizeof(int));
+        net->generation = 0;
+    }
+    net->generation++;
+}
+
+/**
+ * @brief Builds the level graph, stopping as soon as the sink is labelled
+ *
+ * Nodes that were not reached yet keep a stale stamp and are ignored by the
+ * blocking flow; a phase may then push less than a full blocking flow, but
+ * every phase still augments along shortest paths.
+ *
+ * @return true if the sink is reachable in the residual network
+ */
+static bool build_levels(FlowNetwork *net, int source, int sink)
+{
+    next_generation(net);
+    int gen = net->generation;
+    int qh = 0, qt = 0;
+
+    net->stamp[source] = gen;
+    net->level[source] = 0;
+    net->cur[source] = net->head[source];
+    net->queue[qt++] = source;
+
+    while (qh < qt)
+    {
+        int v = net->queue[qh++];
+        for (int a = net->head[v]; a != -1; a = net->next[a])
+        {
+            int w = net->to[a];
+            if (net->cap[a] > 0 && net->stamp[w] != gen)
+            {
+                net->stamp[w] = gen;
+                net->level[w] = net->level[v] + 1;
+                net->cur[w] = net->head[w];
+                net->queue[qt++] = w;
+                if (w == sink)
+                    return true; // Levels found so far are exact; stop exploring
+            }
+        }
+    }
+    return net->stamp[sink] == gen;
+}
+
+static void mark_dirty(FlowNetwork *net, int a)
+{
+    int pair = a >> 1;
+    if (!net->dirty_mark[pair])
+    {
+        net->dirty_mark[pair] = true;
+        net->dirty[net->dirty_count++] = pair;
+    }
+}
+
+/**
+ * @brief Pushes a blocking flow of at most need units along the level graph
+ */
+static int blocking_flow(FlowNetwork *net, int source, int sink, int need)
+{
+    int gen = net->generation;
+    int pushed = 0;
+    int depth = 0;
+    int v = source;
+
+    while (pushed < need)
+    {
+        if (v == sink)
+        {
+            int b = need - pushed;
+            for (int k = 0; k < depth; k++)
+                if (net->cap[net->path[k]] < b)
+                    b = net->cap[net->path[k]];
+            for (int k = 0; k < depth; k++)
+            {
+                int a = net->path[k];
+                mark_dirty(net, a);
+                net->cap[a] -= b;
+                net->cap[a ^ 1] += b;
+            }
+            pushed += b;
+
+            // Retreat to the tail of the first saturated arc
+            int k0 = 0;
+            while (k0 < depth && net->cap[net->path[k0]] > 0)
+                k0++;
+            depth = k0;
+            v = depth == 0 ? source : net->to[net->path[depth - 1]];
+            continue;
+        }
+
+        // Advance along the first admissible arc
+        int a = net->cur[v];
+        while (a != -1)
+        {
+            int w = net->to[a];
+            if (net->cap[a] > 0 && net->stamp[w] == gen && net->level[w] == net->level[v] + 1)
+                break;
+            a = net->next[a];
+        }
+        net->cur[v] = a;
+
+        if (a != -1)
+        {
+            net->path[depth++] = a;
+            v = net->to[a];
+        }
+        else
+        {
+            if (v == source)
+                break;
+            net->level[v] = -1; // Dead end for the rest of this phase
+            depth--;
+            v = depth == 0 ? source : net->to[net->path[depth - 1]];
+            net->cur[v] = net->next[net->cur[v]];
+        }
+    }
+    return pushed;
+}
+
+int flow_network_max_flow(FlowNetwork *net, int source, int sink, int limit)
+{
+    int flow = 0;
+    while (flow < limit && build_levels(net, source, sink))
+    {
+        int pushed = blocking_flow(net, source, sink, limit - flow);
+        if (pushed == 0)
+            break;
+        flow += pushed;
+    }
+    return flow;
+}
+
+/* ========================================================================
+ * CUTS AND RESET
+ * ========================================================================*/
+
+void flow_network_source_side(FlowNetwork *net, int source, bool *side)
+{
+    memset(side, 0, net->node_count * sizeof(bool));
+    int qh = 0, qt = 0;
+    side[source] = true;
+    net->queue[qt++] = source;
+    while (qh < qt)
+    {
+        int v = net->queue[qh++];
+        for (int a = net->head[v]; a != -1; a = net->next[a])
+        {
+            int w = net->to[a];
+            if (net->cap[a] > 0 && !side[w])
+            {
+                side[w] = true;
+                net->queue[qt++] = w;
+            }
+        }
+    }
+}
+
+void flow_network_reset(FlowNetwork *net)
+{
+    for (int i = 0; i < net->dirty_count; i++)
+    {
+        int pair = net->dirty[i];
+        net->cap[2 * pair] = net->orig_cap[2 * pair];
+        net->cap[2 * pair + 1] = net->orig_cap[2 * pair + 1];
+        net->dirty_mark[pair] = false;
+    }
+    net->dirty_count = 0;
+}
+
+void flow_network_destroy(FlowNetwork *net)
+{
+    if (!net)
+        return;
+    free(net->head);
+    free(net->next);
+    free(net->to);
+    free(net->cap);
+    free(net->orig_cap);
+    free(net->level);
+    free(net->stamp);
+    free(net->cur);
+    free(net->queue);
+    free(net->path);
+    free(net->dirty);
+    free(net->dirty_mark);
+    free(net);
+}
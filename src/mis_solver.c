@@ -0,0 +1,1125 @@
+/**
+ * @file mis_solver.c
+ * @brief Kernelization and branch-and-reduce for maximum independent set
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * The kernel works on mutable neighbor lists: removed vertices are only
+ * flagged dead and filtered out of a list the next time it is scanned, and
+ * folds append new vertex slots. Every decision that fixes vertices is
+ * logged (take v, or fold v / u / w into x) so the kernel solution can be
+ * lifted back by replaying the log in reverse.
+ *
+ * The search then runs on a static sorted CSR copy of each kernel
+ * component, where removals are undone from a trail.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "mis_solver.h"
+#include "clique.h"
+#include "csr_graph.h"
+#include "matching.h"
+#include "set_utils.h"
+#include "graph_stats.h"
+
+/* ========================================================================
+ * KERNEL GRAPH
+ * ========================================================================*/
+
+typedef enum
+{
+    RECORD_TAKE,   // v is in the set
+    RECORD_FOLD    // x replaced v, u, w: x in the set → u, w; otherwise v
+} RecordType;
+
+typedef struct
+{
+    RecordType type;
+    int v;
+    int u;
+    int w;
+    int x;
+} Record;
+
+typedef struct
+{
+    int capacity;        // Vertex slots: original vertices plus one per fold
+    int count;           // Slots in use
+    int **adj;           // Neighbor lists; may hold dead vertices until compacted
+    int *len;
+    int *cap;
+    int *deg;            // Alive neighbors
+    bool *alive;
+    int *work;           // Vertices whose degree changed since they were last checked
+    int work_len;
+    bool *queued;
+    int *mark;           // Stamps for neighborhood tests
+    int *mark_set;       // Unconfined test: stamp of the members of S
+    int *hits;           // Unconfined test: |N(u) ∩ S| for u ∈ N(S)
+    int *frontier;       // Unconfined test: N(S) \ S
+    int stamp;
+    Record *records;
+    int record_count;
+    int record_capacity;
+    MatchingWorkspace *matching; // Double cover matchings of the LP rounds
+    bool failed;         // An allocation failed; the kernel must not be used
+} Kernel;
+
+static void kernel_push(Kernel *k, int v)
+{
+    if (!k->queued[v])
+    {
+        k->queued[v] = true;
+        k->work[k->work_len++] = v;
+    }
+}
+
+static int kernel_next_stamp(Kernel *k)
+{
+    if (k->stamp == INT_MAX)
+    {
+        memset(k->mark, 0, k->capacity * sizeof(int));
+        memset(k->mark_set, 0, k->capacity * sizeof(int));
+        k->stamp = 0;
+    }
+    return ++k->stamp;
+}
+
+/**
+ * @brief Drops dead vertices from the list of v
+ *
+ * @return Length of the list, now equal to deg[v]
+ */
+static int kernel_compact(Kernel *k, int v)
+{
+    int *list = k->adj[v];
+    int kept = 0;
+    for (int i = 0; i < k->len[v]; i++)
+        if (k->alive[list[i]])
+            list[kept++] = list[i];
+    k->len[v] = kept;
+    return kept;
+}
+
+static void kernel_record(Kernel *k, Record record)
+{
+    if (k->record_count == k->record_capacity)
+    {
+        int capacity = k->record_capacity ? 2 * k->record_capacity : 64;
+        Record *grown = realloc(k->records, capacity * sizeof(Record));
+        if (!grown)
+        {
+            k->failed = true;
+            return;
+        }
+        k->records = grown;
+        k->record_capacity = capacity;
+    }
+    k->records[k->record_count++] = record;
+}
+
+static void kernel_remove(Kernel *k, int v)
+{
+    k->alive[v] = false;
+    for (int i = 0; i < k->len[v]; i++)
+    {
+        int y = k->adj[v][i];
+        if (k->alive[y])
+        {
+            k->deg[y]--;
+            kernel_push(k, y);
+        }
+    }
+}
+
+/**
+ * @brief Puts v into the set and deletes N[v]
+ */
+static void kernel_take(Kernel *k, int v)
+{
+    kernel_record(k, (Record){RECORD_TAKE, v, -1, -1, -1});
+    kernel_compact(k, v);
+    for (int i = 0; i < k->len[v]; i++)
+        kernel_remove(k, k->adj[v][i]);
+    kernel_remove(k, v);
+}
+
+static bool kernel_adjacent(Kernel *k, int u, int w)
+{
+    if (k->deg[u] > k->deg[w])
+    {
+        int t = u;
+        u = w;
+        w = t;
+    }
+    kernel_compact(k, u);
+    for (int i = 0; i < k->len[u]; i++)
+        if (k->adj[u][i] == w)
+            return true;
+    return false;
+}
+
+/**
+ * @brief Folds degree-2 vertex v with non-adjacent neighbors u, w into a new vertex
+ */
+static void kernel_fold(Kernel *k, int v, int u, int w)
+{
+    kernel_compact(k, u);
+    kernel_compact(k, w);
+    int *list = malloc((k->len[u] + k->len[w] > 0 ? k->len[u] + k->len[w] : 1) * sizeof(int));
+    if (!list)
+    {
+        k->failed = true;
+        return;
+    }
+
+    // N(x) = N(u) ∪ N(w) \ {v}
+    int s = kernel_next_stamp(k);
+    int size = 0;
+    k->mark[v] = s;
+    for (int side = 0; side < 2; side++)
+    {
+        int z = side == 0 ? u : w;
+        for (int i = 0; i < k->len[z]; i++)
+        {
+            int y = k->adj[z][i];
+            if (k->mark[y] != s)
+            {
+                k->mark[y] = s;
+                list[size++] = y;
+            }
+        }
+    }
+
+    kernel_remove(k, v);
+    kernel_remove(k, u);
+    kernel_remove(k, w);
+
+    int x = k->count++;
+    for (int i = 0; i < size; i++)
+    {
+        int y = list[i];
+        if (k->len[y] == k->cap[y])
+        {
+            int capacity = 2 * k->cap[y] + 1;
+            int *grown = realloc(k->adj[y], capacity * sizeof(int));
+            if (!grown)
+            {
+                k->failed = true;
+                free(list);
+                return;
+            }
+            k->adj[y] = grown;
+            k->cap[y] = capacity;
+        }
+        k->adj[y][k->len[y]++] = x;
+        k->deg[y]++;
+        kernel_push(k, y);
+    }
+    k->adj[x] = list;
+    k->len[x] = k->cap[x] = k->deg[x] = size;
+    k->alive[x] = true;
+    kernel_push(k, x);
+    kernel_record(k, (Record){RECORD_FOLD, v, u, w, x});
+}
+
+static bool kernel_init(Kernel *k, const CSRGraph *csr)
+{
+    int n = csr->node_count;
+    memset(k, 0, sizeof(Kernel));
+    // Every fold removes three vertices and adds one, so at most n / 2 folds happen
+    k->capacity = n + n / 2 + 1;
+    k->adj = calloc(k->capacity, sizeof(int *));
+    k->len = calloc(k->capacity, sizeof(int));
+    k->cap = calloc(k->capacity, sizeof(int));
+    k->deg = calloc(k->capacity, sizeof(int));
+    k->alive = calloc(k->capacity, sizeof(bool));
+    k->work = malloc(k->capacity * sizeof(int));
+    k->queued = calloc(k->capacity, sizeof(bool));
+    k->mark = calloc(k->capacity, sizeof(int));
+    k->mark_set = calloc(k->capacity, sizeof(int));
+    k->hits = malloc(k->capacity * sizeof(int));
+    k->frontier = malloc(k->capacity * sizeof(int));
+    k->matching = matching_workspace_create();
+    k->count = n;
+    if (!k->adj || !k->len || !k->cap || !k->deg || !k->alive || !k->work || !k->queued || !k->mark
+        || !k->mark_set || !k->hits || !k->frontier || !k->matching)
+        return false;
+
+    for (int v = 0; v < n; v++)
+    {
+        int degree = csr_degree(csr, v);
+        k->adj[v] = malloc((degree > 0 ? degree : 1) * sizeof(int));
+        if (!k->adj[v])
+            return false;
+        for (int e = csr->offsets[v]; e < csr->offsets[v + 1]; e++)
+            if (csr->neighbors[e] != v)
+                k->adj[v][k->len[v]++] = csr->neighbors[e];
+        k->cap[v] = degree;
+        k->deg[v] = k->len[v];
+        k->alive[v] = true;
+        kernel_push(k, v);
+    }
+    return true;
+}
+
+static void kernel_release(Kernel *k)
+{
+    if (k->adj)
+    {
+        for (int v = 0; v < k->count; v++)
+            free(k->adj[v]);
+    }
+    free(k->adj);
+    free(k->len);
+    free(k->cap);
+    free(k->deg);
+    free(k->alive);
+    free(k->work);
+    free(k->queued);
+    free(k->mark);
+    free(k->mark_set);
+    free(k->hits);
+    free(k->frontier);
+    free(k->records);
+    matching_workspace_destroy(k->matching);
+}
+
+/* ========================================================================
+ * REDUCTION RULES
+ * ========================================================================*/
+
+/**
+ * @brief Applies the degree 0 / 1 / 2 rules to every queued vertex
+ */
+static void reduce_low_degree(Kernel *k)
+{
+    while (k->work_len > 0 && !k->failed)
+    {
+        int v = k->work[--k->work_len];
+        k->queued[v] = false;
+        if (!k->alive[v])
+            continue;
+
+        if (k->deg[v] <= 1)
+        {
+            kernel_take(k, v);
+        }
+        else if (k->deg[v] == 2)
+        {
+            kernel_compact(k, v);
+            int u = k->adj[v][0], w = k->adj[v][1];
+            if (kernel_adjacent(k, u, w))
+                kernel_take(k, v); // Simplicial: N[v] is a triangle
+            else
+                kernel_fold(k, v, u, w);
+        }
+    }
+}
+
+/**
+ * @brief Adds x (outside N[S]) to S and extends the frontier N(S) \ S
+ */
+static void unconfined_add(Kernel *k, int x, int s, int *frontier_len)
+{
+    k->mark_set[x] = s;
+    k->mark[x] = s;
+    kernel_compact(k, x);
+    for (int i = 0; i < k->len[x]; i++)
+    {
+        int y = k->adj[x][i];
+        if (k->mark[y] != s)
+        {
+            k->mark[y] = s;
+            k->hits[y] = 0;
+            k->frontier[(*frontier_len)++] = y;
+        }
+        k->hits[y]++;
+    }
+}
+
+/**
+ * @brief Tests whether v is unconfined (Xiao-Nagamochi), so some MIS avoids v
+ *
+ * Grows S = {v}: while some u ∈ N(S) has exactly one neighbor in S and at
+ * most one neighbor w outside N[S], either v is unconfined (no such w) or
+ * w joins S. The rule subsumes dominance: a neighbor u with N[u] ⊆ N[v]
+ * already has no neighbor outside N[{v}].
+ */
+static bool kernel_unconfined(Kernel *k, int v)
+{
+    int s = kernel_next_stamp(k);
+    int frontier_len = 0;
+    unconfined_add(k, v, s, &frontier_len);
+
+    for (;;)
+    {
+        int best_outside = 2, best_w = -1;
+        for (int f = 0; f < frontier_len && best_outside > 0; f++)
+        {
+            int u = k->frontier[f];
+            if (k->mark_set[u] == s || k->hits[u] != 1)
+                continue;
+            kernel_compact(k, u);
+            int outside = 0, w = -1;
+            for (int i = 0; i < k->len[u] && outside < 2; i++)
+            {
+                if (k->mark[k->adj[u][i]] != s)
+                {
+                    outside++;
+                    w = k->adj[u][i];
+                }
+            }
+            if (outside < best_outside)
+            {
+                best_outside = outside;
+                best_w = w;
+            }
+        }
+        if (best_outside == 0)
+            return true;
+        if (best_outside > 1)
+            return false;
+        unconfined_add(k, best_w, s, &frontier_len);
+    }
+}
+
+/**
+ * @brief Removes every unconfined vertex
+ *
+ * @return true if a vertex was removed
+ */
+static bool reduce_unconfined(Kernel *k)
+{
+    bool changed = false;
+    for (int v = 0; v < k->count && !k->failed; v++)
+    {
+        if (k->alive[v] && kernel_unconfined(k, v))
+        {
+            kernel_remove(k, v);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+/**
+ * @brief Nemhauser-Trotter LP reduction (crown reduction)
+ *
+ * König's theorem turns the double cover matching into a minimum vertex
+ * cover C of the double cover; x_v = (|{v_L, v_R} ∩ C|) / 2 is then an
+ * optimal half-integral solution of the vertex cover LP, and some maximum
+ * independent set contains every vertex with x_v = 0 and none with x_v = 1.
+ *
+ * @return true if a vertex was fixed
+ */
+static bool reduce_lp(Kernel *k)
+{
+    int *id = malloc(k->count * sizeof(int));
+    int *vertex = malloc(k->count * sizeof(int));
+    int n = 0, arcs = 0;
+    if (!id || !vertex)
+    {
+        free(id);
+        free(vertex);
+        k->failed = true;
+        return false;
+    }
+    for (int v = 0; v < k->count; v++)
+    {
+        id[v] = -1;
+        if (k->alive[v])
+        {
+            id[v] = n;
+            vertex[n++] = v;
+            arcs += kernel_compact(k, v);
+        }
+    }
+
+    int *offsets = malloc((n + 1) * sizeof(int));
+    int *neighbors = malloc((arcs > 0 ? arcs : 1) * sizeof(int));
+    bool *cover_left = malloc((n > 0 ? n : 1) * sizeof(bool));
+    bool *cover_right = malloc((n > 0 ? n : 1) * sizeof(bool));
+    bool ok = offsets && neighbors && cover_left && cover_right;
+    bool changed = false;
+
+    if (ok)
+    {
+        offsets[0] = 0;
+        for (int i = 0; i < n; i++)
+        {
+            int v = vertex[i];
+            offsets[i + 1] = offsets[i];
+            for (int j = 0; j < k->len[v]; j++)
+                neighbors[offsets[i + 1]++] = id[k->adj[v][j]];
+        }
+        // Left vertex i is joined to right vertex j for every edge {i, j}
+        ok = matching_maximum(k->matching, n, n, offsets, neighbors, MATCHING_INIT_KARP_SIPSER) >= 0;
+    }
+    if (ok)
+    {
+        // x_v = 0 iff neither v_L nor v_R is in the König cover, x_v = 1 iff both are
+        matching_konig_cover(k->matching, offsets, neighbors, cover_left, cover_right);
+        for (int i = 0; i < n; i++)
+        {
+            if (!cover_left[i] && !cover_right[i] && k->alive[vertex[i]])
+            {
+                kernel_take(k, vertex[i]);
+                changed = true;
+            }
+        }
+        for (int i = 0; i < n; i++)
+        {
+            if (cover_left[i] && cover_right[i] && k->alive[vertex[i]])
+            {
+                kernel_remove(k, vertex[i]);
+                changed = true;
+            }
+        }
+    }
+    else
+    {
+        k->failed = true;
+    }
+
+    free(id);
+    free(vertex);
+    free(offsets);
+    free(neighbors);
+    free(cover_left);
+    free(cover_right);
+    return changed;
+}
+
+/**
+ * @brief Applies all rules until none of them changes the graph
+ */
+static void kernelize(Kernel *k)
+{
+    for (;;)
+    {
+        reduce_low_degree(k);
+        if (k->failed)
+            return;
+        if (reduce_unconfined(k))
+            continue;
+        if (k->failed || !reduce_lp(k))
+            return;
+    }
+}
+
+/* ========================================================================
+ * BRANCH-AND-REDUCE
+ * ========================================================================*/
+
+typedef struct
+{
+    int n;
+    const int *offsets;  // Sorted CSR rows of one kernel component
+    const int *neighbors;
+    bool *alive;
+    int *deg;            // Alive neighbors
+    int *trail;          // Removed vertices in removal order
+    int trail_len;
+    int *clique_of;      // Clique cover scratch
+    int *clique_size;
+    int *hits;
+    int *touched;
+    int *seen;           // Component split scratch (stamps)
+    int stamp;
+    long long branches;
+} Search;
+
+/**
+ * @brief One independent subproblem: the graph induced by the alive vertices of a list
+ *
+ * Components found during the search become subproblems of their own, so
+ * their optima add up instead of multiplying the branching.
+ */
+typedef struct
+{
+    const int *vertices; // May include dead vertices, which are skipped
+    int count;
+    int *chosen;         // Current independent set
+    int chosen_len;
+    int *best;           // Largest independent set found
+    int best_len;
+} Subproblem;
+
+static void search_remove(Search *s, int v)
+{
+    s->alive[v] = false;
+    s->trail[s->trail_len++] = v;
+    for (int e = s->offsets[v]; e < s->offsets[v + 1]; e++)
+        if (s->alive[s->neighbors[e]])
+            s->deg[s->neighbors[e]]--;
+}
+
+/**
+ * @brief Restores removed vertices until the trail has the given length
+ *
+ * Vertices come back in reverse removal order, so each sees the same alive
+ * neighbors as when it was removed.
+ */
+static void search_undo(Search *s, int trail_len)
+{
+    while (s->trail_len > trail_len)
+    {
+        int v = s->trail[--s->trail_len];
+        s->alive[v] = true;
+        for (int e = s->offsets[v]; e < s->offsets[v + 1]; e++)
+            if (s->alive[s->neighbors[e]])
+                s->deg[s->neighbors[e]]++;
+    }
+}
+
+static void search_take(Search *s, Subproblem *sub, int v)
+{
+    sub->chosen[sub->chosen_len++] = v;
+    for (int e = s->offsets[v]; e < s->offsets[v + 1]; e++)
+        if (s->alive[s->neighbors[e]])
+            search_remove(s, s->neighbors[e]);
+    search_remove(s, v);
+}
+
+static bool search_adjacent(const Search *s, int u, int v)
+{
+    int lo = s->offsets[u], hi = s->offsets[u + 1] - 1;
+    while (lo <= hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (s->neighbors[mid] == v)
+            return true;
+        if (s->neighbors[mid] < v)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
+    }
+    return false;
+}
+
+/**
+ * @brief Degree 0 / 1 and simplicial degree-2 rules on the current subgraph
+ *
+ * @return Number of vertices still alive afterwards
+ */
+static int search_reduce(Search *s, Subproblem *sub)
+{
+    bool changed = true;
+    int alive = 0;
+    while (changed)
+    {
+        changed = false;
+        alive = 0;
+        for (int i = 0; i < sub->count; i++)
+        {
+            int v = sub->vertices[i];
+            if (!s->alive[v])
+                continue;
+            if (s->deg[v] <= 1)
+            {
+                search_take(s, sub, v);
+                changed = true;
+            }
+            else if (s->deg[v] == 2)
+            {
+                int pair[2], found = 0;
+                for (int e = s->offsets[v]; found < 2; e++)
+                    if (s->alive[s->neighbors[e]])
+                        pair[found++] = s->neighbors[e];
+                if (search_adjacent(s, pair[0], pair[1]))
+                {
+                    search_take(s, sub, v);
+                    changed = true;
+                }
+                else
+                {
+                    alive++;
+                }
+            }
+            else
+            {
+                alive++;
+            }
+        }
+    }
+    return alive;
+}
+
+/**
+ * @brief Greedy clique cover of the alive vertices
+ *
+ * An independent set meets every clique at most once, so the number of
+ * cliques bounds α of the remaining graph from above.
+ */
+static int search_clique_cover(Search *s, const Subproblem *sub)
+{
+    int cliques = 0;
+    for (int i = 0; i < sub->count; i++)
+        s->clique_of[sub->vertices[i]] = -1;
+    for (int i = 0; i < sub->count; i++)
+    {
+        int v = sub->vertices[i];
+        if (!s->alive[v])
+            continue;
+        int touched = 0;
+        for (int e = s->offsets[v]; e < s->offsets[v + 1]; e++)
+        {
+            int u = s->neighbors[e];
+            if (!s->alive[u] || s->clique_of[u] < 0)
+                continue;
+            int c = s->clique_of[u];
+            if (s->hits[c]++ == 0)
+                s->touched[touched++] = c;
+        }
+        // Join the largest clique that v is fully adjacent to
+        int best = -1;
+        for (int t = 0; t < touched; t++)
+        {
+            int c = s->touched[t];
+            if (s->hits[c] == s->clique_size[c] && (best < 0 || s->clique_size[c] > s->clique_size[best]))
+                best = c;
+            s->hits[c] = 0;
+        }
+        if (best < 0)
+        {
+            best = cliques++;
+            s->clique_size[best] = 0;
+        }
+        s->clique_of[v] = best;
+        s->clique_size[best]++;
+    }
+    return cliques;
+}
+
+static void search_record(Subproblem *sub, const int *extra, int extra_len)
+{
+    if (sub->chosen_len + extra_len > sub->best_len)
+    {
+        memcpy(sub->best, sub->chosen, sub->chosen_len * sizeof(int));
+        if (extra_len > 0)
+            memcpy(sub->best + sub->chosen_len, extra, extra_len * sizeof(int));
+        sub->best_len = sub->chosen_len + extra_len;
+    }
+}
+
+static int search_solve(Search *s, const int *vertices, int count, int *out, bool *ok);
+
+/**
+ * @brief Solves the components of the alive subgraph separately if there are several
+ *
+ * @param alive Number of alive vertices in sub
+ * @return true if the subgraph was split (and the result recorded)
+ */
+static bool search_split(Search *s, Subproblem *sub, int alive, bool *ok)
+{
+    int *members = malloc(alive * sizeof(int));
+    if (!members)
+    {
+        *ok = false;
+        return false;
+    }
+
+    /* BFS from the first alive vertex; a full sweep means one component */
+    int stamp = ++s->stamp;
+    int size = 0, components = 0;
+    int *starts = NULL;
+    for (int i = 0; i < sub->count && size < alive; i++)
+    {
+        int root = sub->vertices[i];
+        if (!s->alive[root] || s->seen[root] == stamp)
+            continue;
+        if (components == 1 && !starts)
+        {
+            starts = malloc((alive + 1) * sizeof(int));
+            if (!starts)
+            {
+                free(members);
+                *ok = false;
+                return false;
+            }
+            starts[0] = 0;
+        }
+        if (starts)
+            starts[components] = size;
+        components++;
+
+        s->seen[root] = stamp;
+        members[size++] = root;
+        for (int head = size - 1; head < size; head++)
+        {
+            int v = members[head];
+            for (int e = s->offsets[v]; e < s->offsets[v + 1]; e++)
+            {
+                int u = s->neighbors[e];
+                if (s->alive[u] && s->seen[u] != stamp)
+                {
+                    s->seen[u] = stamp;
+                    members[size++] = u;
+                }
+            }
+        }
+        if (components == 1 && size == alive)
+            break;
+    }
+    if (components == 1)
+    {
+        free(members);
+        return false;
+    }
+    starts[components] = size;
+
+    int *solution = malloc(alive * sizeof(int));
+    int total = 0;
+    for (int c = 0; c < components && solution && *ok; c++)
+        total += search_solve(s, members + starts[c], starts[c + 1] - starts[c], solution + total, ok);
+    if (!solution)
+        *ok = false;
+    else if (*ok)
+        search_record(sub, solution, total);
+
+    free(solution);
+    free(starts);
+    free(members);
+    return true;
+}
+
+static void search_branch(Search *s, Subproblem *sub, bool *ok)
+{
+    int trail_mark = s->trail_len;
+    int chosen_mark = sub->chosen_len;
+    int alive = search_reduce(s, sub);
+
+    if (alive == 0)
+    {
+        search_record(sub, NULL, 0);
+    }
+    else if (sub->chosen_len + alive > sub->best_len
+             && sub->chosen_len + search_clique_cover(s, sub) > sub->best_len
+             && !search_split(s, sub, alive, ok) && *ok)
+    {
+        int v = -1;
+        for (int i = 0; i < sub->count; i++)
+        {
+            int u = sub->vertices[i];
+            if (s->alive[u] && (v < 0 || s->deg[u] > s->deg[v]))
+                v = u;
+        }
+        s->branches++;
+
+        int before = s->trail_len;
+        search_take(s, sub, v);
+        search_branch(s, sub, ok);
+        search_undo(s, before);
+        sub->chosen_len--;
+
+        search_remove(s, v);
+        search_branch(s, sub, ok);
+        search_undo(s, before);
+    }
+
+    search_undo(s, trail_mark);
+    sub->chosen_len = chosen_mark;
+}
+
+/**
+ * @brief Exact MIS of the graph induced by the alive vertices of a list
+ *
+ * Starts from a greedy incumbent (vertices by increasing degree) and leaves
+ * the alive state as it found it.
+ *
+ * @param out Receives the independent set (at most count vertices)
+ * @param ok Cleared on allocation failure
+ * @return Size of the independent set written to out
+ */
+static int search_solve(Search *s, const int *vertices, int count, int *out, bool *ok)
+{
+    Subproblem sub = {vertices, count, malloc(count * sizeof(int)), 0, malloc(count * sizeof(int)), 0};
+    int *order = malloc(count * sizeof(int));
+    int *bucket = calloc(count + 1, sizeof(int));
+    if (!sub.chosen || !sub.best || !order || !bucket)
+    {
+        *ok = false;
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+            bucket[s->deg[vertices[i]] < count ? s->deg[vertices[i]] + 1 : count]++;
+        for (int d = 0; d < count; d++)
+            bucket[d + 1] += bucket[d];
+        for (int i = 0; i < count; i++)
+        {
+            int d = s->deg[vertices[i]] < count ? s->deg[vertices[i]] : count - 1;
+            order[bucket[d]++] = vertices[i];
+        }
+
+        int trail_mark = s->trail_len;
+        for (int i = 0; i < count; i++)
+            if (s->alive[order[i]])
+                search_take(s, &sub, order[i]);
+        search_record(&sub, NULL, 0);
+        search_undo(s, trail_mark);
+        sub.chosen_len = 0;
+
+        search_branch(s, &sub, ok);
+        memcpy(out, sub.best, sub.best_len * sizeof(int));
+    }
+
+    int result = *ok ? sub.best_len : 0;
+    free(sub.chosen);
+    free(sub.best);
+    free(order);
+    free(bucket);
+    return result;
+}
+
+/**
+ * @brief Exact MIS of one component; writes the chosen local vertices to in_set
+ *
+ * @return false on allocation failure
+ */
+static bool solve_component(int n, const int *offsets, const int *neighbors, bool *in_set, long long *branches)
+{
+    Search s;
+    memset(&s, 0, sizeof(Search));
+    s.n = n;
+    s.offsets = offsets;
+    s.neighbors = neighbors;
+    s.alive = malloc(n * sizeof(bool));
+    s.deg = malloc(n * sizeof(int));
+    s.trail = malloc(n * sizeof(int));
+    s.clique_of = malloc(n * sizeof(int));
+    s.clique_size = malloc(n * sizeof(int));
+    s.hits = calloc(n, sizeof(int));
+    s.touched = malloc(n * sizeof(int));
+    s.seen = calloc(n, sizeof(int));
+    int *vertices = malloc(n * sizeof(int));
+    int *best = malloc(n * sizeof(int));
+    bool ok = s.alive && s.deg && s.trail && s.clique_of && s.clique_size && s.hits && s.touched && s.seen
+              && vertices && best;
+
+    if (ok)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            s.alive[v] = true;
+            s.deg[v] = offsets[v + 1] - offsets[v];
+            vertices[v] = v;
+        }
+        int size = search_solve(&s, vertices, n, best, &ok);
+        for (int i = 0; ok && i < size; i++)
+            in_set[best[i]] = true;
+        *branches += s.branches;
+        GRAPH_STAT_ADD(GRAPH_STAT_MIS_BRANCHES, s.branches);
+    }
+
+    free(s.alive);
+    free(s.deg);
+    free(s.trail);
+    free(s.clique_of);
+    free(s.clique_size);
+    free(s.hits);
+    free(s.touched);
+    free(s.seen);
+    free(vertices);
+    free(best);
+    return ok;
+}
+
+/**
+ * @brief Exact MIS of a dense component with the bitset clique search on its complement
+ *
+ * @return false on allocation failure
+ */
+static bool solve_dense_component(int n, int *offsets, int *neighbors, int arcs, bool *in_set)
+{
+    // Borrow the component rows as a CSR-only graph; nothing here owns them
+    CSRGraph csr = {0};
+    csr.node_count = n;
+    csr.edge_count = arcs / 2;
+    csr.offsets = offsets;
+    csr.neighbors = neighbors;
+    Graph graph = {0};
+    graph.node_count = n;
+    graph.csr = &csr;
+
+    Set *mis = find_maximum_clique_complement(&graph);
+    if (!mis)
+        return false;
+    for (int i = 0; i < mis->size; i++)
+        in_set[mis->vertices[i]] = true;
+    set_destroy(mis);
+    return true;
+}
+
+static int compare_ints(const void *a, const void *b)
+{
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Solves every connected component of the kernel and marks the chosen slots
+ */
+static bool solve_kernel(Kernel *k, bool *in_set, MisStats *stats)
+{
+    int slots = k->count;
+    int *local = malloc((slots > 0 ? slots : 1) * sizeof(int));
+    int *members = malloc((slots > 0 ? slots : 1) * sizeof(int));
+    bool *seen = calloc(slots > 0 ? slots : 1, sizeof(bool));
+    bool ok = local && members && seen;
+
+    for (int root = 0; ok && root < slots; root++)
+    {
+        if (!k->alive[root] || seen[root])
+            continue;
+
+        /* Collect the component, then number it in slot order so rows stay sorted */
+        int size = 0, arcs = 0;
+        seen[root] = true;
+        members[size++] = root;
+        for (int head = 0; head < size; head++)
+        {
+            int v = members[head];
+            arcs += kernel_compact(k, v);
+            for (int i = 0; i < k->len[v]; i++)
+            {
+                int y = k->adj[v][i];
+                if (!seen[y])
+                {
+                    seen[y] = true;
+                    members[size++] = y;
+                }
+            }
+        }
+        qsort(members, size, sizeof(int), compare_ints);
+        for (int i = 0; i < size; i++)
+            local[members[i]] = i;
+
+        int *offsets = malloc((size + 1) * sizeof(int));
+        int *neighbors = malloc((arcs > 0 ? arcs : 1) * sizeof(int));
+        bool *chosen = calloc(size, sizeof(bool));
+        ok = offsets && neighbors && chosen;
+        if (ok)
+        {
+            offsets[0] = 0;
+            for (int i = 0; i < size; i++)
+            {
+                int v = members[i];
+                int begin = offsets[i];
+                for (int j = 0; j < k->len[v]; j++)
+                    neighbors[begin + j] = local[k->adj[v][j]];
+                qsort(neighbors + begin, k->len[v], sizeof(int), compare_ints);
+                offsets[i + 1] = begin + k->len[v];
+            }
+            if (arcs >= MIS_SOLVER_CLIQUE_MIN_DEGREE * size)
+                ok = solve_dense_component(size, offsets, neighbors, arcs, chosen);
+            else
+                ok = solve_component(size, offsets, neighbors, chosen, &stats->branches);
+            for (int i = 0; ok && i < size; i++)
+                in_set[members[i]] = chosen[i];
+        }
+        free(offsets);
+        free(neighbors);
+        free(chosen);
+
+        stats->kernel_vertices += size;
+        stats->kernel_edges += arcs / 2;
+        stats->components++;
+    }
+
+    free(local);
+    free(members);
+    free(seen);
+    return ok;
+}
+
+/* ========================================================================
+ * PUBLIC API
+ * ========================================================================*/
+
+Set *mis_branch_reduce(Graph *graph, MisStats *stats)
+{
+    MisStats local_stats;
+    if (!stats)
+        stats = &local_stats;
+    memset(stats, 0, sizeof(MisStats));
+    if (!graph || graph->is_directed)
+        return NULL;
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return NULL;
+
+    Kernel k;
+    bool ok = kernel_init(&k, csr);
+    if (ok)
+    {
+        kernelize(&k);
+        ok = !k.failed;
+    }
+
+    bool *in_set = ok ? calloc(k.capacity, sizeof(bool)) : NULL;
+    ok = in_set && solve_kernel(&k, in_set, stats);
+
+    Set *result = NULL;
+    if (ok)
+    {
+        /* Lift the kernel solution back through the log, newest decision first */
+        for (int r = k.record_count - 1; r >= 0; r--)
+        {
+            const Record *record = &k.records[r];
+            if (record->type == RECORD_TAKE)
+            {
+                in_set[record->v] = true;
+            }
+            else if (in_set[record->x])
+            {
+                in_set[record->u] = true;
+                in_set[record->w] = true;
+            }
+            else
+            {
+                in_set[record->v] = true;
+            }
+        }
+
+        int n = csr->node_count;
+        result = set_create(n > 0 ? n : 1);
+        for (int v = 0; v < n; v++)
+            if (in_set[v])
+                set_add(result, v);
+    }
+
+    free(in_set);
+    kernel_release(&k);
+    return result;
+}
+
+Set *vertex_cover_branch_reduce(Graph *graph, MisStats *stats)
+{
+    Set *mis = mis_branch_reduce(graph, stats);
+    if (!mis)
+        return NULL;
+
+    int n = graph->node_count;
+    bool *in_mis = calloc(n > 0 ? n : 1, sizeof(bool));
+    if (!in_mis)
+    {
+        set_destroy(mis);
+        return NULL;
+    }
+    for (int i = 0; i < mis->size; i++)
+        in_mis[mis->vertices[i]] = true;
+
+    Set *cover = set_create(n > 0 ? n : 1);
+    for (int v = 0; v < n; v++)
+        if (!in_mis[v])
+            set_add(cover, v);
+
+    free(in_mis);
+    set_destroy(mis);
+    return cover;
+}
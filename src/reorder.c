@@ -0,0 +1,362 @@
+/**
+ * @file reorder.c
+ * @brief Degree and Reverse Cuthill-McKee orders, graph relabelling
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Both orders work on the underlying undirected graph: a vertex's neighbors
+ * are its out-row followed by its in-row (digraphs only), and its degree is
+ * the length of both. Permutations map new labels to old ones
+ * (old = perm[new]); graph_reorder() inverts them into a rank array once.
+ */
+
+#include <stdint.h>
+
+#include "reorder.h"
+#include "csr_graph.h"
+
+bool vertex_order_parse(const char *name, VertexOrder *order_out)
+{
+    for (int order = VERTEX_ORDER_NONE; order <= VERTEX_ORDER_RCM; order++)
+    {
+        if (strcmp(name, vertex_order_name((VertexOrder)order)) == 0)
+        {
+            *order_out = (VertexOrder)order;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char *vertex_order_name(VertexOrder order)
+{
+    switch (order)
+    {
+    case VERTEX_ORDER_NONE:
+        return "none";
+    case VERTEX_ORDER_DEGREE:
+        return "degree";
+    case VERTEX_ORDER_RCM:
+        return "rcm";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Degree of v in the underlying undirected graph
+ */
+static inline int undirected_degree(const CSRGraph *csr, int v)
+{
+    return csr_degree(csr, v) + (csr->is_directed ? csr_in_degree(csr, v) : 0);
+}
+
+/* ========================================================================
+ * DEGREE ORDER
+ * ========================================================================*/
+
+/**
+ * @brief Decreasing degree, ties by label (counting sort)
+ */
+static int *degree_order(const CSRGraph *csr)
+{
+    int n = csr->node_count;
+    int max_degree = 0;
+    for (int v = 0; v < n; v++)
+        if (undirected_degree(csr, v) > max_degree)
+            max_degree = undirected_degree(csr, v);
+
+    int *perm = malloc((n > 0 ? n : 1) * sizeof(int));
+    int *start = calloc(max_degree + 2, sizeof(int));
+    if (!perm || !start)
+    {
+        free(perm);
+        free(start);
+        return NULL;
+    }
+
+    // start[d] = first slot of the degree-d vertices, highest degree first
+    for (int v = 0; v < n; v++)
+        start[undirected_degree(csr, v)]++;
+    int placed = 0;
+    for (int d = max_degree; d >= 0; d--)
+    {
+        int count = start[d];
+        start[d] = placed;
+        placed += count;
+    }
+    for (int v = 0; v < n; v++)
+        perm[start[undirected_degree(csr, v)]++] = v;
+
+    free(start);
+    return perm;
+}
+
+/* ========================================================================
+ * REVERSE CUTHILL-MCKEE
+ * ========================================================================*/
+
+typedef struct
+{
+    const CSRGraph *csr;
+    int *degree;     // Undirected degree of every vertex
+    int *mark;       // Stamp of the last level-structure BFS that reached the vertex
+    int *queue;      // Level-structure BFS queue
+    uint64_t *keys;  // (degree, vertex) keys of one vertex's new neighbors
+    int stamp;
+} RCMWorkspace;
+
+static int compare_keys(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/** Runs body with v bound to every neighbor of u in the underlying undirected graph */
+#define FOR_EACH_NEIGHBOR(csr, u, v, body)                                           \
+    do                                                                                \
+    {                                                                                 \
+        for (int k_ = (csr)->offsets[u]; k_ < (csr)->offsets[(u) + 1]; k_++)          \
+        {                                                                             \
+            int v = (csr)->neighbors[k_];                                             \
+            body;                                                                     \
+        }                                                                             \
+        for (int k_ = (csr)->is_directed ? (csr)->in_offsets[u] : 0;                  \
+             (csr)->is_directed && k_ < (csr)->in_offsets[(u) + 1]; k_++)             \
+        {                                                                             \
+            int v = (csr)->in_neighbors[k_];                                          \
+            body;                                                                     \
+        }                                                                             \
+    } while (0)
+
+/**
+ * @brief BFS level structure rooted at root
+ *
+ * Leaves the vertices of root's component in ws->queue, level by level.
+ *
+ * @param last_level_out Receives the queue index where the deepest level starts
+ * @param reached_out Receives the number of vertices reached
+ * @return Eccentricity of root (index of the deepest level)
+ */
+static int level_structure(RCMWorkspace *ws, int root, int *last_level_out, int *reached_out)
+{
+    const CSRGraph *csr = ws->csr;
+    int stamp = ++ws->stamp;
+    int head = 0, tail = 0, depth = 0;
+    ws->queue[tail++] = root;
+    ws->mark[root] = stamp;
+    int level_begin = 0;
+    while (head < tail)
+    {
+        int level_end = tail;
+        level_begin = head;
+        for (; head < level_end; head++)
+        {
+            int u = ws->queue[head];
+            FOR_EACH_NEIGHBOR(csr, u, v, {
+                if (ws->mark[v] != stamp)
+                {
+                    ws->mark[v] = stamp;
+                    ws->queue[tail++] = v;
+                }
+            });
+        }
+        if (tail > level_end)
+            depth++;
+    }
+    *last_level_out = level_begin;
+    *reached_out = tail;
+    return depth;
+}
+
+/**
+ * @brief George-Liu pseudo-peripheral vertex of start's component
+ *
+ * Moves to a minimum-degree vertex of the deepest BFS level while that
+ * increases the eccentricity.
+ */
+static int pseudo_peripheral_vertex(RCMWorkspace *ws, int start)
+{
+    int root = start, last_level, reached;
+    int eccentricity = level_structure(ws, root, &last_level, &reached);
+    for (;;)
+    {
+        int candidate = ws->queue[last_level];
+        for (int i = last_level + 1; i < reached; i++)
+            if (ws->degree[ws->queue[i]] < ws->degree[candidate])
+                candidate = ws->queue[i];
+        int candidate_eccentricity = level_structure(ws, candidate, &last_level, &reached);
+        if (candidate_eccentricity <= eccentricity)
+            return root;
+        root = candidate;
+        eccentricity = candidate_eccentricity;
+    }
+}
+
+static int *rcm_order(const CSRGraph *csr)
+{
+    int n = csr->node_count;
+    int slots = n > 0 ? n : 1;
+    int max_degree = 0;
+
+    RCMWorkspace ws = {csr, malloc(slots * sizeof(int)), malloc(slots * sizeof(int)),
+                       malloc(slots * sizeof(int)), NULL, 0};
+    int *perm = malloc(slots * sizeof(int));
+    bool *placed = calloc(slots, sizeof(bool));
+    if (ws.degree)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            ws.degree[v] = undirected_degree(csr, v);
+            max_degree = ws.degree[v] > max_degree ? ws.degree[v] : max_degree;
+        }
+        ws.keys = malloc((max_degree > 0 ? max_degree : 1) * sizeof(uint64_t));
+    }
+    // Components are started from their vertices in increasing degree order
+    int *starts = NULL;
+    if (ws.degree && ws.mark && ws.queue && ws.keys && perm && placed)
+        starts = degree_order(csr);
+    if (!starts)
+    {
+        free(ws.degree);
+        free(ws.mark);
+        free(ws.queue);
+        free(ws.keys);
+        free(perm);
+        free(placed);
+        return NULL;
+    }
+    for (int v = 0; v < n; v++)
+        ws.mark[v] = 0;
+
+    /* Cuthill-McKee: BFS per component, children by increasing degree */
+    int count = 0;
+    for (int s = n - 1; s >= 0; s--)
+    {
+        if (placed[starts[s]])
+            continue;
+        int root = pseudo_peripheral_vertex(&ws, starts[s]);
+        placed[root] = true;
+        perm[count++] = root;
+        for (int head = count - 1; head < count; head++)
+        {
+            int u = perm[head];
+            int children = 0;
+            FOR_EACH_NEIGHBOR(csr, u, v, {
+                if (!placed[v])
+                {
+                    placed[v] = true;
+                    ws.keys[children++] = ((uint64_t)ws.degree[v] << 32) | (uint32_t)v;
+                }
+            });
+            if (children > 1)
+                qsort(ws.keys, children, sizeof(uint64_t), compare_keys);
+            for (int i = 0; i < children; i++)
+                perm[count++] = (int)(ws.keys[i] & 0xFFFFFFFFu);
+        }
+    }
+
+    /* Reverse */
+    for (int i = 0, j = n - 1; i < j; i++, j--)
+    {
+        int t = perm[i];
+        perm[i] = perm[j];
+        perm[j] = t;
+    }
+
+    free(starts);
+    free(ws.degree);
+    free(ws.mark);
+    free(ws.queue);
+    free(ws.keys);
+    free(placed);
+    return perm;
+}
+
+/* ========================================================================
+ * ORDERS AND RELABELLING
+ * ========================================================================*/
+
+int *vertex_order_compute(const CSRGraph *csr, VertexOrder order)
+{
+    if (!csr)
+        return NULL;
+    switch (order)
+    {
+    case VERTEX_ORDER_DEGREE:
+        return degree_order(csr);
+    case VERTEX_ORDER_RCM:
+        return rcm_order(csr);
+    case VERTEX_ORDER_NONE:
+        break;
+    }
+    int n = csr->node_count;
+    int *perm = malloc((n > 0 ? n : 1) * sizeof(int));
+    for (int v = 0; perm && v < n; v++)
+        perm[v] = v;
+    return perm;
+}
+
+bool graph_reorder(const Graph *src, const int *perm, Graph *dst)
+{
+    memset(dst, 0, sizeof(*dst));
+    const CSRGraph *csr = src->csr;
+    int n = csr->node_count;
+    int m = csr->edge_count;
+
+    int *rank = malloc((n > 0 ? n : 1) * sizeof(int));
+    Edge *edges = malloc((m > 0 ? m : 1) * sizeof(Edge));
+    if (!rank || !edges)
+    {
+        free(rank);
+        free(edges);
+        return false;
+    }
+    for (int i = 0; i < n; i++)
+        rank[perm[i]] = i;
+
+    // Each undirected edge once (u < v); csr_create_from_edges() sorts the new rows
+    int k = 0;
+    for (int u = 0; u < n; u++)
+    {
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++)
+        {
+            int v = csr->neighbors[a];
+            if (csr->is_directed || u < v)
+                edges[k++] = (Edge){rank[u], rank[v]};
+        }
+    }
+    dst->csr = csr_create_from_edges(n, edges, k, csr->is_directed);
+    free(edges);
+    free(rank);
+
+    dst->node_count = n;
+    dst->is_directed = src->is_directed;
+    dst->allow_bidirectional = src->allow_bidirectional;
+    if (!dst->csr || (src->adjacency && !graph_ensure_adjacency(dst)))
+    {
+        graph_free_storage(dst);
+        return false;
+    }
+    return true;
+}
+
+void vertex_order_restore(const int *perm, int *vertices, int count)
+{
+    for (int i = 0; i < count; i++)
+        vertices[i] = perm[vertices[i]];
+}
+
+int csr_bandwidth(const CSRGraph *csr)
+{
+    int bandwidth = 0;
+    for (int u = 0; u < csr->node_count; u++)
+    {
+        if (csr_degree(csr, u) == 0)
+            continue;
+        int low = u - csr->neighbors[csr->offsets[u]];
+        int high = csr->neighbors[csr->offsets[u + 1] - 1] - u;
+        bandwidth = low > bandwidth ? low : bandwidth;
+        bandwidth = high > bandwidth ? high : bandwidth;
+    }
+    return bandwidth;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file search_budget.c
+ * @brief Search budget checks
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * The first reason to stop wins: the status moves away from SEARCH_COMPLETE
+ * with a compare-and-swap, so concurrent workers agree on it.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+
+#include "search_budget.h"
+
+static double monotonic_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Records why the budget ran out unless another thread already did
+ */
+static void budget_stop(SearchBudget *budget, SearchStatus why)
+{
+    int expected = SEARCH_COMPLETE;
+    atomic_compare_exchange_strong(&budget->status, &expected, (int)why);
+}
+
+void search_budget_init(SearchBudget *budget, double seconds, long long node_limit, atomic_bool *cancel)
+{
+    budget->deadline = seconds > 0 ? monotonic_seconds() + seconds : 0;
+    budget->node_limit = node_limit > 0 ? node_limit : 0;
+    budget->cancel = cancel;
+    atomic_init(&budget->nodes, 0);
+    atomic_init(&budget->status, SEARCH_COMPLETE);
+}
+
+void search_budget_cancel(SearchBudget *budget)
+{
+    budget_stop(budget, SEARCH_CANCELLED);
+}
+
+bool search_budget_check(SearchBudget *budget, long long nodes)
+{
+    if (budget->node_limit > 0 && nodes > budget->node_limit)
+        budget_stop(budget, SEARCH_NODE_LIMIT);
+    else if (budget->cancel && atomic_load_explicit(budget->cancel, memory_order_relaxed))
+        budget_stop(budget, SEARCH_CANCELLED);
+    else if (budget->deadline > 0 && monotonic_seconds() >= budget->deadline)
+        budget_stop(budget, SEARCH_TIME_LIMIT);
+    return atomic_load(&budget->status) == SEARCH_COMPLETE;
+}
+
+SearchStatus search_budget_status(const SearchBudget *budget)
+{
+    return budget ? (SearchStatus)atomic_load(&budget->status) : SEARCH_COMPLETE;
+}
+
+const char *search_status_name(SearchStatus status)
+{
+    switch (status)
+    {
+    case SEARCH_COMPLETE:
+        return "complete";
+    case SEARCH_TIME_LIMIT:
+        return "time_limit";
+    case SEARCH_NODE_LIMIT:
+        return "node_limit";
+    case SEARCH_CANCELLED:
+        return "cancelled";
+    }
+    return "unknown";
+}
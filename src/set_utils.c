@@ -14,6 +14,8 @@
  * - Integer vertex storage
  * - Simple stack-like removal (LIFO)
  * - Memory management utilities
+ * - Block-chained LIFO arena for recursion-frame buffers
+ * - Chunked store for collecting result sets without quadratic copying
  *
  * The set does not maintain ordering or prevent duplicates - it's designed
  * for performance in graph traversal algorithms where these properties
@@ -24,6 +26,7 @@
  */
 
 #include "set_utils.h"
+#include "graph_stats.h"
 
 /**
  * @brief Creates a new set with specified initial capacity
@@ -59,6 +62,8 @@ Set *set_create(int capacity)
     s->vertices = malloc(capacity * sizeof(int));
     s->size = 0;
     s->capacity = capacity;
+    GRAPH_STAT_INC(GRAPH_STAT_SET_CREATES);
+    GRAPH_STAT_ADD(GRAPH_STAT_SET_BYTES, (size_t)capacity * sizeof(int));
     return s;
 }
 
@@ -172,4 +177,166 @@ void set_destroy(Set *s)
 {
     free(s->vertices);
     free(s);
-}
\ No newline at end of file
+}
+
+/* ============================================================================
+ * ARENA ALLOCATOR
+ * ============================================================================*/
+
+/** Alignment of every arena allocation in bytes */
+#define SET_ARENA_ALIGN 8
+
+void set_arena_init(SetArena *arena, size_t block_size)
+{
+    arena->head = NULL;
+    arena->spare = NULL;
+    arena->block_size = block_size > 0 ? block_size : 64 * 1024;
+}
+
+void set_arena_destroy(SetArena *arena)
+{
+    while (arena->head)
+    {
+        SetArenaBlock *prev = arena->head->prev;
+        free(arena->head);
+        arena->head = prev;
+    }
+    free(arena->spare);
+    arena->spare = NULL;
+}
+
+SetArenaMark set_arena_mark(const SetArena *arena)
+{
+    SetArenaMark mark;
+    mark.block = arena->head;
+    mark.used = arena->head ? arena->head->used : 0;
+    return mark;
+}
+
+void set_arena_release(SetArena *arena, SetArenaMark mark)
+{
+    /* Pop blocks pushed after the mark; keep one as spare for reuse */
+    while (arena->head && arena->head != mark.block)
+    {
+        SetArenaBlock *block = arena->head;
+        arena->head = block->prev;
+        if (!arena->spare || arena->spare->capacity < block->capacity)
+        {
+            free(arena->spare);
+            arena->spare = block;
+        }
+        else
+        {
+            free(block);
+        }
+    }
+    if (arena->head)
+        arena->head->used = mark.used;
+}
+
+void *set_arena_alloc(SetArena *arena, size_t bytes)
+{
+    bytes = (bytes + SET_ARENA_ALIGN - 1) & ~(size_t)(SET_ARENA_ALIGN - 1);
+    if (bytes == 0)
+        bytes = SET_ARENA_ALIGN;
+
+    SetArenaBlock *block = arena->head;
+    if (!block || block->capacity - block->used < bytes)
+    {
+        /* Need a new block: reuse the spare if it is large enough */
+        if (arena->spare && arena->spare->capacity >= bytes)
+        {
+            block = arena->spare;
+            arena->spare = NULL;
+        }
+        else
+        {
+            size_t capacity = bytes > arena->block_size ? bytes : arena->block_size;
+            block = malloc(sizeof(SetArenaBlock) + capacity);
+            if (!block)
+                return NULL;
+            block->capacity = capacity;
+        }
+        block->used = 0;
+        block->prev = arena->head;
+        arena->head = block;
+    }
+
+    void *ptr = block->data + block->used;
+    block->used += bytes;
+    return ptr;
+}
+
+Set *set_arena_create_set(SetArena *arena, int capacity)
+{
+    Set *s = set_arena_alloc(arena, sizeof(Set) + (size_t)capacity * sizeof(int));
+    if (!s)
+        return NULL;
+    s->vertices = (int *)(s + 1);
+    s->size = 0;
+    s->capacity = capacity;
+    GRAPH_STAT_INC(GRAPH_STAT_SET_CREATES);
+    GRAPH_STAT_ADD(GRAPH_STAT_SET_BYTES, (size_t)capacity * sizeof(int));
+    return s;
+}
+
+/* ============================================================================
+ * CHUNKED RESULT STORE
+ * ============================================================================*/
+
+void set_store_init(SetStore *store)
+{
+    store->head = NULL;
+    store->tail = NULL;
+    store->total = 0;
+}
+
+void set_store_push(SetStore *store, const int *vertices, int size)
+{
+    if (!store->tail || store->tail->count == SET_STORE_CHUNK_SIZE)
+    {
+        SetStoreChunk *chunk = malloc(sizeof(SetStoreChunk));
+        chunk->next = NULL;
+        chunk->count = 0;
+        if (store->tail)
+            store->tail->next = chunk;
+        else
+            store->head = chunk;
+        store->tail = chunk;
+    }
+
+    Set *copy = set_create(size > 0 ? size : 1);
+    memcpy(copy->vertices, vertices, size * sizeof(int));
+    copy->size = size;
+    store->tail->items[store->tail->count++] = copy;
+    store->total++;
+}
+
+void set_store_flatten(SetStore *store, Set ***array, int *count)
+{
+    if (store->total > 0)
+    {
+        *array = realloc(*array, (*count + store->total) * sizeof(Set *));
+        for (SetStoreChunk *chunk = store->head; chunk; chunk = chunk->next)
+        {
+            memcpy(*array + *count, chunk->items, chunk->count * sizeof(Set *));
+            *count += chunk->count;
+            chunk->count = 0; /* ownership moved to the array */
+        }
+    }
+    set_store_clear(store);
+}
+
+void set_store_clear(SetStore *store)
+{
+    SetStoreChunk *chunk = store->head;
+    while (chunk)
+    {
+        SetStoreChunk *next = chunk->next;
+        for (int i = 0; i < chunk->count; i++)
+            set_destroy(chunk->items[i]);
+        free(chunk);
+        chunk = next;
+    }
+    set_store_init(store);
+}
@@ -0,0 +1,271 @@
+/**
+ * @file task_pool.c
+ * @brief Work-stealing task scheduler implementation
+ * @author Graph Theory Project Team
+ * @date 2024
+ *
+ * Each deque is a growable array guarded by its own mutex: the owner works at
+ * the bottom (end of the array), thieves take from the top (start). Locks are
+ * per deque, so the owner only contends with a thief that picked the same
+ * victim.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "task_pool.h"
+
+/** Initial slots per worker deque */
+#define TASK_DEQUE_INITIAL_CAPACITY 64
+
+typedef struct
+{
+    pthread_mutex_t lock;
+    void **items;
+    int top;      // Index of the oldest task (steal end)
+    int bottom;   // One past the newest task (owner end)
+    int capacity;
+} TaskDeque;
+
+struct TaskPool
+{
+    int num_workers;
+    TaskDeque *deques;
+    TaskFn run;
+    void *user;
+    atomic_int pending;   // Submitted tasks not yet finished
+    atomic_int idle;      // Workers currently looking for work
+    atomic_bool cancelled;
+};
+
+typedef struct
+{
+    TaskPool *pool;
+    int worker;
+} WorkerArg;
+
+/* ========================================================================
+ * DEQUE OPERATIONS
+ * ========================================================================*/
+
+static void deque_push(TaskDeque *dq, void *task)
+{
+    pthread_mutex_lock(&dq->lock);
+    if (dq->bottom == dq->capacity)
+    {
+        if (dq->top > 0)
+        {
+            // Compact before growing: stolen slots at the front are free
+            memmove(dq->items, dq->items + dq->top, (dq->bottom - dq->top) * sizeof(void *));
+            dq->bottom -= dq->top;
+            dq->top = 0;
+        }
+        if (dq->bottom == dq->capacity)
+        {
+            dq->capacity *= 2;
+            dq->items = realloc(dq->items, dq->capacity * sizeof(void *));
+        }
+    }
+    dq->items[dq->bottom++] = task;
+    pthread_mutex_unlock(&dq->lock);
+}
+
+static void *deque_pop_bottom(TaskDeque *dq)
+{
+    void *task = NULL;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->bottom > dq->top)
+    {
+        task = dq->items[--dq->bottom];
+        if (dq->bottom == dq->top)
+            dq->bottom = dq->top = 0;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return task;
+}
+
+static void *deque_steal_top(TaskDeque *dq)
+{
+    void *task = NULL;
+    pthread_mutex_lock(&dq->lock);
+    if (dq->bottom > dq->top)
+    {
+        task = dq->items[dq->top++];
+        if (dq->bottom == dq->top)
+            dq->bottom = dq->top = 0;
+    }
+    pthread_mutex_unlock(&dq->lock);
+    return task;
+}
+
+/* ========================================================================
+ * WORKER LOOP
+ * ========================================================================*/
+
+/**
+ * @brief Finds the next task: own deque first, then one sweep over victims
+ */
+static void *find_task(TaskPool *pool, int worker, unsigned *seed)
+{
+    void *task = deque_pop_bottom(&pool->deques[worker]);
+    if (task || pool->num_workers == 1)
+        return task;
+
+    // Start the sweep at a pseudo-random victim to spread contention
+    *seed = *seed * 1103515245u + 12345u;
+    int start = (int)((*seed >> 16) % (unsigned)pool->num_workers);
+    for (int k = 0; k < pool->num_workers && !task; k++)
+    {
+        int victim = (start + k) % pool->num_workers;
+        if (victim != worker)
+            task = deque_steal_top(&pool->deques[victim]);
+    }
+    return task;
+}
+
+static void worker_loop(TaskPool *pool, int worker)
+{
+    unsigned seed = 2654435761u * (unsigned)(worker + 1);
+    bool is_idle = false;
+
+    while (atomic_load(&pool->pending) > 0)
+    {
+        void *task = find_task(pool, worker, &seed);
+        if (!task)
+        {
+            if (!is_idle)
+            {
+                atomic_fetch_add(&pool->idle, 1);
+                is_idle = true;
+            }
+            sched_yield();
+            continue;
+        }
+        if (is_idle)
+        {
+            atomic_fetch_sub(&pool->idle, 1);
+            is_idle = false;
+        }
+        pool->run(pool, worker, task, pool->user);
+        atomic_fetch_sub(&pool->pending, 1);
+    }
+    if (is_idle)
+        atomic_fetch_sub(&pool->idle, 1);
+}
+
+static void *worker_main(void *arg)
+{
+    WorkerArg *wa = arg;
+    worker_loop(wa->pool, wa->worker);
+    return NULL;
+}
+
+/* ========================================================================
+ * PUBLIC API
+ * ========================================================================*/
+
+int task_pool_default_threads(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (int)n : 1;
+}
+
+TaskPool *task_pool_create(int num_workers, TaskFn run, void *user)
+{
+    if (num_workers <= 0)
+        num_workers = task_pool_default_threads();
+
+    TaskPool *pool = malloc(sizeof(TaskPool));
+    if (!pool)
+        return NULL;
+    pool->deques = calloc(num_workers, sizeof(TaskDeque));
+    if (!pool->deques)
+    {
+        free(pool);
+        return NULL;
+    }
+    pool->num_workers = num_workers;
+    pool->run = run;
+    pool->user = user;
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->idle, 0);
+    atomic_init(&pool->cancelled, false);
+
+    for (int w = 0; w < num_workers; w++)
+    {
+        TaskDeque *dq = &pool->deques[w];
+        pthread_mutex_init(&dq->lock, NULL);
+        dq->capacity = TASK_DEQUE_INITIAL_CAPACITY;
+        dq->items = malloc(dq->capacity * sizeof(void *));
+    }
+    return pool;
+}
+
+int task_pool_size(const TaskPool *pool)
+{
+    return pool->num_workers;
+}
+
+void task_pool_submit(TaskPool *pool, int worker, void *task)
+{
+    atomic_fetch_add(&pool->pending, 1);
+    deque_push(&pool->deques[worker % pool->num_workers], task);
+}
+
+void task_pool_run(TaskPool *pool)
+{
+    int extra = pool->num_workers - 1;
+    pthread_t *threads = malloc((extra > 0 ? extra : 1) * sizeof(pthread_t));
+    WorkerArg *args = malloc((extra > 0 ? extra : 1) * sizeof(WorkerArg));
+    int started = 0;
+
+    for (int w = 1; w < pool->num_workers; w++)
+    {
+        args[started].pool = pool;
+        args[started].worker = w;
+        if (pthread_create(&threads[started], NULL, worker_main, &args[started]) == 0)
+            started++;
+        // A worker that failed to start just leaves its deque to the thieves
+    }
+
+    worker_loop(pool, 0);
+
+    for (int t = 0; t < started; t++)
+        pthread_join(threads[t], NULL);
+    free(threads);
+    free(args);
+}
+
+bool task_pool_has_idle(const TaskPool *pool)
+{
+    return atomic_load(&pool->idle) > 0;
+}
+
+void task_pool_cancel(TaskPool *pool)
+{
+    atomic_store(&pool->cancelled, true);
+}
+
+bool task_pool_cancelled(const TaskPool *pool)
+{
+    return atomic_load(&pool->cancelled);
+}
+
+void task_pool_destroy(TaskPool *pool)
+{
+    if (!pool)
+        return;
+    for (int w = 0; w < pool->num_workers; w++)
+    {
+        pthread_mutex_destroy(&pool->deques[w].lock);
+        free(pool->deques[w].items);
+    }
+    free(pool->deques);
+    free(pool);
+}
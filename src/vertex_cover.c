@@ -12,6 +12,8 @@
  * 1. Exact algorithm via Maximum Independent Set (complement graph approach)
  * 2. 2-approximation algorithm using maximal matching
  * 3. Optimal algorithm for bipartite graphs using König's theorem
+ * 4. Decision "is there a cover of size ≤ k?" with a Buss kernel and a
+ *    bounded search tree, exponential only in k
  *
  * Key concepts:
  * - Vertex Cover: Set of vertices covering all edges
@@ -30,11 +32,14 @@
 #include <limits.h>
 
 #include "vertex_cover.h"
-#include "independent_set.h" /* for create_complement_graph / find_maximum_independent_set */
+#include "independent_set.h" /* for find_maximum_independent_set */
 #include "clique.h"
 #include "set_utils.h"
-
-static int INF_DIST = INT_MAX;
+#include "csr_graph.h"
+#include "bfs.h"
+#include "components.h"
+#include "task_pool.h"
+#include "matching.h"
 
 /**
  * @brief Checks if a set contains a specific vertex
@@ -67,9 +72,9 @@ static bool set_contains(Set *s, int v)
  * by utilizing the relationship: Vertex Cover = V \ Maximum Independent Set.
  *
  * Algorithm steps:
- * 1. Create complement graph of the input graph
- * 2. Find maximum clique in complement (equivalent to MIS in original)
- * 3. Return all vertices not in the maximum independent set
+ * 1. Find the maximum independent set with find_maximum_independent_set()
+ *    (branch-and-reduce for sparse graphs, clique on the complement otherwise)
+ * 2. Return all vertices not in the maximum independent set
  *
  * @param graph Pointer to the undirected graph structure
  *
@@ -83,7 +88,7 @@ static bool set_contains(Set *s, int v)
  * @post Original graph remains unchanged
  *
  * @warning This algorithm has exponential time complexity
- * @warning Not suitable for large graphs (>20-30 vertices)
+ * @warning Kernels that stay large after the reductions may still be slow
  * @warning Returns NULL for directed graphs
  */
 Set *vertex_cover_exact_via_mis(Graph *graph)
@@ -93,18 +98,8 @@ Set *vertex_cover_exact_via_mis(Graph *graph)
     if (graph->is_directed)
         return NULL; /* not supported */
 
-    /* Create complement and find maximum clique on complement (== MIS in original) */
-    Graph *comp = create_complement_graph(graph);
-    if (!comp)
-        return NULL;
-
-    Set *max_clique = find_maximum_clique(comp);
-    /* free complement adjacency now */
-    for (int i = 0; i < comp->node_count; i++)
-        free(comp->adjacency[i]);
-    free(comp->adjacency);
-    free(comp);
-
+    /* Maximum independent set (kernelized for sparse graphs, clique on the complement otherwise) */
+    Set *max_clique = find_maximum_independent_set(graph);
     if (!max_clique)
         return NULL;
 
@@ -120,69 +115,571 @@ Set *vertex_cover_exact_via_mis(Graph *graph)
 }
 
 /**
- * @brief Finds 2-approximation vertex cover using maximal matching
+ * @brief Finds 2-approximation vertex cover using a parallel maximal matching
  *
  * This function implements a greedy 2-approximation algorithm that guarantees
  * a vertex cover of size at most 2 times the optimal solution.
  *
  * Algorithm steps:
- * 1. Find a maximal matching (greedily select edges)
+ * 1. Find a maximal matching with matching_maximal_parallel() (greedy in
+ *    a seeded random edge order, computed in parallel rounds on the CSR)
  * 2. Include both endpoints of each matched edge in vertex cover
  * 3. This covers all edges since every edge is either matched or
  *    incident to a matched edge
  *
  * @param graph Pointer to the undirected graph structure
+ * @param num_threads Worker threads (≤ 0 for all online processors)
+ * @param seed Edge priority seed; equal seeds give equal covers
  *
- * @return Pointer to Set containing 2-approximate vertex cover, NULL on failure
+ * @return Pointer to Set containing 2-approximate vertex cover (ascending),
+ *         NULL on failure
  *
- * @complexity O(V²) for adjacency matrix representation
+ * @complexity O(E) work per round, O(log V) rounds expected
  *
  * @pre graph must be an undirected graph (is_directed == false)
- * @pre graph must have valid adjacency matrix
+ * @pre graph must have an adjacency matrix or a CSR view
  * @post Returns newly allocated Set that caller must free
  * @post Size of returned cover ≤ 2 × |optimal vertex cover|
  * @post Original graph remains unchanged
  *
- * @note This is a practical algorithm for large graphs
- * @note Provides good performance vs. quality trade-off
+ * @note The cover does not depend on num_threads
  */
-Set *vertex_cover_approx(Graph *graph)
+Set *vertex_cover_approx_parallel(Graph *graph, int num_threads, unsigned long long seed)
 {
     if (!graph)
         return NULL;
     if (graph->is_directed)
         return NULL;
 
+    CSRGraph *csr = graph_ensure_csr(graph);
     int n = graph->node_count;
-    char *matched = calloc(n, sizeof(char)); /* marks if vertex already matched/covered */
-    Set *vc = set_create(n);
+    int *mate = csr ? malloc((n > 0 ? n : 1) * sizeof(int)) : NULL;
+    int size = mate ? matching_maximal_parallel(csr, num_threads, seed, mate) : -1;
+    if (size < 0)
+    {
+        free(mate);
+        return NULL;
+    }
 
-    for (int u = 0; u < n; u++)
+    /* both endpoints of every matching edge */
+    Set *vc = set_create(2 * size > 0 ? 2 * size : 1);
+    for (int v = 0; v < n; v++)
     {
-        if (matched[u])
+        if (mate[v] >= 0)
+            set_add(vc, v);
+    }
+    free(mate);
+    return vc;
+}
+
+/**
+ * @brief Finds 2-approximation vertex cover using maximal matching
+ *
+ * vertex_cover_approx_parallel() with all online processors and
+ * VERTEX_COVER_APPROX_SEED.
+ *
+ * @param graph Pointer to the undirected graph structure
+ *
+ * @return Pointer to Set containing 2-approximate vertex cover, NULL on failure
+ *
+ * @note This is a practical algorithm for large graphs
+ * @note Provides good performance vs. quality trade-off
+ */
+Set *vertex_cover_approx(Graph *graph)
+{
+    return vertex_cover_approx_parallel(graph, 0, VERTEX_COVER_APPROX_SEED);
+}
+
+/* ========================================================================
+ * PARAMETERIZED DECISION (BUSS KERNEL + BOUNDED SEARCH TREE)
+ * ========================================================================*/
+
+/**
+ * @brief Greedy maximal matching on the CSR rows
+ *
+ * @param csr Undirected CSR view
+ * @param matched Receives the matched vertices (n entries, zeroed by the caller)
+ * @return Number of matching edges
+ *
+ * @complexity O(V + E)
+ */
+static int greedy_matching(const CSRGraph *csr, bool *matched)
+{
+    int size = 0;
+    for (int u = 0; u < csr->node_count; u++)
+    {
+        for (int k = csr->offsets[u]; !matched[u] && k < csr->offsets[u + 1]; k++)
+        {
+            int v = csr->neighbors[k];
+            if (!matched[v] && v != u)
+            {
+                matched[u] = matched[v] = true;
+                size++;
+            }
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Buss kernel: moves every vertex of degree > budget into the cover
+ *
+ * A vertex with more than budget neighbors must be in every cover of size
+ * ≤ budget. Degrees only shrink and the budget shrinks by one per forced
+ * vertex, so vertices sit in degree buckets and the scan pointer only
+ * moves down.
+ *
+ * @param csr Undirected CSR view
+ * @param forced Receives the forced vertices (n entries, zeroed by the caller)
+ * @param degree Receives the degrees in G - forced
+ * @param budget In: k, out: k minus the number of forced vertices (may be < 0)
+ * @return false on allocation failure
+ *
+ * @complexity O(V + E)
+ */
+static bool buss_kernel(const CSRGraph *csr, bool *forced, int *degree, int *budget)
+{
+    int n = csr->node_count;
+    int *head = malloc(n * sizeof(int));
+    int *next = malloc(n * sizeof(int));
+    int *prev = malloc(n * sizeof(int));
+    if (!head || !next || !prev)
+    {
+        free(head);
+        free(next);
+        free(prev);
+        return false;
+    }
+
+    for (int d = 0; d < n; d++)
+        head[d] = -1;
+    for (int v = 0; v < n; v++)
+    {
+        degree[v] = csr_degree(csr, v);
+        prev[v] = -1;
+        next[v] = head[degree[v]];
+        if (next[v] >= 0)
+            prev[next[v]] = v;
+        head[degree[v]] = v;
+    }
+
+    int top = n - 1;
+    while (*budget >= 0)
+    {
+        while (top > *budget && head[top] < 0)
+            top--;
+        if (top <= *budget)
+            break;
+
+        int v = head[top];
+        head[top] = next[v];
+        if (next[v] >= 0)
+            prev[next[v]] = -1;
+        forced[v] = true;
+        (*budget)--;
+
+        for (int k = csr->offsets[v]; k < csr->offsets[v + 1]; k++)
+        {
+            int u = csr->neighbors[k];
+            if (forced[u])
+                continue;
+            // Unlink u from bucket degree[u], push it onto degree[u] - 1
+            if (prev[u] >= 0)
+                next[prev[u]] = next[u];
+            else
+                head[degree[u]] = next[u];
+            if (next[u] >= 0)
+                prev[next[u]] = prev[u];
+            degree[u]--;
+            prev[u] = -1;
+            next[u] = head[degree[u]];
+            if (next[u] >= 0)
+                prev[next[u]] = u;
+            head[degree[u]] = u;
+        }
+        degree[v] = 0;
+    }
+
+    free(head);
+    free(next);
+    free(prev);
+    return true;
+}
+
+typedef struct
+{
+    int n;                 // Kernel vertices
+    const int *offsets;    // Kernel rows (sorted, kernel numbering)
+    const int *neighbors;
+    bool *taken;           // Vertex is in the cover (and removed from the graph)
+    int *degree;           // Degree in the remaining graph
+    int edges;             // Edges of the remaining graph
+    int *trail;            // Taken vertices in order, for undo and the witness
+    int trail_size;
+    bool *matched;         // Scratch for the matching bound
+} DecideSearch;
+
+static void decide_take(DecideSearch *s, int v)
+{
+    s->taken[v] = true;
+    s->trail[s->trail_size++] = v;
+    for (int k = s->offsets[v]; k < s->offsets[v + 1]; k++)
+    {
+        int u = s->neighbors[k];
+        if (!s->taken[u])
+        {
+            s->degree[u]--;
+            s->edges--;
+        }
+    }
+}
+
+static void decide_undo(DecideSearch *s, int mark)
+{
+    while (s->trail_size > mark)
+    {
+        int v = s->trail[--s->trail_size];
+        for (int k = s->offsets[v]; k < s->offsets[v + 1]; k++)
+        {
+            int u = s->neighbors[k];
+            if (!s->taken[u])
+            {
+                s->degree[u]++;
+                s->edges++;
+            }
+        }
+        s->taken[v] = false;
+    }
+}
+
+static bool decide_adjacent(const DecideSearch *s, int u, int w)
+{
+    int lo = s->offsets[u], hi = s->offsets[u + 1];
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+        if (s->neighbors[mid] < w)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < s->offsets[u + 1] && s->neighbors[lo] == w;
+}
+
+/**
+ * @brief Greedy maximal matching of the remaining graph (a cover lower bound)
+ */
+static int decide_matching_bound(DecideSearch *s)
+{
+    memset(s->matched, 0, s->n * sizeof(bool));
+    int size = 0;
+    for (int u = 0; u < s->n; u++)
+    {
+        if (s->taken[u] || s->degree[u] == 0)
             continue;
-        for (int v = 0; v < n; v++)
+        for (int k = s->offsets[u]; !s->matched[u] && k < s->offsets[u + 1]; k++)
         {
-            if (graph->adjacency[u][v] && !matched[v])
+            int v = s->neighbors[k];
+            if (!s->taken[v] && !s->matched[v])
             {
-                /* take edge (u,v) into matching => add both endpoints to cover */
-                if (!matched[u])
-                {
-                    set_add(vc, u);
-                    matched[u] = 1;
-                }
-                if (!matched[v])
+                s->matched[u] = s->matched[v] = true;
+                size++;
+            }
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Applies the polynomial rules until none fires, then the bounds
+ *
+ * Rules (each keeps some minimum cover of the remaining graph):
+ * - degree > budget: the vertex is in every cover within the budget
+ * - degree 1: take the neighbor
+ * - degree 2 in a triangle: take both neighbors
+ * - maximum degree 2: the graph is a union of cycles, any vertex is optimal
+ *
+ * @param budget In/out: remaining budget after the taken vertices
+ * @param branch_out Receives a vertex of maximum degree (≥ 3) to branch on
+ * @return false if no cover within the budget exists
+ */
+static bool decide_reduce(DecideSearch *s, int *budget, int *branch_out)
+{
+    int max_vertex;
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        max_vertex = -1;
+        for (int v = 0; v < s->n && *budget >= 0; v++)
+        {
+            if (s->taken[v] || s->degree[v] == 0)
+                continue;
+
+            int first = -1, second = -1;
+            if (s->degree[v] <= 2)
+            {
+                for (int k = s->offsets[v]; k < s->offsets[v + 1]; k++)
                 {
-                    set_add(vc, v);
-                    matched[v] = 1;
+                    int u = s->neighbors[k];
+                    if (s->taken[u])
+                        continue;
+                    if (first < 0)
+                        first = u;
+                    else
+                        second = u;
                 }
-                break;
             }
+
+            if (s->degree[v] > *budget)
+            {
+                decide_take(s, v);
+                (*budget)--;
+                changed = true;
+            }
+            else if (s->degree[v] == 1)
+            {
+                decide_take(s, first);
+                (*budget)--;
+                changed = true;
+            }
+            else if (s->degree[v] == 2 && decide_adjacent(s, first, second))
+            {
+                decide_take(s, first);
+                decide_take(s, second);
+                *budget -= 2;
+                changed = true;
+            }
+            else if (max_vertex < 0 || s->degree[v] > s->degree[max_vertex])
+            {
+                max_vertex = v;
+            }
+        }
+        if (*budget < 0)
+            return false;
+        if (!changed && max_vertex >= 0 && s->degree[max_vertex] == 2)
+        {
+            decide_take(s, max_vertex);
+            (*budget)--;
+            changed = true;
         }
     }
 
-    free(matched);
-    return vc;
+    *branch_out = -1;
+    if (s->edges == 0)
+        return true;
+    // Every cover vertex covers at most Δ edges, every matching edge needs its own cover vertex
+    if ((long long)*budget * s->degree[max_vertex] < s->edges || decide_matching_bound(s) > *budget)
+        return false;
+    *branch_out = max_vertex;
+    return true;
+}
+
+/**
+ * @brief Bounded search tree: v is in the cover, or all of N(v) is
+ *
+ * Branching only on degree ≥ 3 gives the branch vector (1, 3), so at most
+ * O(1.4656^k) nodes. On success the taken vertices stay on the trail.
+ */
+static bool decide_search(DecideSearch *s, int budget)
+{
+    int mark = s->trail_size;
+    int v;
+    if (!decide_reduce(s, &budget, &v))
+    {
+        decide_undo(s, mark);
+        return false;
+    }
+    if (v < 0)
+        return true;
+
+    int branch = s->trail_size;
+    decide_take(s, v);
+    if (decide_search(s, budget - 1))
+        return true;
+    decide_undo(s, branch);
+
+    int degree = s->degree[v];
+    if (degree <= budget)
+    {
+        for (int k = s->offsets[v]; k < s->offsets[v + 1]; k++)
+        {
+            if (!s->taken[s->neighbors[k]])
+                decide_take(s, s->neighbors[k]);
+        }
+        if (decide_search(s, budget - degree))
+            return true;
+    }
+    decide_undo(s, mark);
+    return false;
+}
+
+/**
+ * @brief Collects the vertices flagged in a mask into a new Set
+ */
+static Set *cover_from_mask(const bool *mask, int n)
+{
+    int size = 0;
+    for (int v = 0; v < n; v++)
+        size += mask[v];
+    Set *cover = set_create(size > 0 ? size : 1);
+    for (int v = 0; v < n; v++)
+    {
+        if (mask[v])
+            set_add(cover, v);
+    }
+    return cover;
+}
+
+/**
+ * @brief Runs the bounded search tree on G - forced
+ *
+ * Compacts the vertices that still have edges into a kernel CSR, searches
+ * it and adds the taken vertices to forced on success.
+ *
+ * @return VERTEX_COVER_YES, VERTEX_COVER_NO or VERTEX_COVER_NO_MEMORY
+ */
+static VertexCoverDecision decide_kernel(const CSRGraph *csr, bool *forced, const int *degree, int budget)
+{
+    int n = csr->node_count;
+    int kernel_n = 0, arcs = 0;
+    for (int v = 0; v < n; v++)
+    {
+        if (!forced[v] && degree[v] > 0)
+        {
+            kernel_n++;
+            arcs += degree[v];
+        }
+    }
+
+    int *index = malloc(n * sizeof(int));
+    int *vertex = malloc(kernel_n * sizeof(int));
+    int *offsets = malloc((kernel_n + 1) * sizeof(int));
+    int *neighbors = malloc((arcs > 0 ? arcs : 1) * sizeof(int));
+    DecideSearch s = {kernel_n, offsets, neighbors, calloc(kernel_n, sizeof(bool)), malloc(kernel_n * sizeof(int)),
+                      arcs / 2, malloc(kernel_n * sizeof(int)), 0, malloc(kernel_n * sizeof(bool))};
+    VertexCoverDecision result = VERTEX_COVER_NO_MEMORY;
+    if (index && vertex && offsets && neighbors && s.taken && s.degree && s.trail && s.matched)
+    {
+        // Kernel numbering follows vertex order, so the kernel rows stay sorted
+        int next = 0;
+        for (int v = 0; v < n; v++)
+        {
+            index[v] = !forced[v] && degree[v] > 0 ? next : -1;
+            if (index[v] >= 0)
+                vertex[next++] = v;
+        }
+        offsets[0] = 0;
+        for (int i = 0; i < kernel_n; i++)
+        {
+            int v = vertex[i];
+            offsets[i + 1] = offsets[i];
+            for (int k = csr->offsets[v]; k < csr->offsets[v + 1]; k++)
+            {
+                if (index[csr->neighbors[k]] >= 0)
+                    neighbors[offsets[i + 1]++] = index[csr->neighbors[k]];
+            }
+            s.degree[i] = degree[v];
+        }
+
+        result = decide_search(&s, budget) ? VERTEX_COVER_YES : VERTEX_COVER_NO;
+        for (int i = 0; result == VERTEX_COVER_YES && i < s.trail_size; i++)
+            forced[vertex[s.trail[i]]] = true;
+    }
+
+    free(index);
+    free(vertex);
+    free(offsets);
+    free(neighbors);
+    free(s.taken);
+    free(s.degree);
+    free(s.trail);
+    free(s.matched);
+    return result;
+}
+
+/**
+ * @brief Decides whether a vertex cover of size ≤ k exists
+ *
+ * Algorithm steps:
+ * 1. Greedy maximal matching M: |M| > k proves "no"; 2|M| ≤ k proves
+ *    "yes" with the matched vertices (the vertex_cover_approx() bound)
+ * 2. Buss kernel: vertices of degree > k are forced into the cover; more
+ *    than k'² remaining edges prove "no" (k' = budget left)
+ * 3. Bounded search tree on the ≤ k'² remaining edges (decide_search())
+ *
+ * @param graph Pointer to the undirected graph structure
+ * @param k Size bound
+ * @param cover_out Receives a cover of size ≤ k on VERTEX_COVER_YES; may be NULL
+ *
+ * @return Decision, see VertexCoverDecision
+ *
+ * @complexity O(V + E + 1.4656^k · k²)
+ */
+VertexCoverDecision vertex_cover_decide(Graph *graph, int k, Set **cover_out)
+{
+    if (cover_out)
+        *cover_out = NULL;
+    if (!graph || graph->is_directed)
+        return VERTEX_COVER_UNSUPPORTED;
+    if (k < 0)
+        return VERTEX_COVER_NO;
+
+    CSRGraph *csr = graph_ensure_csr(graph);
+    if (!csr)
+        return VERTEX_COVER_NO_MEMORY;
+    int n = csr->node_count;
+
+    bool *mask = calloc(n > 0 ? n : 1, sizeof(bool));
+    int *degree = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (!mask || !degree)
+    {
+        free(mask);
+        free(degree);
+        return VERTEX_COVER_NO_MEMORY;
+    }
+
+    VertexCoverDecision result;
+    int matching = greedy_matching(csr, mask);
+    if (matching > k)
+    {
+        result = VERTEX_COVER_NO;
+    }
+    else if (2 * matching <= k)
+    {
+        result = VERTEX_COVER_YES; // Both endpoints of a maximal matching cover every edge
+    }
+    else
+    {
+        memset(mask, 0, n * sizeof(bool));
+        int budget = k;
+        if (!buss_kernel(csr, mask, degree, &budget))
+        {
+            result = VERTEX_COVER_NO_MEMORY;
+        }
+        else
+        {
+            long long edges = 0;
+            for (int v = 0; v < n; v++)
+                edges += mask[v] ? 0 : degree[v];
+            edges /= 2;
+
+            if (budget < 0 || edges > (long long)budget * budget)
+                result = VERTEX_COVER_NO;
+            else if (edges == 0)
+                result = VERTEX_COVER_YES;
+            else
+                result = decide_kernel(csr, mask, degree, budget);
+        }
+    }
+
+    if (result == VERTEX_COVER_YES && cover_out)
+    {
+        *cover_out = cover_from_mask(mask, n);
+    }
+    free(mask);
+    free(degree);
+    return result;
 }
 
 /**
@@ -192,8 +689,8 @@ Set *vertex_cover_approx(Graph *graph)
  * and returns masks indicating which vertices belong to each partition.
  *
  * Algorithm steps:
- * 1. Use BFS to 2-color the graph components
- * 2. If coloring succeeds, graph is bipartite
+ * 1. Use the shared BFS kernel to 2-color each component by level parity
+ * 2. If no edge joins two vertices of the same color, graph is bipartite
  * 3. Create boolean masks for left and right partitions
  *
  * @param graph Pointer to the undirected graph structure
@@ -218,45 +715,47 @@ bool is_bipartite_partition(Graph *graph, char **left_mask_out, char **right_mas
     if (!graph || graph->is_directed)
         return false;
     int n = graph->node_count;
-    char *color = malloc(n); /* 0 = uncolored, 1 = left, 2 = right */
-    memset(color, 0, n);
+    CSRGraph *csr = graph_ensure_csr(graph); /* BFS scans real neighbors only */
+    if (!csr)
+        return false;
+    char *color = calloc(n > 0 ? n : 1, 1); /* 0 = uncolored, 1 = left, 2 = right */
 
-    /* BFS over components */
-    int *queue = malloc(n * sizeof(int));
+    /* One BFS per component; the level parity gives the side */
+    BFSWorkspace *ws = color ? bfs_workspace_create(n, 0) : NULL;
+    if (!ws)
+    {
+        free(color);
+        return false;
+    }
     for (int s = 0; s < n; s++)
     {
         if (color[s] != 0)
             continue;
-        /* if isolated node, color as left by default */
-        color[s] = 1;
-        int head = 0, tail = 0;
-        queue[tail++] = s;
-        while (head < tail)
+        bfs_run(ws, csr, &s, 1, BFS_FORWARD, NULL);
+        for (int i = 0; i < ws->reached; i++)
         {
-            int u = queue[head++];
-            for (int v = 0; v < n; v++)
+            int v = ws->queue[i];
+            color[v] = (ws->level[v] % 2 == 0) ? 1 : 2;
+        }
+    }
+    bfs_workspace_destroy(ws);
+
+    /* A BFS 2-coloring is proper iff the graph is bipartite */
+    for (int u = 0; u < n; u++)
+    {
+        for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+        {
+            if (color[csr->neighbors[k]] == color[u])
             {
-                if (!graph->adjacency[u][v])
-                    continue;
-                if (color[v] == 0)
-                {
-                    color[v] = (color[u] == 1) ? 2 : 1;
-                    queue[tail++] = v;
-                }
-                else if (color[v] == color[u])
-                {
-                    free(color);
-                    free(queue);
-                    return false; /* not bipartite */
-                }
+                free(color);
+                return false; /* not bipartite */
             }
         }
     }
 
-    free(queue);
     /* produce masks */
-    char *left = calloc(n, 1);
-    char *right = calloc(n, 1);
+    char *left = calloc(n > 0 ? n : 1, 1);
+    char *right = calloc(n > 0 ? n : 1, 1);
     for (int i = 0; i < n; i++)
     {
         if (color[i] == 1)
@@ -323,355 +822,102 @@ static void build_left_right_lists_from_masks(Graph *graph, char *left_mask,
 }
 
 /**
- * @brief Implements Hopcroft-Karp maximum bipartite matching algorithm
- *
- * This function finds a maximum matching in a bipartite graph using the
- * Hopcroft-Karp algorithm, which uses BFS to find shortest augmenting paths
- * and DFS to find multiple augmenting paths simultaneously.
- *
- * Algorithm steps:
- * 1. Build adjacency lists for efficient neighbor iteration
- * 2. Repeatedly find shortest augmenting paths using BFS
- * 3. Use DFS to find and augment multiple paths simultaneously
- * 4. Continue until no more augmenting paths exist
- *
- * @param graph Pointer to the graph structure
- * @param left_nodes Array of vertex indices in left partition
- * @param left_n Number of vertices in left partition
- * @param right_nodes Array of vertex indices in right partition
- * @param right_n Number of vertices in right partition
- * @param pairU_out Output matching array for left vertices (caller must free)
- * @param pairV_out Output matching array for right vertices (caller must free)
- *
- * @return Size of maximum matching found
- *
- * @complexity O(E√V) which is optimal for bipartite matching
- *
- * @pre graph must be bipartite with valid adjacency matrix
- * @pre left_nodes and right_nodes must contain valid vertex indices
- * @pre All output parameters must be valid pointers
- * @post pairU[i] = j means left_nodes[i] is matched to right_nodes[j]
- * @post pairV[j] = i means right_nodes[j] is matched to left_nodes[i]
- * @post Unmatched vertices have value -1 in pairing arrays
- * @post Caller must free pairU_out and pairV_out arrays
- *
- * @warning Returns NULL arrays if either partition is empty
+ * @brief One connected component of a König cover computation
  */
-static int hopcroft_karp(Graph *graph, int *left_nodes, int left_n, int *right_nodes, int right_n,
-                         int **pairU_out, int **pairV_out)
+typedef struct
 {
-    if (left_n == 0 || right_n == 0)
-    {
-        *pairU_out = NULL;
-        *pairV_out = NULL;
-        return 0;
-    }
-
-    /* build adjacency list: for each left index i in [0..left_n-1], neighbors are indices j in [0..right_n-1]
-       such that graph->adjacency[left_nodes[i]][ right_nodes[j] ] == 1 */
-    int **adjL = malloc(left_n * sizeof(int *));
-    int *adj_sizes = calloc(left_n, sizeof(int));
-    for (int i = 0; i < left_n; i++)
-    {
-        /* count neighbors */
-        int u = left_nodes[i];
-        int cnt = 0;
-        for (int j = 0; j < right_n; j++)
-        {
-            int v = right_nodes[j];
-            if (graph->adjacency[u][v])
-                cnt++;
-        }
-        adjL[i] = malloc(cnt * sizeof(int));
-        int k = 0;
-        for (int j = 0; j < right_n; j++)
-        {
-            int v = right_nodes[j];
-            if (graph->adjacency[u][v])
-                adjL[i][k++] = j; /* store neighbor as index in right_nodes */
-        }
-        adj_sizes[i] = cnt;
-    }
-
-    int *pairU = malloc(left_n * sizeof(int));
-    int *pairV = malloc(right_n * sizeof(int));
-    int *dist = malloc(left_n * sizeof(int));
-
-    for (int i = 0; i < left_n; i++)
-        pairU[i] = -1;
-    for (int j = 0; j < right_n; j++)
-        pairV[j] = -1;
-
-    int matching = 0;
-
-    /* BFS in HK to build layers */
-    int bfs_queue_capacity = left_n;
-    int *q = malloc(bfs_queue_capacity * sizeof(int));
-
-    while (1)
-    {
-        /* BFS */
-        int qh = 0, qt = 0;
-        for (int i = 0; i < left_n; i++)
-        {
-            if (pairU[i] == -1)
-            {
-                dist[i] = 0;
-                q[qt++] = i;
-            }
-            else
-                dist[i] = INF_DIST;
-        }
-        int found_augmenting = 0;
-        while (qh < qt)
-        {
-            int u = q[qh++];
-            for (int k = 0; k < adj_sizes[u]; k++)
-            {
-                int v = adjL[u][k];
-                int pu = pairV[v];
-                if (pu == -1)
-                {
-                    found_augmenting = 1; /* shortest augmenting path exists via this free vertex */
-                }
-                else
-                {
-                    if (dist[pu] == INF_DIST)
-                    {
-                        dist[pu] = dist[u] + 1;
-                        q[qt++] = pu;
-                    }
-                }
-            }
-        }
-        if (!found_augmenting)
-            break;
-
-        /* DFS (recursive-style using stack) to find augmenting paths from free U vertices */
-        /* We'll implement a simple recursive DFS using helper function closure-like via static local functions is messy;
-           so implement iterative augmentation using stack arrays and recursion simulation. For clarity and small graphs,
-           we can implement a recursive function using function pointer; but to keep it simple, implement recursive function. */
+    int *left_nodes;   // Slice of the shared vertex buffer
+    int left_n;
+    int *right_nodes;
+    int right_n;
+    Set *cover;        // Minimum cover of the component
+} KonigJob;
 
-        /* define recursive lambda via inner function using static helper - but C doesn't have nested functions portably.
-           Instead implement iterative DFS with stack storing (u, next_neighbor_index). */
-
-        int *next = calloc(left_n, sizeof(int));
-        /* stack of left nodes */
-        int *stack = malloc((left_n + 5) * sizeof(int));
-        int stack_sz;
-
-        for (int start = 0; start < left_n; start++)
-        {
-            if (pairU[start] != -1)
-                continue;
-            /* iterative DFS from `start` */
-            stack_sz = 0;
-            stack[stack_sz++] = start;
-            while (stack_sz > 0)
-            {
-                int u = stack[stack_sz - 1];
-                if (next[u] < adj_sizes[u])
-                {
-                    int v = adjL[u][next[u]++];
-                    int pu = pairV[v];
-                    if (pu == -1 || (dist[pu] == dist[u] + 1 && pairU[pu] != -1))
-                    {
-                        /* try to augment */
-                        /* recursively attempt to find augmenting path from pu if exists */
-                        if (pu != -1)
-                        {
-                            stack[stack_sz++] = pu;
-                        }
-                        else
-                        {
-                            /* found path: flip along stack */
-                            /* stack contains sequence of left indices representing alternating path */
-                            /* Walk back and flip pairs along alternating edges */
-                            int cur_v = v;
-                            for (int idx = stack_sz - 1; idx >= 0; idx--)
-                            {
-                                int cur_u = stack[idx];
-                                /* find neighbor in adjL[cur_u] equal to cur_v */
-                                /* set pairU[cur_u] = cur_v and pairV[cur_v] = cur_u */
-                                pairU[cur_u] = cur_v;
-                                pairV[cur_v] = cur_u;
-                                /* if idx > 0, cur_v becomes previous matched partner in previous step: find previous v' for next flip */
-                                if (idx > 0)
-                                {
-                                    /* previous left node is stack[idx-1]; we need the v matched to it before (which is pairU[ stack[idx-1] ]) */
-                                    cur_v = pairU[stack[idx - 1]];
-                                }
-                            }
-                            matching++;
-                            /* clear stack */
-                            stack_sz = 0;
-                        }
-                    }
-                }
-                else
-                {
-                    /* backtrack */
-                    stack_sz--;
-                }
-            }
-        }
-
-        free(stack);
-        free(next);
-
-        /* continue to next BFS round until no more augmenting paths */
-    }
-
-    /* cleanup adjacency lists */
-    for (int i = 0; i < left_n; i++)
-        free(adjL[i]);
-    free(adjL);
-    free(adj_sizes);
-    free(dist);
-    free(q);
-
-    *pairU_out = pairU;
-    *pairV_out = pairV;
-    return matching;
-}
+/**
+ * @brief Shared state of the component tasks
+ */
+typedef struct
+{
+    const CSRGraph *csr;
+    const int *local;                // local[v] = index of v within its side of its part
+    MatchingWorkspace **workspaces;  // One per worker, reused across its components
+} KonigContext;
 
 /**
- * @brief Derives minimum vertex cover from maximum bipartite matching
- *
- * This function implements the constructive proof of König's theorem by
- * performing alternating BFS from unmatched left vertices to find the
- * minimum vertex cover.
- *
- * Algorithm steps:
- * 1. Start BFS from all unmatched left vertices
- * 2. Follow alternating paths: non-matching edges L→R, matching edges R→L
- * 3. Let Z be the set of visited vertices
- * 4. Minimum vertex cover = (Left \ Z) ∪ (Right ∩ Z)
- *
- * @param graph Pointer to the graph structure
- * @param left_nodes Array of left partition vertex indices
- * @param left_n Number of left vertices
- * @param right_nodes Array of right partition vertex indices
- * @param right_n Number of right vertices
- * @param pairU Matching array for left vertices
- * @param pairV Matching array for right vertices
+ * @brief Minimum vertex cover of the bipartite subgraph spanned by left ∪ right
  *
- * @return Pointer to Set containing minimum vertex cover
+ * Builds the left rows of the part in local numbering, matches them with
+ * Hopcroft-Karp (Karp-Sipser seeded) and takes the König cover.
  *
- * @complexity O(V + E) for BFS traversal
- *
- * @pre All input parameters must be valid and consistent
- * @pre pairU and pairV must represent a valid matching
- * @post Returns newly allocated Set that caller must free
- * @post |returned cover| = |maximum matching| (König's theorem)
- * @post Returned cover is guaranteed to be minimum
+ * @param ctx Shared state; local[] must number the part's vertices per side
+ * @param ws Matching workspace of the calling worker
+ * @return Newly allocated cover (empty when one side is empty), or NULL on
+ *         allocation failure
  */
-static Set *vertex_cover_from_matching(Graph *graph, int *left_nodes, int left_n, int *right_nodes, int right_n,
-                                       int *pairU, int *pairV)
+static Set *konig_cover(const KonigContext *ctx, MatchingWorkspace *ws, int *left_nodes, int left_n,
+                        int *right_nodes, int right_n)
 {
-    int n = graph->node_count;
-    char *visitedL = calloc(left_n, 1);
-    char *visitedR = calloc(right_n, 1);
+    if (left_n == 0 || right_n == 0)
+        return set_create(1); /* no edge can cross an empty side */
 
-    /* build adjacency for quick neighbor iteration */
-    int **adjL = malloc(left_n * sizeof(int *));
-    int *adjL_sz = calloc(left_n, sizeof(int));
+    const CSRGraph *csr = ctx->csr;
+    int arcs = 0;
     for (int i = 0; i < left_n; i++)
-    {
-        int u = left_nodes[i];
-        int cnt = 0;
-        for (int j = 0; j < right_n; j++)
-        {
-            int v = right_nodes[j];
-            if (graph->adjacency[u][v])
-                cnt++;
-        }
-        adjL[i] = malloc((cnt > 0 ? cnt : 1) * sizeof(int));
-        int k = 0;
-        for (int j = 0; j < right_n; j++)
-        {
-            int v = right_nodes[j];
-            if (graph->adjacency[u][v])
-                adjL[i][k++] = j;
-        }
-        adjL_sz[i] = k;
-    }
+        arcs += csr_degree(csr, left_nodes[i]);
 
-    /* BFS queue of (isLeft, index) pairs — encode as signed int: positive = left idx, negative-1 = right idx */
-    int qcap = left_n + right_n + 5;
-    int *queue = malloc(qcap * sizeof(int));
-    int qh = 0, qt = 0;
-
-    /* enqueue all unmatched left vertices */
-    for (int i = 0; i < left_n; i++)
+    int *offsets = malloc((left_n + 1) * sizeof(int));
+    int *neighbors = calloc(arcs > 0 ? arcs : 1, sizeof(int));
+    bool *cover_left = malloc(left_n * sizeof(bool));
+    bool *cover_right = malloc(right_n * sizeof(bool));
+    Set *vc = NULL;
+    bool ok = offsets && neighbors && cover_left && cover_right;
+    if (ok)
     {
-        if (pairU[i] == -1)
+        offsets[0] = 0;
+        for (int i = 0; i < left_n; i++)
         {
-            visitedL[i] = 1;
-            queue[qt++] = i; /* encode left as non-negative */
+            int u = left_nodes[i];
+            offsets[i + 1] = offsets[i];
+            for (int k = csr->offsets[u]; k < csr->offsets[u + 1]; k++)
+                neighbors[offsets[i + 1]++] = ctx->local[csr->neighbors[k]];
         }
     }
-
-    while (qh < qt)
+    if (ok && matching_maximum(ws, left_n, right_n, offsets, neighbors, MATCHING_INIT_KARP_SIPSER) >= 0)
     {
-        int code = queue[qh++];
-        if (code >= 0)
+        /* Vertex cover = (Left \ Z) ∪ (Right ∩ Z) */
+        matching_konig_cover(ws, offsets, neighbors, cover_left, cover_right);
+        vc = set_create(ws->size > 0 ? ws->size : 1);
+        for (int i = 0; i < left_n; i++)
         {
-            /* left index */
-            int li = code;
-            for (int k = 0; k < adjL_sz[li]; k++)
-            {
-                int rj = adjL[li][k];
-                if (!visitedR[rj])
-                {
-                    if (pairU[li] != rj)
-                    { /* traverse only via non-matching edges left->right */
-                        visitedR[rj] = 1;
-                        queue[qt++] = -1 - rj; /* encode right as negative */
-                    }
-                }
-            }
+            if (cover_left[i])
+                set_add(vc, left_nodes[i]);
         }
-        else
+        for (int j = 0; j < right_n; j++)
         {
-            /* right index */
-            int rj = -1 - code;
-            int paired_left = pairV[rj];
-            if (paired_left != -1 && !visitedL[paired_left])
-            {
-                visitedL[paired_left] = 1;
-                queue[qt++] = paired_left;
-            }
+            if (cover_right[j])
+                set_add(vc, right_nodes[j]);
         }
     }
 
-    /* Build vertex cover = (Left \ Z) union (Right ∩ Z) */
-    Set *vc = set_create(n);
-    for (int i = 0; i < left_n; i++)
-    {
-        int orig = left_nodes[i];
-        if (!visitedL[i])
-            set_add(vc, orig);
-    }
-    for (int j = 0; j < right_n; j++)
-    {
-        int orig = right_nodes[j];
-        if (visitedR[j])
-            set_add(vc, orig);
-    }
-
-    /* cleanup */
-    for (int i = 0; i < left_n; i++)
-        free(adjL[i]);
-    free(adjL);
-    free(adjL_sz);
-    free(queue);
-    free(visitedL);
-    free(visitedR);
-
+    free(offsets);
+    free(neighbors);
+    free(cover_left);
+    free(cover_right);
     return vc;
 }
 
+/**
+ * @brief Task body: covers one component (the job stays owned by the caller's array)
+ */
+static void konig_component_task(TaskPool *pool, int worker, void *task, void *user)
+{
+    (void)pool;
+    const KonigContext *ctx = user;
+    KonigJob *job = task;
+    job->cover = konig_cover(ctx, ctx->workspaces[worker], job->left_nodes, job->left_n, job->right_nodes,
+                             job->right_n);
+}
+
 /**
  * @brief Finds optimal vertex cover for bipartite graphs using König's theorem
  *
@@ -681,8 +927,15 @@ static Set *vertex_cover_from_matching(Graph *graph, int *left_nodes, int left_n
  *
  * Algorithm overview:
  * 1. Check if graph is bipartite and get partitions
- * 2. Find maximum matching using Hopcroft-Karp
- * 3. Derive minimum vertex cover using König's theorem
+ * 2. Split the vertices by connected component
+ * 3. Per component (in parallel): maximum matching with the CSR
+ *    Hopcroft-Karp engine of matching.h, then the König cover of that
+ *    component
+ * 4. Concatenate the component covers
+ *
+ * A minimum cover of a disconnected graph is the union of minimum covers of
+ * its components. Every worker keeps one MatchingWorkspace for all of its
+ * components, so the per-component runs allocate only their rows.
  *
  * König's Theorem: In bipartite graphs, the size of minimum vertex cover
  * equals the size of maximum matching.
@@ -694,7 +947,7 @@ static Set *vertex_cover_from_matching(Graph *graph, int *left_nodes, int left_n
  * @complexity O(E√V) dominated by Hopcroft-Karp algorithm
  *
  * @pre graph must be an undirected graph (is_directed == false)
- * @pre graph must have valid adjacency matrix
+ * @pre graph must have an adjacency matrix or a CSR view
  * @post Returns NULL if graph is not bipartite
  * @post Returns optimal vertex cover for bipartite graphs
  * @post Caller must free returned Set
@@ -717,46 +970,120 @@ Set *vertex_cover_bipartite_konig(Graph *graph)
     {
         return NULL; /* not bipartite */
     }
-
-    int *left_nodes = NULL, *right_nodes = NULL;
-    int left_n = 0, right_n = 0;
-    build_left_right_lists_from_masks(graph, left_mask, &left_nodes, &left_n, &right_nodes, &right_n);
-
-    free(left_mask);
     free(right_mask);
 
-    int *pairU = NULL, *pairV = NULL;
-    int match_size = hopcroft_karp(graph, left_nodes, left_n, right_nodes, right_n, &pairU, &pairV);
-
-    /* If no matching arrays (empty sides), handle trivial cases */
-    if (left_n == 0 || right_n == 0)
+    int n = graph->node_count;
+    ComponentLabeling cc;
+    int *buffer = NULL;
+    KonigJob *jobs = NULL;
+    int *local = malloc((n > 0 ? n : 1) * sizeof(int));
+    if (components_compute(graph, 0, &cc) == 0)
     {
-        /* trivial cover: all non-isolated vertices (or none) */
-        Set *vc = set_create(graph->node_count);
-        for (int i = 0; i < graph->node_count; i++)
+        buffer = malloc((n > 0 ? n : 1) * sizeof(int));
+        jobs = malloc((cc.count > 0 ? cc.count : 1) * sizeof(KonigJob));
+    }
+    if (!local || !buffer || !jobs)
+    {
+        /* no labelling: cover the graph as a single part */
+        free(buffer);
+        free(jobs);
+        components_free(&cc);
+        int *left_nodes = NULL, *right_nodes = NULL;
+        int left_n = 0, right_n = 0;
+        build_left_right_lists_from_masks(graph, left_mask, &left_nodes, &left_n, &right_nodes, &right_n);
+        free(left_mask);
+        MatchingWorkspace *ws = matching_workspace_create();
+        Set *vc = NULL;
+        if (local && ws)
         {
-            int deg = 0;
-            for (int j = 0; j < graph->node_count; j++)
-                if (graph->adjacency[i][j])
-                    deg++;
-            if (deg > 0)
-                set_add(vc, i);
+            for (int i = 0; i < left_n; i++)
+                local[left_nodes[i]] = i;
+            for (int j = 0; j < right_n; j++)
+                local[right_nodes[j]] = j;
+            KonigContext ctx = {graph->csr, local, &ws};
+            vc = konig_cover(&ctx, ws, left_nodes, left_n, right_nodes, right_n);
         }
-        if (pairU)
-            free(pairU);
-        if (pairV)
-            free(pairV);
+        matching_workspace_destroy(ws);
+        free(local);
         free(left_nodes);
         free(right_nodes);
         return vc;
     }
 
-    /* derive vertex cover using visited sets from alternating BFS */
-    Set *vc = vertex_cover_from_matching(graph, left_nodes, left_n, right_nodes, right_n, pairU, pairV);
+    /* one job per component with an edge; isolated vertices never enter a cover */
+    int job_count = 0;
+    for (int c = 0; c < cc.count; c++)
+    {
+        if (cc.sizes[c] < 2)
+            continue;
+        const int *members = cc.members + cc.offsets[c];
+        KonigJob *job = &jobs[job_count++];
+        job->left_nodes = buffer + cc.offsets[c];
+        job->left_n = 0;
+        for (int i = 0; i < cc.sizes[c]; i++)
+            if (left_mask[members[i]])
+            {
+                local[members[i]] = job->left_n;
+                job->left_nodes[job->left_n++] = members[i];
+            }
+        job->right_nodes = job->left_nodes + job->left_n;
+        job->right_n = 0;
+        for (int i = 0; i < cc.sizes[c]; i++)
+            if (!left_mask[members[i]])
+            {
+                local[members[i]] = job->right_n;
+                job->right_nodes[job->right_n++] = members[i];
+            }
+        job->cover = NULL;
+    }
+    free(left_mask);
+    components_free(&cc);
+
+    int workers = task_pool_default_threads();
+    if (workers > job_count)
+        workers = job_count;
+    if (workers < 1)
+        workers = 1;
+    MatchingWorkspace **workspaces = calloc(workers, sizeof(MatchingWorkspace *));
+    bool ok = workspaces != NULL;
+    for (int w = 0; ok && w < workers; w++)
+        ok = (workspaces[w] = matching_workspace_create()) != NULL;
 
-    free(pairU);
-    free(pairV);
-    free(left_nodes);
-    free(right_nodes);
+    KonigContext ctx = {graph->csr, local, workspaces};
+    TaskPool *pool = ok && workers > 1 ? task_pool_create(workers, konig_component_task, &ctx) : NULL;
+    if (pool)
+    {
+        for (int j = 0; j < job_count; j++)
+            task_pool_submit(pool, j % workers, &jobs[j]);
+        task_pool_run(pool);
+        task_pool_destroy(pool);
+    }
+    else
+    {
+        for (int j = 0; ok && j < job_count; j++)
+            konig_component_task(NULL, 0, &jobs[j], &ctx);
+    }
+
+    Set *vc = ok ? set_create(n > 0 ? n : 1) : NULL;
+    for (int j = 0; j < job_count; j++)
+    {
+        if (!jobs[j].cover)
+            ok = false;
+        for (int i = 0; ok && i < jobs[j].cover->size; i++)
+            set_add(vc, jobs[j].cover->vertices[i]);
+        if (jobs[j].cover)
+            set_destroy(jobs[j].cover);
+    }
+    if (!ok && vc)
+    {
+        set_destroy(vc);
+        vc = NULL;
+    }
+    for (int w = 0; workspaces && w < workers; w++)
+        matching_workspace_destroy(workspaces[w]);
+    free(workspaces);
+    free(jobs);
+    free(buffer);
+    free(local);
     return vc;
 }